@@ -13,4 +13,16 @@
 // size_t bitcpy(T1 dest[], const T2 source, const size_t bit_offset, const size_t bits)
 #include "bitcpy_from_array.h"
 
+// size_t little_endian_bitcpy(...), same signatures as bitcpy, but least significant byte first
+#include "bitcpy_little_endian.h"
+
+// size_t lsb_first_bitcpy(...), same signatures as bitcpy, but with bits numbered from each element's LSB
+#include "bitcpy_lsb_first.h"
+
+// bulk (whole array) bitcpy kernels used by serdes::packet
+#include "bitcpy_bulk.h"
+
+// size_t bitmove(sized_pointer<T1> dest, dest_bit_offset, sized_pointer<T2> source, source_bit_offset, bits)
+#include "bitcpy_bitmove.h"
+
 #endif // _BITCPY_H_
@@ -0,0 +1,233 @@
+/// @file bitcpy_bitmove.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines bitmove, a bit granular memmove between two serial arrays
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _BITCPY_BITMOVE_H_
+#define _BITCPY_BITMOVE_H_
+
+#include "bitcpy_to_array.h"
+#include "bitcpy_from_array.h"
+#include "bitcpy_bulk.h"
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    // implementation details
+    namespace detail
+    {
+        /// @brief true if two arrays share any memory
+        inline bool arrays_overlap(const void *const a, const size_t a_bytes, const void *const b, const size_t b_bytes) noexcept
+        {
+            const uintptr_t a_begin = reinterpret_cast<uintptr_t>(a);
+            const uintptr_t b_begin = reinterpret_cast<uintptr_t>(b);
+            return a_bytes != 0u && b_bytes != 0u && a_begin < b_begin + b_bytes && b_begin < a_begin + a_bytes;
+        }
+
+        /// @brief [[bitmove, same bit alignment]] moves a partial leading element and a partial trailing element
+        /// with bitcpy, and all the whole elements in between with a memmove
+        template <typename T_array>
+        inline void aligned_bitmove(T_array *const dest, const size_t dest_bit_offset, const T_array *const source, const size_t source_bit_offset, const size_t bits) noexcept
+        {
+            constexpr size_t bits_per_T_array = sizeof(T_array) * 8u;
+            const size_t leading_bits = (bits_per_T_array - dest_bit_offset % bits_per_T_array) % bits_per_T_array;
+            const size_t head_bits = leading_bits < bits ? leading_bits : bits;
+            const size_t whole_elements = (bits - head_bits) / bits_per_T_array;
+            const size_t tail_bits = bits - head_bits - whole_elements * bits_per_T_array;
+
+            // the partial elements are read before anything is written, in case the arrays overlap
+            uint64_t head = 0u, tail = 0u;
+            if (head_bits != 0u)
+                bitcpy(head, source, source_bit_offset, head_bits);
+            if (tail_bits != 0u)
+                bitcpy(tail, source, source_bit_offset + bits - tail_bits, tail_bits);
+            if (whole_elements != 0u)
+                std::memmove(&dest[(dest_bit_offset + head_bits) / bits_per_T_array], &source[(source_bit_offset + head_bits) / bits_per_T_array], whole_elements * sizeof(T_array));
+            if (head_bits != 0u)
+                bitcpy(dest, head, dest_bit_offset, head_bits);
+            if (tail_bits != 0u)
+                bitcpy(dest, tail, dest_bit_offset + bits - tail_bits, tail_bits);
+        }
+
+        /// @brief [[bitmove, front to back]] funnels 64 bits at a time from a bit_reader into a bit_writer, so every
+        /// element is read and written once (safe for overlapping arrays as long as the destination starts first)
+        template <typename T_dest, typename T_source>
+        inline void forward_bitmove(T_dest *const dest, const size_t dest_bit_offset, const T_source *const source, const size_t, const size_t source_bit_offset, size_t bits) noexcept
+        {
+            bit_reader<T_source> reader(source, source_bit_offset);
+            bit_writer<T_dest> writer(dest, dest_bit_offset);
+            for (; bits >= 64u; bits -= 64u)
+                writer.write(reader.read(64u), 64u);
+            if (bits != 0u)
+                writer.write(reader.read(bits), bits);
+            writer.flush();
+        }
+
+        /// @brief [[bitmove, front to back, byte arrays]] aligns the destination to a byte boundary, then builds
+        /// each 8 destination bytes from two overlapping 64 bit source loads with a funnel shift
+        inline void forward_bitmove(uint8_t *const dest, size_t dest_bit_offset, const uint8_t *const source, const size_t source_size, size_t source_bit_offset, size_t bits) noexcept
+        {
+#ifndef configBITCPY_DISABLE_WIDE_ACCESS
+            const size_t leading_bits = (8u - (dest_bit_offset & 7u)) & 7u;
+            const size_t head_bits = leading_bits < bits ? leading_bits : bits;
+            if (head_bits != 0u)
+            {
+                uint8_t head = 0u;
+                bitcpy(head, source, source_bit_offset, head_bits);
+                bitcpy(dest, head, dest_bit_offset, head_bits);
+                dest_bit_offset += head_bits;
+                source_bit_offset += head_bits;
+                bits -= head_bits;
+            }
+            const size_t shift = source_bit_offset & 7u;
+            while (bits >= 64u && (source_bit_offset >> 3) + 9u <= source_size)
+            {
+                const uint8_t *const next_source = &source[source_bit_offset >> 3];
+                const uint64_t word = (load_big_endian_u64(next_source) << shift) | (static_cast<uint64_t>(next_source[8]) >> (8u - shift));
+                store_big_endian_u64(&dest[dest_bit_offset >> 3], word);
+                dest_bit_offset += 64u;
+                source_bit_offset += 64u;
+                bits -= 64u;
+            }
+#endif
+            if (bits != 0u)
+                forward_bitmove<uint8_t, uint8_t>(dest, dest_bit_offset, source, source_size, source_bit_offset, bits);
+        }
+
+        /// @brief [[bitmove, back to front]] moves 64 bit chunks starting from the end, for overlapping arrays
+        /// where the destination starts after the source
+        template <typename T_array>
+        inline void backward_bitmove(T_array *const dest, const size_t dest_bit_offset, const T_array *const source, const size_t source_bit_offset, size_t bits) noexcept
+        {
+            while (bits != 0u)
+            {
+                const size_t chunk_bits = bits < 64u ? bits : 64u;
+                bits -= chunk_bits;
+                uint64_t chunk = 0u;
+                bitcpy(chunk, source, source_bit_offset + bits, chunk_bits);
+                bitcpy(dest, chunk, dest_bit_offset + bits, chunk_bits);
+            }
+        }
+
+        /// @brief [[bitmove, same array type]] picks the kernel based on the bit alignment and overlap of the arrays
+        template <typename T_array>
+        inline size_t unchecked_bitmove(T_array *const dest, const size_t dest_size, const size_t dest_bit_offset, const T_array *const source, const size_t source_size, const size_t source_bit_offset, const size_t bits) noexcept
+        {
+            constexpr size_t bits_per_T_array = sizeof(T_array) * 8u;
+            if (dest_bit_offset % bits_per_T_array == source_bit_offset % bits_per_T_array)
+            {
+                aligned_bitmove(dest, dest_bit_offset, source, source_bit_offset, bits);
+                return bits;
+            }
+            if (arrays_overlap(dest, dest_size * sizeof(T_array), source, source_size * sizeof(T_array)))
+            {
+                // compare the positions as bit indexes of the lower addressed array
+                const bool dest_first = dest <= source;
+                const size_t element_distance = dest_first ? static_cast<size_t>(source - dest) : static_cast<size_t>(dest - source);
+                const size_t dest_bit_index = dest_bit_offset + (dest_first ? 0u : element_distance * bits_per_T_array);
+                const size_t source_bit_index = source_bit_offset + (dest_first ? element_distance * bits_per_T_array : 0u);
+                if (dest_bit_index > source_bit_index)
+                {
+                    backward_bitmove(dest, dest_bit_offset, source, source_bit_offset, bits);
+                    return bits;
+                }
+            }
+            forward_bitmove(dest, dest_bit_offset, source, source_size, source_bit_offset, bits);
+            return bits;
+        }
+
+        /// @brief [[bitmove, different array types]] arrays of different types can't be moved within each other
+        template <typename T_dest, typename T_source>
+        inline size_t unchecked_bitmove(T_dest *const dest, const size_t dest_size, const size_t dest_bit_offset, const T_source *const source, const size_t source_size, const size_t source_bit_offset, const size_t bits) noexcept
+        {
+            if (arrays_overlap(dest, dest_size * sizeof(T_dest), source, source_size * sizeof(T_source)))
+                return 0u;
+            forward_bitmove(dest, dest_bit_offset, source, source_size, source_bit_offset, bits);
+            return bits;
+        }
+
+        /// @brief [[bitmove, type punned (void) source array]] resolves the source element type
+        template <typename T_dest>
+        inline size_t unchecked_bitmove(T_dest *const dest, const size_t dest_size, const size_t dest_bit_offset, const sized_pointer<void> &source, const size_t source_bit_offset, const size_t bits) noexcept
+        {
+            switch (source.element_size)
+            {
+            case 1:
+                return unchecked_bitmove(dest, dest_size, dest_bit_offset, reinterpret_cast<const uint8_t *>(source.value), source.size, source_bit_offset, bits);
+            case 2:
+                return unchecked_bitmove(dest, dest_size, dest_bit_offset, reinterpret_cast<const uint16_t *>(source.value), source.size, source_bit_offset, bits);
+            case 4:
+                return unchecked_bitmove(dest, dest_size, dest_bit_offset, reinterpret_cast<const uint32_t *>(source.value), source.size, source_bit_offset, bits);
+            case 8:
+                return unchecked_bitmove(dest, dest_size, dest_bit_offset, reinterpret_cast<const uint64_t *>(source.value), source.size, source_bit_offset, bits);
+            default:
+                break;
+            }
+            return 0u;
+        }
+    }
+
+    /// @brief copies "bits" bits from one serial array to another, at any pair of bit offsets, like a bit granular
+    /// memmove. The arrays may overlap (as long as they have the same element type), and may have different
+    /// element types when they don't. Bit alignments that match use a memmove for all the whole elements.
+    ///
+    /// @tparam   T_dest: destination serial array base type (uint8_t, uint16_t, uint32_t, or uint64_t)
+    /// @tparam   T_source: source serial array base type (uint8_t, uint16_t, uint32_t, or uint64_t, optionally const)
+    /// @param    dest: the destination serial array
+    /// @param    dest_bit_offset: starting bit of the destination array to start copying to
+    /// @param    source: the source serial array
+    /// @param    source_bit_offset: starting bit of the source array to start copying from
+    /// @param    bits: number of bits to copy
+    /// @return   size_t: number of bits copied (0 if either range doesn't fit in its array, or if
+    /// overlapping arrays have different element types)
+    template <typename T_dest, typename T_source, typename std::enable_if<!std::is_void<T_dest>::value && !std::is_void<T_source>::value, int *>::type = nullptr>
+    inline size_t bitmove(sized_pointer<T_dest> dest, const size_t dest_bit_offset, sized_pointer<T_source> source, const size_t source_bit_offset, const size_t bits) noexcept
+    {
+        static_assert(std::is_integral<T_dest>::value && !std::is_signed<T_dest>::value && sizeof(T_dest) <= 8u, "bitmove requires unsigned serial arrays of up to 64 bit elements");
+        static_assert(std::is_integral<T_source>::value && !std::is_signed<T_source>::value && sizeof(T_source) <= 8u, "bitmove requires unsigned serial arrays of up to 64 bit elements");
+        if (bits == 0u || dest.bit_capacity() < dest_bit_offset + bits || source.bit_capacity() < source_bit_offset + bits)
+            return 0u;
+        return detail::unchecked_bitmove(dest.value, dest.size, dest_bit_offset, static_cast<const typename std::remove_cv<T_source>::type *>(source.value), source.size, source_bit_offset, bits);
+    }
+
+    /// @brief [[type punned (void) source array]] copies "bits" bits from one serial array to another (see above)
+    template <typename T_dest, typename std::enable_if<!std::is_void<T_dest>::value, int *>::type = nullptr>
+    inline size_t bitmove(sized_pointer<T_dest> dest, const size_t dest_bit_offset, const sized_pointer<void> &source, const size_t source_bit_offset, const size_t bits) noexcept
+    {
+        static_assert(std::is_integral<T_dest>::value && !std::is_signed<T_dest>::value && sizeof(T_dest) <= 8u, "bitmove requires unsigned serial arrays of up to 64 bit elements");
+        if (bits == 0u || dest.bit_capacity() < dest_bit_offset + bits || source.bit_capacity() < source_bit_offset + bits)
+            return 0u;
+        return detail::unchecked_bitmove(dest.value, dest.size, dest_bit_offset, source, source_bit_offset, bits);
+    }
+
+    /// @brief [[type punned (void) destination array]] copies "bits" bits from one serial array to another (see above)
+    inline size_t bitmove(const sized_pointer<void> &dest, const size_t dest_bit_offset, const sized_pointer<void> &source, const size_t source_bit_offset, const size_t bits) noexcept
+    {
+        if (bits == 0u || dest.bit_capacity() < dest_bit_offset + bits || source.bit_capacity() < source_bit_offset + bits)
+            return 0u;
+        switch (dest.element_size)
+        {
+        case 1:
+            return detail::unchecked_bitmove(reinterpret_cast<uint8_t *>(dest.value), dest.size, dest_bit_offset, source, source_bit_offset, bits);
+        case 2:
+            return detail::unchecked_bitmove(reinterpret_cast<uint16_t *>(dest.value), dest.size, dest_bit_offset, source, source_bit_offset, bits);
+        case 4:
+            return detail::unchecked_bitmove(reinterpret_cast<uint32_t *>(dest.value), dest.size, dest_bit_offset, source, source_bit_offset, bits);
+        case 8:
+            return detail::unchecked_bitmove(reinterpret_cast<uint64_t *>(dest.value), dest.size, dest_bit_offset, source, source_bit_offset, bits);
+        default:
+            break;
+        }
+        return 0u;
+    }
+
+    /// @brief [[type punned (void) destination array]] copies "bits" bits from one serial array to another (see above)
+    template <typename T_source, typename std::enable_if<!std::is_void<T_source>::value, int *>::type = nullptr>
+    inline size_t bitmove(const sized_pointer<void> &dest, const size_t dest_bit_offset, sized_pointer<T_source> source, const size_t source_bit_offset, const size_t bits) noexcept
+    {
+        return bitmove(dest, dest_bit_offset, sized_pointer<void>(source), source_bit_offset, bits);
+    }
+}
+
+#endif // _BITCPY_BITMOVE_H_
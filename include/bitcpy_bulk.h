@@ -0,0 +1,554 @@
+/// @file bitcpy_bulk.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines bulk bitcpy kernels, used to pack/unpack entire arrays of fixed bit width elements
+/// into/out-of a serial array in a single pass, instead of calling bitcpy once per element.
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _BITCPY_BULK_H_
+#define _BITCPY_BULK_H_
+
+#include "bitcpy_common.h"
+#ifdef configCPP_SERDES_ENABLE_CPU_DISPATCH
+#include "bitcpy_cpu_dispatch.h"
+#endif
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    // implementation details
+    namespace detail
+    {
+        /// @brief checks if a type can be handled by the bulk array kernels (any arithmetic
+        /// or enum type no larger than 64 bits, excluding bool)
+        template <typename T>
+        using supported_by_bulk_bitcpy =
+            std::integral_constant<bool,
+                (std::is_arithmetic<typename remove_cvref_cpp11<T>::type>::value ||
+                 std::is_enum<typename remove_cvref_cpp11<T>::type>::value) &&
+                !std::is_same<typename remove_cvref_cpp11<T>::type, bool>::value &&
+                (sizeof(T) <= 8u)>;
+
+        /// @brief shifts left without undefined behaviour when the shift is the full width of the type
+        __attribute__((const)) inline uint64_t shift_left_64(const uint64_t value, const size_t shift) noexcept
+        {
+            return shift >= 64u ? 0u : (value << shift);
+        }
+
+        /// @brief writes a sequence of fields into a serial array MSB first, gathering the bits
+        /// in a 64 bit accumulator so that each serial array element is written exactly once.
+        /// The bits in the first and last elements that are outside of the written range are preserved.
+        /// @tparam   T_array: serial array base type (unsigned, <= 64 bits)
+        template <typename T_array>
+        struct bit_writer
+        {
+            static constexpr size_t bits_per_T_array = sizeof(T_array) * 8u;
+
+            /// @brief next serial array element to be written
+            T_array *dest;
+
+            /// @brief right aligned pending bits not yet written to dest
+            uint64_t accumulator;
+
+            /// @brief number of valid bits in the accumulator (always < bits_per_T_array between writes)
+            size_t pending_bits;
+
+            /// @brief Construct a new bit writer object
+            /// @param    array: pointer to the start of the destination serial array
+            /// @param    bit_offset: starting bit of the destination array to start writing at
+            bit_writer(T_array *const array, const size_t bit_offset) noexcept
+                : dest{&array[bit_offset / bits_per_T_array]},
+                  accumulator{0u},
+                  pending_bits{bit_offset % bits_per_T_array}
+            {
+                // the leading bits of the first element are kept so they're written back unchanged
+                if (pending_bits != 0u)
+                    accumulator = static_cast<uint64_t>(*dest >> (bits_per_T_array - pending_bits));
+            }
+
+            /// @brief appends a field to the end of the written bits
+            /// @param    value: the field value (must not have any bits set above "bits")
+            /// @param    bits: number of bits in the field (<= 64)
+            inline void write(uint64_t value, size_t bits) noexcept
+            {
+                const size_t free_bits = 64u - pending_bits;
+                if (bits > free_bits)
+                {
+                    const size_t low_bits = bits - free_bits;
+                    append(value >> low_bits, free_bits);
+                    value &= bitmask<uint64_t>(low_bits);
+                    bits = low_bits;
+                }
+                append(value, bits);
+            }
+
+            /// @brief writes out the last partially filled element (if any), preserving its trailing bits
+            inline void flush() noexcept
+            {
+                if (pending_bits == 0u)
+                    return;
+                const size_t trailing_bits = bits_per_T_array - pending_bits;
+                const T_array trailing_mask = bitmask<T_array>(trailing_bits);
+                *dest = static_cast<T_array>((*dest & trailing_mask) | static_cast<T_array>(accumulator << trailing_bits));
+            }
+
+        private:
+            inline void append(const uint64_t value, const size_t bits) noexcept
+            {
+                accumulator = shift_left_64(accumulator, bits) | value;
+                pending_bits += bits;
+                while (pending_bits >= bits_per_T_array)
+                {
+                    pending_bits -= bits_per_T_array;
+                    *dest++ = static_cast<T_array>(accumulator >> pending_bits);
+                }
+            }
+        };
+
+#ifndef configBITCPY_DISABLE_WIDE_ACCESS
+        /// @brief byte arrays gather up to 64 bits before writing them out with a single big endian word store,
+        /// instead of writing every completed byte on its own
+        template <>
+        struct bit_writer<uint8_t>
+        {
+            /// @brief next serial array byte to be written
+            uint8_t *dest;
+
+            /// @brief right aligned pending bits not yet written to dest
+            uint64_t accumulator;
+
+            /// @brief number of valid bits in the accumulator (always < 64 between writes)
+            size_t pending_bits;
+
+            /// @brief Construct a new bit writer object
+            /// @param    array: pointer to the start of the destination serial array
+            /// @param    bit_offset: starting bit of the destination array to start writing at
+            bit_writer(uint8_t *const array, const size_t bit_offset) noexcept
+                : dest{&array[bit_offset / 8u]},
+                  accumulator{0u},
+                  pending_bits{bit_offset % 8u}
+            {
+                // the leading bits of the first byte are kept so they're written back unchanged
+                if (pending_bits != 0u)
+                    accumulator = static_cast<uint64_t>(*dest >> (8u - pending_bits));
+            }
+
+            /// @brief appends a field to the end of the written bits
+            /// @param    value: the field value (must not have any bits set above "bits")
+            /// @param    bits: number of bits in the field (<= 64)
+            inline void write(const uint64_t value, const size_t bits) noexcept
+            {
+                if (pending_bits + bits < 64u)
+                {
+                    accumulator = (accumulator << bits) | value;
+                    pending_bits += bits;
+                    return;
+                }
+                const size_t low_bits = pending_bits + bits - 64u;
+                store_big_endian_u64(dest, shift_left_64(accumulator, 64u - pending_bits) | (value >> low_bits));
+                dest += 8u;
+                accumulator = value & ~shift_left_64(~uint64_t(0u), low_bits);
+                pending_bits = low_bits;
+            }
+
+            /// @brief writes out the pending bytes, and the last partially filled byte (if any) preserving its trailing bits
+            inline void flush() noexcept
+            {
+                size_t bits = pending_bits;
+                for (; bits >= 8u; bits -= 8u)
+                    *dest++ = static_cast<uint8_t>(accumulator >> (bits - 8u));
+                if (bits != 0u)
+                    *dest = static_cast<uint8_t>((*dest & bitmask<uint8_t>(8u - bits)) | static_cast<uint8_t>(accumulator << (8u - bits)));
+            }
+        };
+#endif
+
+        /// @brief reads a sequence of fields out of a serial array MSB first, holding the most
+        /// recently read serial array element in an accumulator so each element is read exactly once.
+        /// @tparam   T_array: serial array base type (unsigned, <= 64 bits)
+        template <typename T_array>
+        struct bit_reader
+        {
+            static constexpr size_t bits_per_T_array = sizeof(T_array) * 8u;
+
+            /// @brief next serial array element to be read
+            const T_array *source;
+
+            /// @brief the most recently read serial array element
+            uint64_t accumulator;
+
+            /// @brief number of unread bits at the right side of the accumulator
+            size_t available_bits;
+
+            /// @brief Construct a new bit reader object
+            /// @param    array: pointer to the start of the source serial array
+            /// @param    bit_offset: starting bit of the source array to start reading from
+            bit_reader(const T_array *const array, const size_t bit_offset) noexcept
+                : source{&array[bit_offset / bits_per_T_array]},
+                  accumulator{0u},
+                  available_bits{0u}
+            {
+                const size_t skipped_bits = bit_offset % bits_per_T_array;
+                if (skipped_bits != 0u)
+                {
+                    accumulator = static_cast<uint64_t>(*source++);
+                    available_bits = bits_per_T_array - skipped_bits;
+                }
+            }
+
+            /// @brief reads the next field
+            /// @param    bits: number of bits in the field (1 to 64)
+            /// @return   uint64_t: the right aligned field value
+            inline uint64_t read(const size_t bits) noexcept
+            {
+                if (bits <= available_bits)
+                {
+                    available_bits -= bits;
+                    return (accumulator >> available_bits) & bitmask<uint64_t>(bits);
+                }
+                uint64_t result = available_bits != 0u ? (accumulator & bitmask<uint64_t>(available_bits)) : 0u;
+                size_t needed_bits = bits - available_bits;
+                while (needed_bits > bits_per_T_array)
+                {
+                    needed_bits -= bits_per_T_array;
+                    result = shift_left_64(result, bits_per_T_array) | static_cast<uint64_t>(*source++);
+                }
+                accumulator = static_cast<uint64_t>(*source++);
+                available_bits = bits_per_T_array - needed_bits;
+                return shift_left_64(result, needed_bits) | ((accumulator >> available_bits) & bitmask<uint64_t>(needed_bits));
+            }
+        };
+
+        /// @brief [[serialize, bulk]] packs "count" elements into a serial array, "bits" bits per element
+        /// @tparam   T_array: destination serial array base type
+        /// @tparam   T_val: source element type (must satisfy supported_by_bulk_bitcpy)
+        /// @param    dest: pointer to the start of the destination serial array
+        /// @param    source: pointer to the first source element
+        /// @param    count: number of elements to pack
+        /// @param    bit_offset: starting bit of the destination array
+        /// @param    bits: bits per element (1 to sizeof(T_val)*8)
+        template <typename T_array, typename T_val>
+        inline void bulk_pack(T_array *const dest, const T_val *const source, const size_t count, const size_t bit_offset, const size_t bits) noexcept
+        {
+            using T_unsigned = typename unsigned_type_sizeof<sizeof(T_val)>::type;
+            const uint64_t mask = bitmask<uint64_t>(bits);
+            bit_writer<T_array> writer(dest, bit_offset);
+            for (size_t i = 0; i < count; i++)
+            {
+                T_unsigned element;
+                std::memcpy(&element, &source[i], sizeof(T_val));
+                writer.write(static_cast<uint64_t>(element) & mask, bits);
+            }
+            writer.flush();
+        }
+
+        /// @brief stores an unpacked element, sign extending signed integers exactly like the signed bitcpy overload does
+        template <typename T_val>
+        inline void store_unpacked_element(T_val &dest, const uint64_t value, const size_t bits) noexcept
+        {
+            using T_unsigned = typename unsigned_type_sizeof<sizeof(T_val)>::type;
+            constexpr size_t bits_per_T_val = sizeof(T_val) * 8u;
+            T_unsigned element = static_cast<T_unsigned>(value);
+            if (std::is_integral<T_val>::value && std::is_signed<T_val>::value && bits < bits_per_T_val)
+            {
+                const T_unsigned sign_bit = static_cast<T_unsigned>(static_cast<T_unsigned>(1u) << (bits - 1u));
+                element = static_cast<T_unsigned>((element ^ sign_bit) - sign_bit);
+            }
+            std::memcpy(&dest, &element, sizeof(T_val));
+        }
+
+        /// @brief number of elements, starting at bit_offset and "bits" apart, that start before window_end_bit
+        __attribute__((const)) inline size_t elements_before(const size_t window_end_bit, const size_t count, const size_t bit_offset, const size_t bits) noexcept
+        {
+            if (window_end_bit <= bit_offset)
+                return 0u;
+            const size_t elements = (window_end_bit - bit_offset + bits - 1u) / bits;
+            return elements < count ? elements : count;
+        }
+
+        /// @brief unpacks the leading elements of a bulk_unpack out of a window of two serial array elements each,
+        /// which holds any field of up to one more bit than a serial array element at any bit offset. Unlike the
+        /// bit_reader, this has no data dependent branches, and no dependency from one element to the next
+        /// @return   size_t: the number of elements unpacked (the rest are left to the bit_reader)
+        template <typename T_array, typename T_val>
+        inline size_t window_unpack(T_val *const dest, const T_array *const source, const size_t count, const size_t bit_offset, const size_t bits) noexcept
+        {
+            constexpr size_t bits_per_T_array = sizeof(T_array) * 8u;
+            constexpr size_t window_shift = bits_per_T_array % 64u; // (64 bit arrays have no two element window)
+            if (bits_per_T_array > 32u || bits > bits_per_T_array + 1u)
+                return 0u;
+            const size_t end_element = (bit_offset + count * bits + bits_per_T_array - 1u) / bits_per_T_array;
+            const size_t elements = elements_before((end_element - 1u) * bits_per_T_array, count, bit_offset, bits);
+            for (size_t i = 0, bit = bit_offset; i < elements; i++, bit += bits)
+            {
+                const T_array *const pair = &source[bit / bits_per_T_array];
+                const uint64_t window = (static_cast<uint64_t>(pair[0]) << window_shift) | static_cast<uint64_t>(pair[1]);
+                store_unpacked_element(dest[i], (window << (64u - 2u * window_shift + bit % bits_per_T_array)) >> (64u - bits), bits);
+            }
+            return elements;
+        }
+
+#ifndef configBITCPY_DISABLE_WIDE_ACCESS
+        /// @brief byte arrays unpack each element with a single unaligned big endian 64 bit read instead, while the
+        /// 8 byte window stays inside the unpacked bytes (a 64 bit window holds any field of up to 57 bits)
+        template <typename T_val>
+        inline size_t window_unpack(T_val *const dest, const uint8_t *const source, const size_t count, const size_t bit_offset, const size_t bits) noexcept
+        {
+            if (bits > 57u)
+                return 0u;
+            const size_t end_byte = (bit_offset + count * bits + 7u) / 8u;
+            const size_t elements = end_byte < 8u ? 0u : elements_before((end_byte - 7u) * 8u, count, bit_offset, bits);
+            for (size_t i = 0, bit = bit_offset; i < elements; i++, bit += bits)
+                store_unpacked_element(dest[i], (load_big_endian_u64(&source[bit >> 3]) << (bit & 7u)) >> (64u - bits), bits);
+            return elements;
+        }
+#endif
+
+        /// @brief [[deserialize, bulk]] unpacks "count" elements out of a serial array, "bits" bits per element
+        /// @tparam   T_array: source serial array base type
+        /// @tparam   T_val: destination element type (must satisfy supported_by_bulk_bitcpy)
+        /// @param    dest: pointer to the first destination element
+        /// @param    source: pointer to the start of the source serial array
+        /// @param    count: number of elements to unpack
+        /// @param    bit_offset: starting bit of the source array
+        /// @param    bits: bits per element (1 to sizeof(T_val)*8)
+        template <typename T_array, typename T_val>
+        inline void bulk_unpack(T_val *const dest, const T_array *const source, const size_t count, const size_t bit_offset, const size_t bits) noexcept
+        {
+            size_t i = window_unpack(dest, source, count, bit_offset, bits);
+            bit_reader<T_array> reader(source, bit_offset + i * bits);
+            for (; i < count; i++)
+                store_unpacked_element(dest[i], reader.read(bits), bits);
+        }
+
+        /// @brief [[serialize, bulk, byte aligned]] copies "count" full width elements into a byte array,
+        /// reversing the bytes of each element if "swap_bytes" is set (compilers turn the swapping copy into
+        /// vector shuffles, or with configCPP_SERDES_ENABLE_CPU_DISPATCH defined, the runtime dispatched
+        /// byteswap_copy kernel is used, see bitcpy_cpu_dispatch.h)
+        template <typename T_val>
+        inline void byte_ordered_pack(uint8_t *const dest, const T_val *const source, const size_t count, const bool swap_bytes) noexcept
+        {
+            if (sizeof(T_val) == 1u || !swap_bytes)
+            {
+                std::memcpy(dest, source, count * sizeof(T_val));
+                return;
+            }
+#ifdef configCPP_SERDES_ENABLE_CPU_DISPATCH
+            cpu_dispatch::byteswap_copy(dest, source, count, sizeof(T_val));
+#else
+            using T_unsigned = typename unsigned_type_sizeof<sizeof(T_val)>::type;
+            for (size_t i = 0; i < count; i++)
+            {
+                T_unsigned element;
+                std::memcpy(&element, &source[i], sizeof(T_val));
+                element = byteswap(element);
+                std::memcpy(&dest[i * sizeof(T_val)], &element, sizeof(T_val));
+            }
+#endif
+        }
+
+        /// @brief [[deserialize, bulk, byte aligned]] copies "count" full width elements out of a byte array,
+        /// reversing the bytes of each element if "swap_bytes" is set (see byte_ordered_pack)
+        template <typename T_val>
+        inline void byte_ordered_unpack(T_val *const dest, const uint8_t *const source, const size_t count, const bool swap_bytes) noexcept
+        {
+            if (sizeof(T_val) == 1u || !swap_bytes)
+            {
+                std::memcpy(dest, source, count * sizeof(T_val));
+                return;
+            }
+#ifdef configCPP_SERDES_ENABLE_CPU_DISPATCH
+            cpu_dispatch::byteswap_copy(dest, source, count, sizeof(T_val));
+#else
+            using T_unsigned = typename unsigned_type_sizeof<sizeof(T_val)>::type;
+            for (size_t i = 0; i < count; i++)
+            {
+                T_unsigned element;
+                std::memcpy(&element, &source[i * sizeof(T_val)], sizeof(T_val));
+                element = byteswap(element);
+                std::memcpy(&dest[i], &element, sizeof(T_val));
+            }
+#endif
+        }
+
+        /// @brief [[serialize, bulk, byte aligned]] copies "count" full width elements into a byte array as
+        /// consecutive big endian values (a plain memcpy on big endian platforms, otherwise a byte swapping copy)
+        /// @tparam   T_val: source element type (must satisfy supported_by_bulk_bitcpy)
+        /// @param    dest: pointer to the first destination byte
+        /// @param    source: pointer to the first source element
+        /// @param    count: number of elements to copy
+        template <typename T_val>
+        inline void big_endian_pack(uint8_t *const dest, const T_val *const source, const size_t count) noexcept
+        {
+            byte_ordered_pack(dest, source, count, on_little_endian_platform());
+        }
+
+        /// @brief [[deserialize, bulk, byte aligned]] copies "count" consecutive big endian values out of a
+        /// byte array into full width elements (see big_endian_pack)
+        /// @tparam   T_val: destination element type (must satisfy supported_by_bulk_bitcpy)
+        /// @param    dest: pointer to the first destination element
+        /// @param    source: pointer to the first source byte
+        /// @param    count: number of elements to copy
+        template <typename T_val>
+        inline void big_endian_unpack(T_val *const dest, const uint8_t *const source, const size_t count) noexcept
+        {
+            byte_ordered_unpack(dest, source, count, on_little_endian_platform());
+        }
+
+        /// @brief [[serialize, bulk, byte aligned]] copies "count" full width elements into a byte array as
+        /// consecutive little endian values (a plain memcpy on little endian platforms)
+        /// @tparam   T_val: source element type (must satisfy supported_by_bulk_bitcpy)
+        /// @param    dest: pointer to the first destination byte
+        /// @param    source: pointer to the first source element
+        /// @param    count: number of elements to copy
+        template <typename T_val>
+        inline void little_endian_pack(uint8_t *const dest, const T_val *const source, const size_t count) noexcept
+        {
+            byte_ordered_pack(dest, source, count, !on_little_endian_platform());
+        }
+
+        /// @brief [[deserialize, bulk, byte aligned]] copies "count" consecutive little endian values out of a
+        /// byte array into full width elements (a plain memcpy on little endian platforms)
+        /// @tparam   T_val: destination element type (must satisfy supported_by_bulk_bitcpy)
+        /// @param    dest: pointer to the first destination element
+        /// @param    source: pointer to the first source byte
+        /// @param    count: number of elements to copy
+        template <typename T_val>
+        inline void little_endian_unpack(T_val *const dest, const uint8_t *const source, const size_t count) noexcept
+        {
+            byte_ordered_unpack(dest, source, count, !on_little_endian_platform());
+        }
+
+        /// @brief packs 8 bools into a byte, the first bool in the most significant bit (a multiply that moves
+        /// each bool's byte into its own bit of the top byte, which is as fast as a PEXT, without its byte swap)
+        /// @param    source: pointer to the first of 8 bools
+        /// @return   uint8_t: the packed bits
+        __attribute__((pure)) inline uint8_t pack_8_bools(const bool *const source) noexcept
+        {
+            static_assert(sizeof(bool) == 1u, "the bool kernels require single byte bools");
+            uint64_t word;
+            std::memcpy(&word, source, 8u);
+            if (!on_little_endian_platform())
+                word = byteswap(word);
+            return static_cast<uint8_t>((word * 0x8040201008040201u) >> 56);
+        }
+
+        /// @brief unpacks a byte into 8 bools, the most significant bit into the first bool (a multiply that
+        /// copies the byte into every byte, then a mask of one bit per byte, which beats a PDEP and its byte swap)
+        /// @param    dest: pointer to the first of 8 bools
+        /// @param    bits: the packed bits
+        inline void unpack_8_bools(bool *const dest, const uint8_t bits) noexcept
+        {
+            static_assert(sizeof(bool) == 1u, "the bool kernels require single byte bools");
+            const uint64_t selected = (bits * 0x0101010101010101u) & 0x0102040810204080u;
+            uint64_t word = ((selected + 0x7F7F7F7F7F7F7F7Fu) & 0x8080808080808080u) >> 7;
+            if (!on_little_endian_platform())
+                word = byteswap(word);
+            std::memcpy(dest, &word, 8u);
+        }
+
+        /// @brief [[serialize, bulk, bool]] packs "count" bools into a serial array, one bit per bool,
+        /// 64 bools per serial write (with configCPP_SERDES_ENABLE_CPU_DISPATCH defined, the runtime dispatched
+        /// kernel packs up to 512 at a time, with vpmovmskb on CPUs with AVX2, see bitcpy_cpu_dispatch.h)
+        /// @tparam   T_array: destination serial array base type
+        /// @param    dest: pointer to the start of the destination serial array
+        /// @param    source: pointer to the first source bool
+        /// @param    count: number of bools to pack
+        /// @param    bit_offset: starting bit of the destination array
+        template <typename T_array>
+        inline void bulk_pack(T_array *const dest, const bool *const source, const size_t count, const size_t bit_offset, const size_t) noexcept
+        {
+            bit_writer<T_array> writer(dest, bit_offset);
+            size_t i = 0;
+#ifdef configCPP_SERDES_ENABLE_CPU_DISPATCH
+            while (i + 64u <= count)
+            {
+                uint64_t packed[8];
+                const size_t words = (count - i) / 64u < 8u ? (count - i) / 64u : 8u;
+                cpu_dispatch::pack_bools(packed, &source[i], words);
+                for (size_t word = 0; word < words; word++, i += 64u)
+                    writer.write(packed[word], 64u);
+            }
+#else
+            for (; i + 64u <= count; i += 64u)
+            {
+                uint64_t word = 0u;
+                for (size_t byte = 0; byte < 8u; byte++)
+                    word = (word << 8) | pack_8_bools(&source[i + byte * 8u]);
+                writer.write(word, 64u);
+            }
+#endif
+            for (; i + 8u <= count; i += 8u)
+                writer.write(pack_8_bools(&source[i]), 8u);
+            for (; i < count; i++)
+                writer.write(source[i] ? 1u : 0u, 1u);
+            writer.flush();
+        }
+
+        /// @brief [[deserialize, bulk, bool]] unpacks "count" bools out of a serial array, one bit per bool,
+        /// 64 bools per serial read
+        /// @tparam   T_array: source serial array base type
+        /// @param    dest: pointer to the first destination bool
+        /// @param    source: pointer to the start of the source serial array
+        /// @param    count: number of bools to unpack
+        /// @param    bit_offset: starting bit of the source array
+        template <typename T_array>
+        inline void bulk_unpack(bool *const dest, const T_array *const source, const size_t count, const size_t bit_offset, const size_t) noexcept
+        {
+            bit_reader<T_array> reader(source, bit_offset);
+            size_t i = 0;
+            for (; i + 64u <= count; i += 64u)
+            {
+                const uint64_t word = reader.read(64u);
+                for (size_t byte = 0; byte < 8u; byte++)
+                    unpack_8_bools(&dest[i + byte * 8u], static_cast<uint8_t>(word >> (56u - byte * 8u)));
+            }
+            for (; i + 8u <= count; i += 8u)
+                unpack_8_bools(&dest[i], static_cast<uint8_t>(reader.read(8u)));
+            for (; i < count; i++)
+                dest[i] = reader.read(1u) != 0u;
+        }
+
+        /// @brief [[serialize, bulk, type punned (void) dest array]] packs "count" elements into a
+        /// serial array with a runtime determined base type (no bounds checking is performed)
+        template <typename T_val>
+        inline void bulk_pack(const sized_pointer<void> &dest, const T_val *const source, const size_t count, const size_t bit_offset, const size_t bits) noexcept
+        {
+            switch (dest.element_size)
+            {
+            case 1:
+                return bulk_pack(reinterpret_cast<uint8_t *>(dest.value), source, count, bit_offset, bits);
+            case 2:
+                return bulk_pack(reinterpret_cast<uint16_t *>(dest.value), source, count, bit_offset, bits);
+            case 4:
+                return bulk_pack(reinterpret_cast<uint32_t *>(dest.value), source, count, bit_offset, bits);
+            case 8:
+                return bulk_pack(reinterpret_cast<uint64_t *>(dest.value), source, count, bit_offset, bits);
+            default:
+                break;
+            }
+        }
+
+        /// @brief [[deserialize, bulk, type punned (void) source array]] unpacks "count" elements out of
+        /// a serial array with a runtime determined base type (no bounds checking is performed)
+        template <typename T_val>
+        inline void bulk_unpack(T_val *const dest, const sized_pointer<void> &source, const size_t count, const size_t bit_offset, const size_t bits) noexcept
+        {
+            switch (source.element_size)
+            {
+            case 1:
+                return bulk_unpack(dest, reinterpret_cast<const uint8_t *>(source.value), count, bit_offset, bits);
+            case 2:
+                return bulk_unpack(dest, reinterpret_cast<const uint16_t *>(source.value), count, bit_offset, bits);
+            case 4:
+                return bulk_unpack(dest, reinterpret_cast<const uint32_t *>(source.value), count, bit_offset, bits);
+            case 8:
+                return bulk_unpack(dest, reinterpret_cast<const uint64_t *>(source.value), count, bit_offset, bits);
+            default:
+                break;
+            }
+        }
+    } // namespace detail
+}
+
+#endif // _BITCPY_BULK_H_
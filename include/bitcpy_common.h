@@ -476,6 +476,83 @@ namespace serdes
                     ? default_bitsize<T_val>::value
                     : sizeof(T_wrap<T_val>) * 8u;
         };
+
+        /// @brief reverses the byte order of an unsigned integer
+        /// (compiles to a single bswap/rev instruction where available)
+        __attribute__((const)) constexpr uint8_t byteswap(const uint8_t x) noexcept
+        {
+            return x;
+        }
+#if defined(__GNUC__) || defined(__clang__)
+        __attribute__((const)) constexpr uint16_t byteswap(const uint16_t x) noexcept
+        {
+            return __builtin_bswap16(x);
+        }
+        __attribute__((const)) constexpr uint32_t byteswap(const uint32_t x) noexcept
+        {
+            return __builtin_bswap32(x);
+        }
+        __attribute__((const)) constexpr uint64_t byteswap(const uint64_t x) noexcept
+        {
+            return __builtin_bswap64(x);
+        }
+#else
+        __attribute__((const)) constexpr uint16_t byteswap(const uint16_t x) noexcept
+        {
+            return static_cast<uint16_t>((x << 8) | (x >> 8));
+        }
+        __attribute__((const)) constexpr uint32_t byteswap(const uint32_t x) noexcept
+        {
+            return (static_cast<uint32_t>(byteswap(static_cast<uint16_t>(x))) << 16) | byteswap(static_cast<uint16_t>(x >> 16));
+        }
+        __attribute__((const)) constexpr uint64_t byteswap(const uint64_t x) noexcept
+        {
+            return (static_cast<uint64_t>(byteswap(static_cast<uint32_t>(x))) << 32) | byteswap(static_cast<uint32_t>(x >> 32));
+        }
+#endif
+
+        /// @brief reads 8 consecutive bytes as one big endian word using a single (possibly unaligned) load
+        __attribute__((pure)) inline uint64_t load_big_endian_u64(const uint8_t *const data) noexcept
+        {
+            uint64_t word;
+            std::memcpy(&word, data, sizeof(word));
+            return on_little_endian_platform() ? byteswap(word) : word;
+        }
+
+        /// @brief writes one big endian word into 8 consecutive bytes using a single (possibly unaligned) store
+        inline void store_big_endian_u64(uint8_t *const data, const uint64_t word) noexcept
+        {
+            const uint64_t ordered_word = on_little_endian_platform() ? byteswap(word) : word;
+            std::memcpy(data, &ordered_word, sizeof(ordered_word));
+        }
+
+        /// @brief checks if a value type can be routed through the 64 bit word-at-a-time byte array kernels
+        template <typename T>
+        using supported_by_wide_bitcpy =
+            std::integral_constant<bool,
+                (std::is_arithmetic<T>::value || std::is_enum<T>::value) &&
+                std::is_same<T, typename std::remove_cv<T>::type>::value &&
+                (sizeof(T) <= 8u)>;
+
+        /// @brief finds the start of an 8 byte window within a byte array of "size" bytes that contains every
+        /// bit in [bit_offset, bit_offset + bits). The window is shifted back from the end of the array so that
+        /// it never touches bytes past the end. Returns "size" when no window is needed or none is possible.
+        __attribute__((const)) inline size_t wide_bitcpy_window(const size_t bit_offset, const size_t bits, const size_t size) noexcept
+        {
+#ifdef configBITCPY_DISABLE_WIDE_ACCESS
+            static_cast<void>(bit_offset);
+            static_cast<void>(bits);
+            return size;
+#else
+            // fields that stay within a single byte are already a single load, so they gain nothing here
+            if (((bit_offset & 7u) + bits) <= 8u || size < 8u)
+                return size;
+            const size_t first_byte = bit_offset / 8u;
+            const size_t window = (first_byte + 8u <= size) ? first_byte : size - 8u;
+            return (bit_offset - window * 8u + bits <= 64u) ? window : size;
+#endif
+        }
+
         template <typename T, typename T2>
         CONSTEXPR_ABOVE_CPP11 inline T big_endian_memcpy(const T2 *const)
         {
@@ -0,0 +1,357 @@
+/// @file bitcpy_cpu_dispatch.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Runtime CPU feature dispatch for the vectorizable kernels (byte swapping array copies, CRC-32C, and
+/// bool array packing).
+/// This header isn't included by serdes.h (so serdes.h doesn't bring in <immintrin.h>, <atomic>, or getenv), define
+/// configCPP_SERDES_ENABLE_CPU_DISPATCH before including serdes.h to use the kernels for byte swapped arrays, bool
+/// arrays, and CRC-32C checks, or include it directly to call the kernels.
+///
+/// The CPU is probed once, the first time a kernel is used, and the best supported kernel set (scalar, SSE4.2,
+/// or AVX2) is bound, so a single binary built without any -march flags still uses the vector instructions.
+///
+///   - CPP_SERDES_ISA=scalar|sse4.2|avx2 (environment variable) caps the kernel set that gets bound, so tests and
+///     benchmarks can exercise every variant on one machine
+///   - serdes::cpu_dispatch::active(), detected(), force(), and reset() query and rebind the kernel set at runtime
+///   - define configCPP_SERDES_FIXED_ISA as CPP_SERDES_ISA_SCALAR, CPP_SERDES_ISA_SSE4_2, or CPP_SERDES_ISA_AVX2 to
+///     pin a single kernel set at compile time (no probing, no environment lookup, and no rebinding), which
+///     is the default (pinned to scalar) on anything other than x86-64 GCC compatible compilers
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _BITCPY_CPU_DISPATCH_H_
+#define _BITCPY_CPU_DISPATCH_H_
+
+#include "bitcpy_common.h"
+
+#define CPP_SERDES_ISA_SCALAR 0
+#define CPP_SERDES_ISA_SSE4_2 1
+#define CPP_SERDES_ISA_AVX2 2
+
+#if !defined(configCPP_SERDES_FIXED_ISA) && !(defined(__x86_64__) && defined(__GNUC__))
+#define configCPP_SERDES_FIXED_ISA CPP_SERDES_ISA_SCALAR
+#endif
+#if defined(configCPP_SERDES_FIXED_ISA) && configCPP_SERDES_FIXED_ISA != CPP_SERDES_ISA_SCALAR && !(defined(__x86_64__) && defined(__GNUC__))
+#error "configCPP_SERDES_FIXED_ISA can only pin SSE4.2 or AVX2 kernels on x86-64 GCC compatible compilers"
+#endif
+
+#if !defined(configCPP_SERDES_FIXED_ISA) || configCPP_SERDES_FIXED_ISA != CPP_SERDES_ISA_SCALAR
+#define CPP_SERDES_X86_KERNELS 1
+#include <immintrin.h>
+#else
+#define CPP_SERDES_X86_KERNELS 0
+#endif
+#ifndef configCPP_SERDES_FIXED_ISA
+#include <atomic>
+#include <cstdlib>
+#endif
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    /// @brief instruction set levels of the dispatched kernels, each level includes the ones before it
+    enum class isa_e
+    {
+        SCALAR = CPP_SERDES_ISA_SCALAR,
+        SSE4_2 = CPP_SERDES_ISA_SSE4_2,
+        AVX2 = CPP_SERDES_ISA_AVX2
+    };
+
+    // implementation details
+    namespace detail
+    {
+        /// @brief [[scalar]] copies "count" elements of sizeof(T_unsigned) bytes, reversing the bytes of each one
+        template <typename T_unsigned>
+        inline void byteswap_copy_scalar(uint8_t *const dest, const uint8_t *const source, const size_t count) noexcept
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                T_unsigned element;
+                std::memcpy(&element, &source[i * sizeof(T_unsigned)], sizeof(T_unsigned));
+                element = byteswap(element);
+                std::memcpy(&dest[i * sizeof(T_unsigned)], &element, sizeof(T_unsigned));
+            }
+        }
+
+        /// @brief the reflected CRC-32C (Castagnoli) lookup table, built on first use
+        struct crc32c_table
+        {
+            uint32_t value[256];
+            crc32c_table() noexcept : value{}
+            {
+                for (uint32_t i = 0; i < 256u; i++)
+                {
+                    uint32_t crc = i;
+                    for (size_t bit = 0; bit < 8u; bit++)
+                        crc = (crc >> 1) ^ ((crc & 1u) ? 0x82F63B78u : 0u);
+                    value[i] = crc;
+                }
+            }
+        };
+
+        /// @brief [[scalar]] continues a CRC-32C calculation on the raw (not inverted) CRC state
+        inline uint32_t crc32c_scalar(uint32_t state, const uint8_t *data, size_t bytes) noexcept
+        {
+            static const crc32c_table table;
+            for (; bytes != 0u; bytes--)
+                state = table.value[static_cast<uint8_t>(state ^ *data++)] ^ (state >> 8);
+            return state;
+        }
+
+        /// @brief [[scalar]] packs 64 bools into each word, the first bool in the most significant bit, with a
+        /// multiply that moves each of 8 bools into its own bit of the top byte
+        inline void pack_bools_scalar(uint64_t *const packed, const bool *const source, const size_t words) noexcept
+        {
+            static_assert(sizeof(bool) == 1u, "the bool kernels require single byte bools");
+            for (size_t i = 0; i < words; i++)
+            {
+                uint64_t bits = 0u;
+                for (size_t byte = 0; byte < 8u; byte++)
+                {
+                    uint64_t word;
+                    std::memcpy(&word, &source[i * 64u + byte * 8u], 8u);
+                    if (!on_little_endian_platform())
+                        word = byteswap(word);
+                    bits = (bits << 8) | ((word * 0x8040201008040201u) >> 56);
+                }
+                packed[i] = bits;
+            }
+        }
+
+#if CPP_SERDES_X86_KERNELS
+        /// @brief pshufb control bytes that reverse every "element_size" byte group of a 16 byte lane
+        inline void byteswap_shuffle_control(uint8_t (&control)[16], const size_t element_size) noexcept
+        {
+            for (size_t i = 0; i < 16u; i++)
+                control[i] = static_cast<uint8_t>((i / element_size) * element_size + (element_size - 1u - i % element_size));
+        }
+
+        /// @brief [[SSE4.2]] copies and byte swaps 16 bytes per pshufb, the remainder with the scalar kernel
+        template <typename T_unsigned>
+        __attribute__((target("sse4.2"))) inline void byteswap_copy_sse4_2(uint8_t *const dest, const uint8_t *const source, const size_t count) noexcept
+        {
+            uint8_t control_bytes[16];
+            byteswap_shuffle_control(control_bytes, sizeof(T_unsigned));
+            const __m128i control = _mm_loadu_si128(reinterpret_cast<const __m128i *>(control_bytes));
+            const size_t bytes = count * sizeof(T_unsigned);
+            size_t i = 0;
+            for (; i + 16u <= bytes; i += 16u)
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(&dest[i]), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&source[i])), control));
+            byteswap_copy_scalar<T_unsigned>(&dest[i], &source[i], (bytes - i) / sizeof(T_unsigned));
+        }
+
+        /// @brief [[AVX2]] copies and byte swaps 32 bytes per vpshufb, the remainder with the SSE4.2 kernel
+        template <typename T_unsigned>
+        __attribute__((target("avx2"))) inline void byteswap_copy_avx2(uint8_t *const dest, const uint8_t *const source, const size_t count) noexcept
+        {
+            uint8_t control_bytes[16];
+            byteswap_shuffle_control(control_bytes, sizeof(T_unsigned));
+            const __m256i control = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i *>(control_bytes)));
+            const size_t bytes = count * sizeof(T_unsigned);
+            size_t i = 0;
+            for (; i + 32u <= bytes; i += 32u)
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(&dest[i]), _mm256_shuffle_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[i])), control));
+            byteswap_copy_sse4_2<T_unsigned>(&dest[i], &source[i], (bytes - i) / sizeof(T_unsigned));
+        }
+
+        /// @brief [[SSE4.2]] continues a CRC-32C calculation with the crc32 instruction, 8 bytes at a time
+        __attribute__((target("sse4.2"))) inline uint32_t crc32c_sse4_2(const uint32_t state, const uint8_t *data, size_t bytes) noexcept
+        {
+            uint64_t state64 = state;
+            for (; bytes >= 8u; bytes -= 8u, data += 8u)
+            {
+                uint64_t word;
+                std::memcpy(&word, data, sizeof(word));
+                state64 = _mm_crc32_u64(state64, word);
+            }
+            uint32_t state32 = static_cast<uint32_t>(state64);
+            for (; bytes != 0u; bytes--)
+                state32 = _mm_crc32_u8(state32, *data++);
+            return state32;
+        }
+
+        /// @brief [[AVX2]] packs 64 bools into each word, the first bool in the most significant bit, 32 at a time
+        /// with a vpmovmskb of their reversed bytes (the bools' low bits shifted up to the byte sign bits)
+        __attribute__((target("avx2"))) inline void pack_bools_avx2(uint64_t *const packed, const bool *const source, const size_t words) noexcept
+        {
+            const __m256i reverse = _mm256_setr_epi8(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+                                                     15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+            for (size_t i = 0; i < words; i++)
+            {
+                uint64_t bits = 0u;
+                for (size_t half = 0; half < 2u; half++)
+                {
+                    __m256i bools = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(&source[i * 64u + half * 32u]));
+                    bools = _mm256_permute4x64_epi64(_mm256_shuffle_epi8(bools, reverse), 0x4E);
+                    bits = (bits << 32) | static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_slli_epi16(bools, 7)));
+                }
+                packed[i] = bits;
+            }
+        }
+#endif
+
+        /// @brief one set of dispatched kernels
+        struct cpu_kernels
+        {
+            isa_e isa;
+            void (*byteswap_copy_16)(uint8_t *, const uint8_t *, size_t);
+            void (*byteswap_copy_32)(uint8_t *, const uint8_t *, size_t);
+            void (*byteswap_copy_64)(uint8_t *, const uint8_t *, size_t);
+            uint32_t (*crc32c)(uint32_t, const uint8_t *, size_t);
+            void (*pack_bools)(uint64_t *, const bool *, size_t);
+        };
+
+        /// @brief the kernel set of an instruction set level
+        inline const cpu_kernels &kernels_for(const isa_e isa) noexcept
+        {
+            static const cpu_kernels scalar_kernels = {isa_e::SCALAR, byteswap_copy_scalar<uint16_t>, byteswap_copy_scalar<uint32_t>, byteswap_copy_scalar<uint64_t>, crc32c_scalar, pack_bools_scalar};
+#if CPP_SERDES_X86_KERNELS
+            // AVX2 adds nothing to the crc32 instruction, so that level reuses the SSE4.2 CRC-32C kernel
+            static const cpu_kernels sse4_2_kernels = {isa_e::SSE4_2, byteswap_copy_sse4_2<uint16_t>, byteswap_copy_sse4_2<uint32_t>, byteswap_copy_sse4_2<uint64_t>, crc32c_sse4_2, pack_bools_scalar};
+            static const cpu_kernels avx2_kernels = {isa_e::AVX2, byteswap_copy_avx2<uint16_t>, byteswap_copy_avx2<uint32_t>, byteswap_copy_avx2<uint64_t>, crc32c_sse4_2, pack_bools_avx2};
+            if (isa == isa_e::AVX2)
+                return avx2_kernels;
+            if (isa == isa_e::SSE4_2)
+                return sse4_2_kernels;
+#else
+            static_cast<void>(isa);
+#endif
+            return scalar_kernels;
+        }
+
+#ifndef configCPP_SERDES_FIXED_ISA
+        /// @brief the best instruction set level the CPU supports
+        inline isa_e probe_cpu() noexcept
+        {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("sse4.2"))
+                return isa_e::AVX2;
+            if (__builtin_cpu_supports("sse4.2"))
+                return isa_e::SSE4_2;
+            return isa_e::SCALAR;
+        }
+
+        /// @brief the instruction set level cap requested through the CPP_SERDES_ISA environment variable
+        /// (AVX2, meaning no cap, if it isn't set or isn't recognized)
+        inline isa_e isa_from_environment() noexcept
+        {
+            const char *const requested = std::getenv("CPP_SERDES_ISA");
+            if (requested == nullptr)
+                return isa_e::AVX2;
+            if (std::strcmp(requested, "scalar") == 0)
+                return isa_e::SCALAR;
+            if (std::strcmp(requested, "sse4.2") == 0)
+                return isa_e::SSE4_2;
+            return isa_e::AVX2;
+        }
+
+        /// @brief the kernel set to bind: the best one the CPU supports, capped by the environment
+        inline const cpu_kernels &default_kernels() noexcept
+        {
+            const isa_e cpu = probe_cpu();
+            const isa_e cap = isa_from_environment();
+            return kernels_for(static_cast<int>(cap) < static_cast<int>(cpu) ? cap : cpu);
+        }
+
+        /// @brief the currently bound kernel set
+        inline std::atomic<const cpu_kernels *> &bound_kernels() noexcept
+        {
+            static std::atomic<const cpu_kernels *> bound{&default_kernels()};
+            return bound;
+        }
+
+        inline const cpu_kernels &active_kernels() noexcept
+        {
+            return *bound_kernels().load(std::memory_order_relaxed);
+        }
+#else
+        inline const cpu_kernels &active_kernels() noexcept
+        {
+            return kernels_for(static_cast<isa_e>(configCPP_SERDES_FIXED_ISA));
+        }
+#endif
+    }
+
+    /// @brief queries and controls which kernel set the dispatched kernels use
+    namespace cpu_dispatch
+    {
+        /// @brief the best instruction set level supported by the CPU (or the pinned level)
+        inline isa_e detected() noexcept
+        {
+#ifndef configCPP_SERDES_FIXED_ISA
+            static const isa_e cpu = detail::probe_cpu();
+            return cpu;
+#else
+            return static_cast<isa_e>(configCPP_SERDES_FIXED_ISA);
+#endif
+        }
+
+        /// @brief the instruction set level of the kernels currently in use
+        inline isa_e active() noexcept
+        {
+            return detail::active_kernels().isa;
+        }
+
+        /// @brief binds the kernels of a specific instruction set level
+        /// @return   true if bound, false if the CPU doesn't support it (or a different level is pinned)
+        inline bool force(const isa_e isa) noexcept
+        {
+#ifndef configCPP_SERDES_FIXED_ISA
+            if (static_cast<int>(isa) > static_cast<int>(detected()))
+                return false;
+            detail::bound_kernels().store(&detail::kernels_for(isa), std::memory_order_relaxed);
+            return true;
+#else
+            return isa == static_cast<isa_e>(configCPP_SERDES_FIXED_ISA);
+#endif
+        }
+
+        /// @brief rebinds the default kernels (the best supported, capped by the CPP_SERDES_ISA environment variable)
+        inline void reset() noexcept
+        {
+#ifndef configCPP_SERDES_FIXED_ISA
+            detail::bound_kernels().store(&detail::default_kernels(), std::memory_order_relaxed);
+#endif
+        }
+
+        /// @brief printable name of an instruction set level (matching the CPP_SERDES_ISA values)
+        inline const char *name(const isa_e isa) noexcept
+        {
+            return isa == isa_e::AVX2 ? "avx2" : isa == isa_e::SSE4_2 ? "sse4.2" : "scalar";
+        }
+
+        /// @brief copies "count" elements of "element_size" (2, 4, or 8) bytes, reversing the bytes of each
+        /// element (the arrays must not overlap)
+        inline void byteswap_copy(void *const dest, const void *const source, const size_t count, const size_t element_size) noexcept
+        {
+            uint8_t *const dest_bytes = static_cast<uint8_t *>(dest);
+            const uint8_t *const source_bytes = static_cast<const uint8_t *>(source);
+            const detail::cpu_kernels &kernels = detail::active_kernels();
+            switch (element_size)
+            {
+            case 2:
+                return kernels.byteswap_copy_16(dest_bytes, source_bytes, count);
+            case 4:
+                return kernels.byteswap_copy_32(dest_bytes, source_bytes, count);
+            case 8:
+                return kernels.byteswap_copy_64(dest_bytes, source_bytes, count);
+            default:
+                break;
+            }
+        }
+
+        /// @brief packs "words" * 64 bools, 64 into each word, the first bool in the most significant bit
+        inline void pack_bools(uint64_t *const packed, const bool *const source, const size_t words) noexcept
+        {
+            detail::active_kernels().pack_bools(packed, source, words);
+        }
+
+        /// @brief calculates the CRC-32C (Castagnoli, as used by iSCSI, SCTP, and ext4) of some bytes, or continues
+        /// an existing calculation by passing in the prior crc value (same results as CRC32::C in cppcrc.h)
+        inline uint32_t crc32c(const uint8_t *const bytes, const size_t num_bytes, const uint32_t prior_crc_value = 0u) noexcept
+        {
+            return ~detail::active_kernels().crc32c(~prior_crc_value, bytes, num_bytes);
+        }
+    }
+}
+
+#endif // _BITCPY_CPU_DISPATCH_H_
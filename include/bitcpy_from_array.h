@@ -46,7 +46,7 @@ namespace serdes
         {
             if (bits == 0) // unlikely. so we reduce the chances of needing to do this check until the last moment
                 return bits;
-            const T_array unaligned_mask = detail::bitmask<T_val>(bits);
+            const T_array unaligned_mask = detail::bitmask<T_array>(bits);
             const size_t alignment_shift = bits_per_T_array - number_of_bits_after_index;
             dest = static_cast<T_val>(static_cast<T_array>(source[array_read_index] >> alignment_shift) & unaligned_mask);
             return bits;
@@ -261,6 +261,75 @@ namespace serdes
         return bitcpy(dest_array, source, bit_offset, bits);
     }
 
+    // implementation details
+    namespace detail
+    {
+        /// @brief assigns a right aligned field of "bits" bits to an unsigned value
+        template <typename T_val, requires_unsigned_type<T_val> * = nullptr>
+        inline void assign_field(T_val &dest, const uint64_t field, const size_t) noexcept
+        {
+            dest = static_cast<T_val>(field);
+        }
+
+        /// @brief assigns a right aligned field of "bits" bits to a bool (same rules as the bool bitcpy)
+        template <typename T_val, requires_bool_type<T_val> * = nullptr>
+        inline void assign_field(T_val &dest, const uint64_t field, const size_t) noexcept
+        {
+            dest = static_cast<uint8_t>(field) != 0u;
+        }
+
+        /// @brief assigns a right aligned field of "bits" bits to a signed value, extending the sign bit
+        template <typename T_val, requires_signed_type<T_val> * = nullptr>
+        inline void assign_field(T_val &dest, const uint64_t field, const size_t bits) noexcept
+        {
+            const typename unsigned_type_sizeof<sizeof(T_val)>::type dest_copy = static_cast<typename unsigned_type_sizeof<sizeof(T_val)>::type>(field);
+            std::memcpy(&dest, &dest_copy, sizeof(T_val));
+            extend_sign(dest, bits);
+        }
+
+        /// @brief assigns a right aligned field of "bits" bits to a floating point or enum value
+        template <typename T_val, requires_small_non_integral_type<T_val> * = nullptr>
+        inline void assign_field(T_val &dest, const uint64_t field, const size_t) noexcept
+        {
+            const typename unsigned_type_sizeof<sizeof(T_val)>::type dest_copy = static_cast<typename unsigned_type_sizeof<sizeof(T_val)>::type>(field);
+            std::memcpy(&dest, &dest_copy, sizeof(T_val));
+        }
+
+        /// @brief [[deserialize, size safe]] bitcpy from an array with a known number of elements, for array
+        /// types without a word-at-a-time kernel this is the same as a plain bitcpy
+        template <typename T_array, typename T_val, typename std::enable_if<!(std::is_same<T_array, uint8_t>::value && supported_by_wide_bitcpy<T_val>::value) && !has_load_and_store_of_builtin<T_val>::value>::type * = nullptr>
+        CONSTEXPR_ABOVE_CPP11 size_t sized_bitcpy(T_val &dest, const T_array *const source, const size_t, const size_t bit_offset, const size_t bits) noexcept
+        {
+            return bitcpy(dest, source, bit_offset, bits);
+        }
+
+        /// @brief [[deserialize, size safe, uint8_t source]] bitcpy from a byte array with a known number of
+        /// elements, fields spanning multiple bytes are extracted from a single unaligned 64 bit big endian load
+        /// instead of element by element. Only the bytes in [0, size) are ever read.
+        template <typename T_array, typename T_val, typename std::enable_if<std::is_same<T_array, uint8_t>::value && supported_by_wide_bitcpy<T_val>::value>::type * = nullptr>
+        size_t sized_bitcpy(T_val &dest, const T_array *const source, const size_t size, const size_t bit_offset, const size_t bits) noexcept
+        {
+            const size_t window = wide_bitcpy_window(bit_offset, bits, size);
+            if (window == size)
+                return bitcpy(dest, source, bit_offset, bits);
+            const uint64_t word = load_big_endian_u64(&source[window]);
+            assign_field(dest, (word << (bit_offset - window * 8u)) >> (64u - bits), bits);
+            return bits;
+        }
+
+        /// @brief [[deserialize, size safe, store() dest]] bitcpy from an array with a known number of elements
+        /// into a wrapped type with a "store()" method (such as std::atomic), the wrapped value is copied and then
+        /// stored (the bitcpy overload for wrapped types is declared after this, so it can't be called here)
+        template <typename T_array, typename T_val, template <typename> class T_wrap, requires_load_and_store_of_builtin<T_wrap<T_val>> * = nullptr>
+        size_t sized_bitcpy(T_wrap<T_val> &dest, const T_array *const source, const size_t size, const size_t bit_offset, const size_t bits) noexcept
+        {
+            T_val temp_value = 0;
+            sized_bitcpy(temp_value, source, size, bit_offset, bits);
+            dest.store(temp_value);
+            return bits;
+        }
+    }
+
     /// @brief [[deserialize, size safe]] copies the specified number of bits from an sized_pointer into a
     /// value. used to prevent reading beyond the boundary of the source array.
     ///
@@ -276,7 +345,7 @@ namespace serdes
     {
         if (source.bit_capacity() < (bits + bit_offset))
             return 0;
-        bitcpy(dest, source.value, bit_offset, bits);
+        detail::sized_bitcpy(dest, source.value, source.size, bit_offset, bits);
         return bits;
     }
 
@@ -345,7 +414,8 @@ namespace serdes
     }
 
     /// @brief [[deserialize, size safe, type punned (void) source array]] copies the specified number of bits
-    /// from an array with a runtime determined base type into a value
+    /// from an array with a runtime determined base type into a value (always inlined, so the switch on the
+    /// element size folds into each caller, like the loads of a packet, instead of being shared out of line)
     ///
     /// @tparam   T_array: serial array base type
     /// @tparam   T_val: destination value type
@@ -355,14 +425,14 @@ namespace serdes
     /// @param    bits: number of bits to copy from
     /// @return   size_t: number of bits copied
     template <typename T_val = void>
-    CONSTEXPR_ABOVE_CPP11 size_t bitcpy(T_val &dest, const sized_pointer<void> &source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    __attribute__((always_inline)) inline CONSTEXPR_ABOVE_CPP11 size_t bitcpy(T_val &dest, const sized_pointer<void> &source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
     {
         if (source.bit_capacity() < (bits + bit_offset))
             return 0;
         switch (source.element_size)
         {
         case 1:
-            return bitcpy(dest, reinterpret_cast<const uint8_t *>(source.value), bit_offset, bits);
+            return detail::sized_bitcpy(dest, reinterpret_cast<const uint8_t *>(source.value), source.size, bit_offset, bits);
         case 2:
             return bitcpy(dest, reinterpret_cast<const uint16_t *>(source.value), bit_offset, bits);
         case 4:
@@ -374,6 +444,128 @@ namespace serdes
         }
         return 0;
     }
+
+    //
+    // compile time field position section: bitcpy<BitOffset, Bits>(dest, source)
+    //
+
+    // implementation details
+    namespace detail
+    {
+        /// @brief shifts a serial array element so that its bits line up with a field ending at array bit
+        /// "FieldEnd", given that the element ends at array bit "ElementEnd"
+        template <size_t FieldEnd, size_t ElementEnd, bool ElementEndsAfterField = (ElementEnd >= FieldEnd)>
+        struct static_field_shift
+        {
+            static constexpr uint64_t apply(const uint64_t element) noexcept { return element >> (ElementEnd - FieldEnd); }
+        };
+        template <size_t FieldEnd, size_t ElementEnd>
+        struct static_field_shift<FieldEnd, ElementEnd, false>
+        {
+            static constexpr uint64_t apply(const uint64_t element) noexcept { return element << (FieldEnd - ElementEnd); }
+        };
+
+        /// @brief gathers the "Count" serial array elements starting at "element" (which ends at array bit "ElementEnd")
+        /// into a right aligned field ending at array bit "FieldEnd", unrolled at compile time
+        template <typename T_array, size_t FieldEnd, size_t ElementEnd, size_t Count>
+        struct static_field_gather
+        {
+            static constexpr uint64_t apply(const T_array *const element) noexcept
+            {
+                return static_field_shift<FieldEnd, ElementEnd>::apply(static_cast<uint64_t>(element[0])) |
+                       static_field_gather<T_array, FieldEnd, ElementEnd + sizeof(T_array) * 8u, Count - 1u>::apply(element + 1);
+            }
+        };
+        template <typename T_array, size_t FieldEnd, size_t ElementEnd>
+        struct static_field_gather<T_array, FieldEnd, ElementEnd, 0u>
+        {
+            static constexpr uint64_t apply(const T_array *const) noexcept { return 0u; }
+        };
+
+        /// @brief reads the right aligned field [BitOffset, BitOffset + Bits) out of a serial array
+        template <size_t BitOffset, size_t Bits, typename T_array>
+        constexpr uint64_t static_field_read(const T_array *const source) noexcept
+        {
+            static_assert(std::is_integral<T_array>::value && !std::is_signed<T_array>::value && sizeof(T_array) <= 8u,
+                          "compile time bitcpy supports unsigned serial arrays of up to 64 bit elements");
+            static_assert(Bits > 0u && Bits <= 64u, "compile time bitcpy supports fields of 1 to 64 bits");
+            return static_field_gather<T_array,
+                                       BitOffset + Bits,
+                                       (BitOffset / (sizeof(T_array) * 8u) + 1u) * sizeof(T_array) * 8u,
+                                       (BitOffset + Bits - 1u) / (sizeof(T_array) * 8u) - BitOffset / (sizeof(T_array) * 8u) + 1u>::apply(&source[BitOffset / (sizeof(T_array) * 8u)]) &
+                   bitmask<uint64_t>(Bits);
+        }
+    }
+
+    /// @brief [[deserialize, uint destination, compile time position]] copies the field at a bit position
+    /// known at compile time from an array into a value, using straight-line shift/mask code
+    ///
+    /// @tparam   BitOffset: starting bit of the source array to start copying from
+    /// @tparam   Bits: number of bits to copy from (1 to 64)
+    /// @tparam   T_array: serial array base type
+    /// @tparam   T_val: destination value type
+    /// @param    dest: destination value reference
+    /// @param    source: pointer to the start of the source serial array
+    /// @return   size_t: number of bits copied
+    template <size_t BitOffset, size_t Bits, typename T_array, typename T_val, detail::requires_unsigned_type<T_val> * = nullptr>
+    CONSTEXPR_ABOVE_CPP11 size_t bitcpy(T_val &dest, const T_array *const source) noexcept
+    {
+        dest = static_cast<T_val>(detail::static_field_read<BitOffset, Bits>(source));
+        return Bits;
+    }
+
+    /// @brief [[deserialize, bool destination, compile time position]] copies the field at a bit position
+    /// known at compile time from an array into a boolean value
+    ///
+    /// @tparam   BitOffset: starting bit of the source array to start copying from
+    /// @tparam   Bits: number of bits to copy from (1 to 64)
+    /// @tparam   T_array: serial array base type
+    /// @tparam   T_val: destination value type, a boolean for this case.
+    /// @param    dest: destination boolean value reference
+    /// @param    source: pointer to the start of the source serial array
+    /// @return   size_t: number of bits copied
+    template <size_t BitOffset, size_t Bits, typename T_array, typename T_val, detail::requires_bool_type<T_val> * = nullptr>
+    CONSTEXPR_ABOVE_CPP11 size_t bitcpy(T_val &dest, const T_array *const source) noexcept
+    {
+        dest = static_cast<uint8_t>(detail::static_field_read<BitOffset, Bits>(source)) != 0u;
+        return Bits;
+    }
+
+    /// @brief [[deserialize, signed destination, compile time position]] copies the field at a bit position
+    /// known at compile time from an array into a signed value
+    ///
+    /// @tparam   BitOffset: starting bit of the source array to start copying from
+    /// @tparam   Bits: number of bits to copy from (1 to 64)
+    /// @tparam   T_array: serial array base type
+    /// @tparam   T_val: destination value type
+    /// @param    dest: destination value reference
+    /// @param    source: pointer to the start of the source serial array
+    /// @return   size_t: number of bits copied
+    template <size_t BitOffset, size_t Bits, typename T_array, typename T_val, detail::requires_signed_type<T_val> * = nullptr>
+    CONSTEXPR_ABOVE_CPP11 size_t bitcpy(T_val &dest, const T_array *const source) noexcept
+    {
+        dest = static_cast<T_val>(static_cast<typename detail::unsigned_type_sizeof<sizeof(T_val)>::type>(detail::static_field_read<BitOffset, Bits>(source)));
+        detail::extend_sign(dest, Bits);
+        return Bits;
+    }
+
+    /// @brief [[deserialize, integral value <= 8 bytes destination, compile time position]] copies the field at a
+    /// bit position known at compile time from an array into a floating point or enum value
+    ///
+    /// @tparam   BitOffset: starting bit of the source array to start copying from
+    /// @tparam   Bits: number of bits to copy from (1 to 64)
+    /// @tparam   T_array: serial array base type
+    /// @tparam   T_val: destination value type
+    /// @param    dest: destination value reference
+    /// @param    source: pointer to the start of the source serial array
+    /// @return   size_t: number of bits copied
+    template <size_t BitOffset, size_t Bits, typename T_array, typename T_val, detail::requires_small_non_integral_type<T_val> * = nullptr>
+    size_t bitcpy(T_val &dest, const T_array *const source) noexcept
+    {
+        const typename detail::unsigned_type_sizeof<sizeof(T_val)>::type dest_copy = static_cast<typename detail::unsigned_type_sizeof<sizeof(T_val)>::type>(detail::static_field_read<BitOffset, Bits>(source));
+        std::memcpy(&dest, &dest_copy, sizeof(T_val));
+        return Bits;
+    }
 }
 
 #endif // _BITCPY_FROM_ARRAY_H_
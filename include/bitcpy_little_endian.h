@@ -0,0 +1,186 @@
+/// @file bitcpy_little_endian.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines little_endian_bitcpy, a bitcpy that lays out multi-byte values least significant byte first
+///
+/// A little endian field of "bits" bits is serialized as its whole bytes, least significant byte first,
+/// followed by any remaining (bits % 8) most significant bits. Each of those pieces is still written MSB
+/// first at the current bit offset, exactly like bitcpy, so byte aligned fields match the in memory layout
+/// of a little endian platform, and fields of 8 bits or less are identical to a regular bitcpy.
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _BITCPY_LITTLE_ENDIAN_H_
+#define _BITCPY_LITTLE_ENDIAN_H_
+
+#include "bitcpy_to_array.h"
+#include "bitcpy_from_array.h"
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    // implementation details
+    namespace detail
+    {
+        /// @brief reorders the low "bits" bits of a value into little endian serial order
+        /// @param    value: right aligned value
+        /// @param    bits: field width (1 to 64)
+        /// @return   uint64_t: right aligned serial bits, as a regular (big endian) bitcpy would write them
+        __attribute__((const)) inline uint64_t to_little_endian_order(const uint64_t value, const size_t bits) noexcept
+        {
+            const size_t byte_bits = bits & ~size_t(7u);
+            const size_t tail_bits = bits & 7u;
+            const uint64_t tail = tail_bits == 0u ? 0u : (value >> byte_bits) & bitmask<uint64_t>(tail_bits);
+            if (byte_bits == 0u)
+                return tail;
+            return ((byteswap(value) >> (64u - byte_bits)) << tail_bits) | tail;
+        }
+
+        /// @brief inverse of to_little_endian_order
+        /// @param    serial: right aligned serial bits, as a regular (big endian) bitcpy reads them
+        /// @param    bits: field width (1 to 64)
+        /// @return   uint64_t: right aligned value
+        __attribute__((const)) inline uint64_t from_little_endian_order(const uint64_t serial, const size_t bits) noexcept
+        {
+            const size_t byte_bits = bits & ~size_t(7u);
+            const size_t tail_bits = bits & 7u;
+            const uint64_t tail = tail_bits == 0u ? 0u : serial & bitmask<uint64_t>(tail_bits);
+            if (byte_bits == 0u)
+                return tail;
+            const uint64_t value = byteswap(static_cast<uint64_t>(serial >> tail_bits) << (64u - byte_bits));
+            return tail_bits == 0u ? value : value | (tail << byte_bits);
+        }
+
+        /// @brief true if a full width field can be copied as is (or byte swapped on big endian platforms)
+        template <typename T_array, typename T_val>
+        constexpr bool little_endian_memcpy_compatible(const size_t bit_offset, const size_t bits) noexcept
+        {
+            return std::is_same<typename std::remove_cv<T_array>::type, uint8_t>::value && sizeof(T_val) > 1u &&
+                   bits == sizeof(T_val) * 8u && (bit_offset & 7u) == 0u;
+        }
+    }
+
+    /// @brief [[serialize]] copies the specified number of bits from a value into an array, least
+    /// significant byte first (see the file description for the exact layout)
+    ///
+    /// @tparam   T_array: destination serial array base type
+    /// @tparam   T_val: source value type (integral, floating point, or enum of up to 64 bits)
+    /// @param    dest: pointer to the start of the destination serial array
+    /// @param    source: source value
+    /// @param    bit_offset: starting bit of the destination array to start copying to
+    /// @param    bits: number of bits to copy (at most 64, wider fields are not copied)
+    /// @return   size_t: number of bits copied
+    template <typename T_array, typename T_val, typename std::enable_if<detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t little_endian_bitcpy(T_array *const dest, const T_val source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        if (bits == 0u || bits > 64u)
+            return 0u;
+        if (detail::little_endian_memcpy_compatible<T_array, T_val>(bit_offset, bits))
+        {
+            typename detail::unsigned_type_sizeof<sizeof(T_val)>::type element;
+            std::memcpy(&element, &source, sizeof(T_val));
+            if (!detail::on_little_endian_platform())
+                element = detail::byteswap(element);
+            std::memcpy(&reinterpret_cast<uint8_t *>(dest)[bit_offset >> 3], &element, sizeof(T_val));
+            return bits;
+        }
+        return bitcpy(dest, detail::to_little_endian_order(detail::raw_field(source), bits), bit_offset, bits);
+    }
+
+    /// @brief [[serialize, size safe]] copies the specified number of bits from a value into a sized
+    /// array, least significant byte first (nothing is copied if the field doesn't fit)
+    template <typename T_array, typename T_val, typename std::enable_if<!std::is_void<T_array>::value && detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t little_endian_bitcpy(sized_pointer<T_array> dest, const T_val source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        if (dest.bit_capacity() < (bits + bit_offset))
+            return 0u;
+        return little_endian_bitcpy(dest.value, source, bit_offset, bits);
+    }
+
+    /// @brief [[serialize, size safe, type punned (void) dest array]] copies the specified number of bits
+    /// from a value into a sized array with a runtime determined base type, least significant byte first
+    template <typename T_val, typename std::enable_if<detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t little_endian_bitcpy(sized_pointer<void> &dest, const T_val source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        if (dest.bit_capacity() < (bits + bit_offset))
+            return 0u;
+        switch (dest.element_size)
+        {
+        case 1:
+            return little_endian_bitcpy(reinterpret_cast<uint8_t *>(dest.value), source, bit_offset, bits);
+        case 2:
+            return little_endian_bitcpy(reinterpret_cast<uint16_t *>(dest.value), source, bit_offset, bits);
+        case 4:
+            return little_endian_bitcpy(reinterpret_cast<uint32_t *>(dest.value), source, bit_offset, bits);
+        case 8:
+            return little_endian_bitcpy(reinterpret_cast<uint64_t *>(dest.value), source, bit_offset, bits);
+        default:
+            break;
+        }
+        return 0u;
+    }
+
+    /// @brief [[deserialize]] copies the specified number of bits from an array into a value, least
+    /// significant byte first (see the file description for the exact layout)
+    ///
+    /// @tparam   T_val: destination value type (integral, floating point, or enum of up to 64 bits)
+    /// @tparam   T_array: source serial array base type
+    /// @param    dest: destination value reference
+    /// @param    source: pointer to the start of the source serial array
+    /// @param    bit_offset: starting bit of the source array to start copying from
+    /// @param    bits: number of bits to copy (at most 64, wider fields are not copied)
+    /// @return   size_t: number of bits copied
+    template <typename T_val, typename T_array, typename std::enable_if<detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t little_endian_bitcpy(T_val &dest, const T_array *const source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        if (bits == 0u || bits > 64u)
+            return 0u;
+        if (detail::little_endian_memcpy_compatible<T_array, T_val>(bit_offset, bits))
+        {
+            typename detail::unsigned_type_sizeof<sizeof(T_val)>::type element;
+            std::memcpy(&element, &reinterpret_cast<const uint8_t *>(source)[bit_offset >> 3], sizeof(T_val));
+            if (!detail::on_little_endian_platform())
+                element = detail::byteswap(element);
+            std::memcpy(&dest, &element, sizeof(T_val));
+            return bits;
+        }
+        uint64_t serial = 0u;
+        bitcpy(serial, source, bit_offset, bits);
+        detail::assign_field(dest, detail::from_little_endian_order(serial, bits), bits);
+        return bits;
+    }
+
+    /// @brief [[deserialize, size safe]] copies the specified number of bits from a sized array into a
+    /// value, least significant byte first (nothing is copied if the field doesn't fit)
+    template <typename T_val, typename T_array, typename std::enable_if<!std::is_void<T_array>::value && detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t little_endian_bitcpy(T_val &dest, const sized_pointer<T_array> source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        if (source.bit_capacity() < (bits + bit_offset))
+            return 0u;
+        return little_endian_bitcpy(dest, source.value, bit_offset, bits);
+    }
+
+    /// @brief [[deserialize, size safe, type punned (void) source array]] copies the specified number of bits
+    /// from a sized array with a runtime determined base type into a value, least significant byte first
+    template <typename T_val, typename std::enable_if<detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t little_endian_bitcpy(T_val &dest, const sized_pointer<void> &source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        if (source.bit_capacity() < (bits + bit_offset))
+            return 0u;
+        switch (source.element_size)
+        {
+        case 1:
+            return little_endian_bitcpy(dest, reinterpret_cast<const uint8_t *>(source.value), bit_offset, bits);
+        case 2:
+            return little_endian_bitcpy(dest, reinterpret_cast<const uint16_t *>(source.value), bit_offset, bits);
+        case 4:
+            return little_endian_bitcpy(dest, reinterpret_cast<const uint32_t *>(source.value), bit_offset, bits);
+        case 8:
+            return little_endian_bitcpy(dest, reinterpret_cast<const uint64_t *>(source.value), bit_offset, bits);
+        default:
+            break;
+        }
+        return 0u;
+    }
+}
+
+#endif // _BITCPY_LITTLE_ENDIAN_H_
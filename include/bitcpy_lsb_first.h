@@ -0,0 +1,195 @@
+/// @file bitcpy_lsb_first.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines lsb_first_bitcpy, a bitcpy that numbers bits from the least significant bit of each array element
+///
+/// With LSB first bit numbering, bit "n" of a serial array is bit (n % W) of element (n / W), counting from
+/// the element's least significant bit (where W is the element width in bits), and a field's least significant
+/// bit is stored at its starting bit offset. This is the layout of CAN DBC "Intel" signals, USB HID reports,
+/// and most LSB first bit streams. Multi-byte fields in byte arrays therefore end up least significant byte first.
+///
+/// Fields are copied a whole array element at a time (and with a single 64 bit load for size safe byte arrays),
+/// never a bit at a time.
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _BITCPY_LSB_FIRST_H_
+#define _BITCPY_LSB_FIRST_H_
+
+#include "bitcpy_to_array.h"
+#include "bitcpy_from_array.h"
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    // implementation details
+    namespace detail
+    {
+        /// @brief reads a right aligned LSB first field of 1 to 64 bits, one array element at a time
+        template <typename T_array>
+        inline uint64_t lsb_first_read(const T_array *const source, const size_t bit_offset, const size_t bits) noexcept
+        {
+            constexpr size_t element_bits = sizeof(T_array) * 8u;
+            size_t index = bit_offset / element_bits;
+            const size_t shift = bit_offset % element_bits;
+            uint64_t field = static_cast<uint64_t>(source[index]) >> shift;
+            for (size_t bits_read = element_bits - shift; bits_read < bits; bits_read += element_bits)
+                field |= static_cast<uint64_t>(source[++index]) << bits_read;
+            return field & bitmask<uint64_t>(bits);
+        }
+
+        /// @brief writes a right aligned LSB first field of 1 to 64 bits, one array element at a time
+        template <typename T_array>
+        inline void lsb_first_write(T_array *const dest, uint64_t field, const size_t bit_offset, const size_t bits) noexcept
+        {
+            constexpr size_t element_bits = sizeof(T_array) * 8u;
+            size_t index = bit_offset / element_bits;
+            size_t shift = bit_offset % element_bits;
+            size_t bits_remaining = bits;
+            while (true)
+            {
+                const size_t chunk = (element_bits - shift) < bits_remaining ? (element_bits - shift) : bits_remaining;
+                const T_array mask = static_cast<T_array>(bitmask<T_array>(chunk) << shift);
+                dest[index] = static_cast<T_array>((dest[index] & static_cast<T_array>(~mask)) | (static_cast<T_array>(field << shift) & mask));
+                bits_remaining -= chunk;
+                if (bits_remaining == 0u)
+                    return;
+                field >>= chunk;
+                index++;
+                shift = 0u;
+            }
+        }
+
+        /// @brief reads a right aligned LSB first field from a byte array with a known size, using a
+        /// single 64 bit load when the field and its 8 byte window fit in the array
+        inline uint64_t lsb_first_read(const uint8_t *const source, const size_t size, const size_t bit_offset, const size_t bits) noexcept
+        {
+            const size_t first_byte = bit_offset >> 3;
+            const size_t shift = bit_offset & 7u;
+#ifndef configBITCPY_DISABLE_WIDE_ACCESS
+            if (first_byte + 8u <= size && shift + bits <= 64u)
+            {
+                uint64_t word;
+                std::memcpy(&word, &source[first_byte], sizeof(word));
+                if (!on_little_endian_platform())
+                    word = byteswap(word);
+                return (word >> shift) & bitmask<uint64_t>(bits);
+            }
+#else
+            static_cast<void>(size);
+            static_cast<void>(first_byte);
+            static_cast<void>(shift);
+#endif
+            return lsb_first_read(source, bit_offset, bits);
+        }
+        template <typename T_array>
+        inline uint64_t lsb_first_read(const T_array *const source, const size_t, const size_t bit_offset, const size_t bits) noexcept
+        {
+            return lsb_first_read(source, bit_offset, bits);
+        }
+    }
+
+    /// @brief [[serialize]] copies the specified number of bits from a value into an array, numbering the
+    /// array's bits from the least significant bit of each element (see the file description)
+    ///
+    /// @tparam   T_array: destination serial array base type
+    /// @tparam   T_val: source value type (integral, floating point, or enum of up to 64 bits)
+    /// @param    dest: pointer to the start of the destination serial array
+    /// @param    source: source value
+    /// @param    bit_offset: starting bit of the destination array to start copying to
+    /// @param    bits: number of bits to copy (at most 64, wider fields are not copied)
+    /// @return   size_t: number of bits copied
+    template <typename T_array, typename T_val, typename std::enable_if<detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t lsb_first_bitcpy(T_array *const dest, const T_val source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        if (bits == 0u || bits > 64u)
+            return 0u;
+        detail::lsb_first_write(dest, detail::raw_field(source), bit_offset, bits);
+        return bits;
+    }
+
+    /// @brief [[serialize, size safe]] copies the specified number of bits from a value into a sized
+    /// array, LSB first (nothing is copied if the field doesn't fit)
+    template <typename T_array, typename T_val, typename std::enable_if<!std::is_void<T_array>::value && detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t lsb_first_bitcpy(sized_pointer<T_array> dest, const T_val source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        if (dest.bit_capacity() < (bits + bit_offset))
+            return 0u;
+        return lsb_first_bitcpy(dest.value, source, bit_offset, bits);
+    }
+
+    /// @brief [[serialize, size safe, type punned (void) dest array]] copies the specified number of bits
+    /// from a value into a sized array with a runtime determined base type, LSB first
+    template <typename T_val, typename std::enable_if<detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t lsb_first_bitcpy(sized_pointer<void> &dest, const T_val source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        if (dest.bit_capacity() < (bits + bit_offset))
+            return 0u;
+        switch (dest.element_size)
+        {
+        case 1:
+            return lsb_first_bitcpy(reinterpret_cast<uint8_t *>(dest.value), source, bit_offset, bits);
+        case 2:
+            return lsb_first_bitcpy(reinterpret_cast<uint16_t *>(dest.value), source, bit_offset, bits);
+        case 4:
+            return lsb_first_bitcpy(reinterpret_cast<uint32_t *>(dest.value), source, bit_offset, bits);
+        case 8:
+            return lsb_first_bitcpy(reinterpret_cast<uint64_t *>(dest.value), source, bit_offset, bits);
+        default:
+            break;
+        }
+        return 0u;
+    }
+
+    /// @brief [[deserialize]] copies the specified number of bits from an array into a value, numbering the
+    /// array's bits from the least significant bit of each element (see the file description)
+    ///
+    /// @tparam   T_val: destination value type (integral, floating point, or enum of up to 64 bits)
+    /// @tparam   T_array: source serial array base type
+    /// @param    dest: destination value reference
+    /// @param    source: pointer to the start of the source serial array
+    /// @param    bit_offset: starting bit of the source array to start copying from
+    /// @param    bits: number of bits to copy (at most 64, wider fields are not copied)
+    /// @return   size_t: number of bits copied
+    template <typename T_val, typename T_array, typename std::enable_if<detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t lsb_first_bitcpy(T_val &dest, const T_array *const source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        if (bits == 0u || bits > 64u)
+            return 0u;
+        detail::assign_field(dest, detail::lsb_first_read(source, bit_offset, bits), bits);
+        return bits;
+    }
+
+    /// @brief [[deserialize, size safe]] copies the specified number of bits from a sized array into a
+    /// value, LSB first (nothing is copied if the field doesn't fit)
+    template <typename T_val, typename T_array, typename std::enable_if<!std::is_void<T_array>::value && detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t lsb_first_bitcpy(T_val &dest, const sized_pointer<T_array> source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        if (bits == 0u || bits > 64u || source.bit_capacity() < (bits + bit_offset))
+            return 0u;
+        detail::assign_field(dest, detail::lsb_first_read(&source.value[0], source.size, bit_offset, bits), bits);
+        return bits;
+    }
+
+    /// @brief [[deserialize, size safe, type punned (void) source array]] copies the specified number of bits
+    /// from a sized array with a runtime determined base type into a value, LSB first
+    template <typename T_val, typename std::enable_if<detail::supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+    inline size_t lsb_first_bitcpy(T_val &dest, const sized_pointer<void> &source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    {
+        switch (source.element_size)
+        {
+        case 1:
+            return lsb_first_bitcpy(dest, sized_pointer<const uint8_t>(reinterpret_cast<const uint8_t *>(source.value), source.size), bit_offset, bits);
+        case 2:
+            return lsb_first_bitcpy(dest, sized_pointer<const uint16_t>(reinterpret_cast<const uint16_t *>(source.value), source.size), bit_offset, bits);
+        case 4:
+            return lsb_first_bitcpy(dest, sized_pointer<const uint32_t>(reinterpret_cast<const uint32_t *>(source.value), source.size), bit_offset, bits);
+        case 8:
+            return lsb_first_bitcpy(dest, sized_pointer<const uint64_t>(reinterpret_cast<const uint64_t *>(source.value), source.size), bit_offset, bits);
+        default:
+            break;
+        }
+        return 0u;
+    }
+}
+
+#endif // _BITCPY_LSB_FIRST_H_
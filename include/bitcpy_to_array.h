@@ -235,6 +235,26 @@ namespace serdes
         return bitcpy(dest, source_array, bit_offset, bits);
     }
 
+    // implementation details
+    namespace detail
+    {
+        /// @brief returns the raw (zero extended) bits of an integral value
+        template <typename T_val, typename std::enable_if<std::is_integral<T_val>::value && !std::is_signed<T_val>::value>::type * = nullptr>
+        inline uint64_t raw_field(const T_val source) noexcept
+        {
+            return static_cast<uint64_t>(source);
+        }
+
+        /// @brief returns the raw (zero extended) bits of a signed, floating point, or enum value
+        template <typename T_val, typename std::enable_if<!(std::is_integral<T_val>::value && !std::is_signed<T_val>::value)>::type * = nullptr>
+        inline uint64_t raw_field(const T_val source) noexcept
+        {
+            typename unsigned_type_sizeof<sizeof(T_val)>::type source_copy;
+            std::memcpy(&source_copy, &source, sizeof(T_val));
+            return static_cast<uint64_t>(source_copy);
+        }
+    }
+
     /// @brief [[serialize, size safe]] copies the specified number of bits from a value into an sized array
     ///
     /// @tparam   T_array: destination serial array base type
@@ -271,7 +291,7 @@ namespace serdes
     }
 
     /// @brief [[serialize, size safe, type punned (void) dest array]] copies the specified number of bits from a
-    /// value into an sized array
+    /// value into an sized array (always inlined, like the type punned source array bitcpy)
     ///
     /// @tparam   T_array: destination serial array base type
     /// @tparam   T_val: source value type
@@ -281,7 +301,7 @@ namespace serdes
     /// @param    bits: number of bits to copy from
     /// @return   size_t: number of bits copied
     template <typename T_val>
-    CONSTEXPR_ABOVE_CPP11 size_t bitcpy(sized_pointer<void> &dest, const T_val &source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
+    __attribute__((always_inline)) inline CONSTEXPR_ABOVE_CPP11 size_t bitcpy(sized_pointer<void> &dest, const T_val &source, const size_t bit_offset = 0, const size_t bits = detail::default_bitsize<T_val>::value) noexcept
     {
         if (dest.bit_capacity() < (bits + bit_offset))
             return 0;
@@ -300,6 +320,136 @@ namespace serdes
         }
         return 0;
     }
+
+    //
+    // compile time field position section: bitcpy<BitOffset, Bits>(dest, source)
+    //
+
+    // implementation details
+    namespace detail
+    {
+        /// @brief shifts a right aligned field ending at array bit "FieldEnd" so that its bits line up with a
+        /// serial array element that ends at array bit "ElementEnd"
+        template <size_t FieldEnd, size_t ElementEnd, bool ElementEndsAfterField = (ElementEnd >= FieldEnd)>
+        struct static_field_unshift
+        {
+            static constexpr uint64_t apply(const uint64_t field) noexcept { return field << (ElementEnd - FieldEnd); }
+        };
+        template <size_t FieldEnd, size_t ElementEnd>
+        struct static_field_unshift<FieldEnd, ElementEnd, false>
+        {
+            static constexpr uint64_t apply(const uint64_t field) noexcept { return field >> (FieldEnd - ElementEnd); }
+        };
+
+        /// @brief scatters a right aligned field covering array bits [FieldStart, FieldEnd) into the "Count" serial
+        /// array elements starting at "element" (which ends at array bit "ElementEnd"), unrolled at compile time.
+        /// Bits outside of the field are preserved, elements fully covered by the field are simply overwritten.
+        template <typename T_array, size_t FieldStart, size_t FieldEnd, size_t ElementEnd, size_t Count>
+        struct static_field_scatter
+        {
+            static CONSTEXPR_ABOVE_CPP11 void apply(T_array *const element, const uint64_t field) noexcept
+            {
+                constexpr size_t bits_per_T_array = sizeof(T_array) * 8u;
+                constexpr size_t overlap_start = (ElementEnd - bits_per_T_array) > FieldStart ? (ElementEnd - bits_per_T_array) : FieldStart;
+                constexpr size_t overlap_end = ElementEnd < FieldEnd ? ElementEnd : FieldEnd;
+                constexpr T_array mask = static_cast<T_array>(bitmask<T_array>(overlap_end - overlap_start) << (ElementEnd - overlap_end));
+                element[0] = static_cast<T_array>((element[0] & static_cast<T_array>(~mask)) |
+                                                  (static_cast<T_array>(static_field_unshift<FieldEnd, ElementEnd>::apply(field)) & mask));
+                static_field_scatter<T_array, FieldStart, FieldEnd, ElementEnd + bits_per_T_array, Count - 1u>::apply(element + 1, field);
+            }
+        };
+        template <typename T_array, size_t FieldStart, size_t FieldEnd, size_t ElementEnd>
+        struct static_field_scatter<T_array, FieldStart, FieldEnd, ElementEnd, 0u>
+        {
+            static CONSTEXPR_ABOVE_CPP11 void apply(T_array *const, const uint64_t) noexcept {}
+        };
+
+        /// @brief writes a right aligned value into the field [BitOffset, BitOffset + Bits) of a serial array
+        template <size_t BitOffset, size_t Bits, typename T_array>
+        CONSTEXPR_ABOVE_CPP11 void static_field_write(T_array *const dest, const uint64_t field) noexcept
+        {
+            static_assert(std::is_integral<T_array>::value && !std::is_signed<T_array>::value && sizeof(T_array) <= 8u,
+                          "compile time bitcpy supports unsigned serial arrays of up to 64 bit elements");
+            static_assert(Bits > 0u && Bits <= 64u, "compile time bitcpy supports fields of 1 to 64 bits");
+            constexpr size_t bits_per_T_array = sizeof(T_array) * 8u;
+            constexpr size_t first_index = BitOffset / bits_per_T_array;
+            static_field_scatter<T_array,
+                                 BitOffset,
+                                 BitOffset + Bits,
+                                 (first_index + 1u) * bits_per_T_array,
+                                 (BitOffset + Bits - 1u) / bits_per_T_array - first_index + 1u>::apply(&dest[first_index], field);
+        }
+    }
+
+    /// @brief [[serialize, uint source, compile time position]] copies a value into the field at a bit
+    /// position known at compile time in an array, using straight-line shift/mask code
+    ///
+    /// @tparam   BitOffset: starting bit of the destination array to start copying to
+    /// @tparam   Bits: number of bits to copy (1 to 64)
+    /// @tparam   T_array: destination serial array base type
+    /// @tparam   T_val: source value type
+    /// @param    dest: pointer to the start of the destination serial array
+    /// @param    source: source value
+    /// @return   size_t: number of bits copied
+    template <size_t BitOffset, size_t Bits, typename T_array, typename T_val, detail::requires_unsigned_type<T_val> * = nullptr>
+    CONSTEXPR_ABOVE_CPP11 size_t bitcpy(T_array *const dest, const T_val source) noexcept
+    {
+        detail::static_field_write<BitOffset, Bits>(dest, static_cast<uint64_t>(source));
+        return Bits;
+    }
+
+    /// @brief [[serialize, bool source, compile time position]] copies a boolean into the field at a bit
+    /// position known at compile time in an array
+    ///
+    /// @tparam   BitOffset: starting bit of the destination array to start copying to
+    /// @tparam   Bits: number of bits to copy (1 to 64)
+    /// @tparam   T_array: destination serial array base type
+    /// @tparam   T_val: source value type, a boolean for this case.
+    /// @param    dest: pointer to the start of the destination serial array
+    /// @param    source: source value
+    /// @return   size_t: number of bits copied
+    template <size_t BitOffset, size_t Bits, typename T_array, typename T_val, detail::requires_bool_type<T_val> * = nullptr>
+    CONSTEXPR_ABOVE_CPP11 size_t bitcpy(T_array *const dest, const T_val source) noexcept
+    {
+        detail::static_field_write<BitOffset, Bits>(dest, static_cast<uint64_t>(source));
+        return Bits;
+    }
+
+    /// @brief [[serialize, signed source, compile time position]] copies a signed value into the field at a
+    /// bit position known at compile time in an array
+    ///
+    /// @tparam   BitOffset: starting bit of the destination array to start copying to
+    /// @tparam   Bits: number of bits to copy (1 to 64)
+    /// @tparam   T_array: destination serial array base type
+    /// @tparam   T_val: source value type
+    /// @param    dest: pointer to the start of the destination serial array
+    /// @param    source: source value
+    /// @return   size_t: number of bits copied
+    template <size_t BitOffset, size_t Bits, typename T_array, typename T_val, detail::requires_signed_type<T_val> * = nullptr>
+    CONSTEXPR_ABOVE_CPP11 size_t bitcpy(T_array *const dest, const T_val source) noexcept
+    {
+        detail::static_field_write<BitOffset, Bits>(dest, static_cast<uint64_t>(static_cast<typename detail::unsigned_type_sizeof<sizeof(T_val)>::type>(source)));
+        return Bits;
+    }
+
+    /// @brief [[serialize, integral value <= 8 bytes source, compile time position]] copies a floating point or
+    /// enum value into the field at a bit position known at compile time in an array
+    ///
+    /// @tparam   BitOffset: starting bit of the destination array to start copying to
+    /// @tparam   Bits: number of bits to copy (1 to 64)
+    /// @tparam   T_array: destination serial array base type
+    /// @tparam   T_val: source value type
+    /// @param    dest: pointer to the start of the destination serial array
+    /// @param    source: source value
+    /// @return   size_t: number of bits copied
+    template <size_t BitOffset, size_t Bits, typename T_array, typename T_val, detail::requires_small_non_integral_type<T_val> * = nullptr>
+    size_t bitcpy(T_array *const dest, const T_val source) noexcept
+    {
+        typename detail::unsigned_type_sizeof<sizeof(T_val)>::type source_copy;
+        std::memcpy(&source_copy, &source, sizeof(T_val));
+        detail::static_field_write<BitOffset, Bits>(dest, static_cast<uint64_t>(source_copy));
+        return Bits;
+    }
 }
 
 #endif // _BITCPY_TO_ARRAY_H_
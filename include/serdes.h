@@ -9,6 +9,7 @@
 #define _SERDES_H_
 
 #include <cstring>
+#include <array>
 #include "bitcpy.h"
 #include "bitliterals.h"
 #include "serdes_errors.h"
@@ -24,6 +25,11 @@
 #include "cppcrc.h"
 #endif
 
+// define configCPP_SERDES_ENABLE_FORMAT_RECORDING (before every include of serdes.h) to add the hooks that let a
+// packet backend record formats, which serdes_compiled_format.h requires. They add a recording flag to the packet,
+// and a check of it to the packet backend paths, aligns, and data dependent constructs (arrays with a size,
+// validators, formatters, and custom types). Without it they're compiled out.
+
 // if inlining is increasing your binary size too much, you can disable them using configCPP_SERDES_LIB_INLINE_PACKET_API_AGGRESSION=0
 //
 // level 0 disables all unnecessary inline statements (functions that aren't templatized still need inline)
@@ -49,6 +55,208 @@
 /// @brief CppSerdes library namespace
 namespace serdes
 {
+    // implementation details
+    namespace detail
+    {
+        /// @brief [[deserialize]] bitcpy in the requested bit and byte order (always inlined, so the default layout
+        /// isn't behind a call on the packet's default path)
+        template <typename T_val, typename T_source, typename std::enable_if<supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+        __attribute__((always_inline)) inline size_t ordered_load(const bit_order_e bit_order, const endian_e endian, T_val &dest, const T_source &source, const size_t bit_offset, const size_t bits) noexcept
+        {
+            if (bit_order == bit_order_e::LSB_FIRST)
+                return lsb_first_bitcpy(dest, source, bit_offset, bits);
+            return endian == endian_e::BIG ? bitcpy(dest, source, bit_offset, bits) : little_endian_bitcpy(dest, source, bit_offset, bits);
+        }
+        /// @brief [[deserialize]] values wider than 64 bits only have the default layout, and are always copied as is
+        template <typename T_val, typename T_source, typename std::enable_if<!supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+        inline size_t ordered_load(const bit_order_e, const endian_e, T_val &dest, const T_source &source, const size_t bit_offset, const size_t bits) noexcept
+        {
+            return bitcpy(dest, source, bit_offset, bits);
+        }
+
+        /// @brief [[serialize]] bitcpy in the requested bit and byte order (always inlined, so the default layout
+        /// isn't behind a call on the packet's default path)
+        template <typename T_dest, typename T_val, typename std::enable_if<supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+        __attribute__((always_inline)) inline size_t ordered_store(const bit_order_e bit_order, const endian_e endian, T_dest &&dest, const T_val &source, const size_t bit_offset, const size_t bits) noexcept
+        {
+            if (bit_order == bit_order_e::LSB_FIRST)
+                return lsb_first_bitcpy(dest, source, bit_offset, bits);
+            return endian == endian_e::BIG ? bitcpy(dest, source, bit_offset, bits) : little_endian_bitcpy(dest, source, bit_offset, bits);
+        }
+        /// @brief [[serialize]] values wider than 64 bits only have the default layout, and are always copied as is
+        template <typename T_dest, typename T_val, typename std::enable_if<!supported_by_wide_bitcpy<T_val>::value, int *>::type = nullptr>
+        inline size_t ordered_store(const bit_order_e, const endian_e, T_dest &&dest, const T_val &source, const size_t bit_offset, const size_t bits) noexcept
+        {
+            return bitcpy(dest, source, bit_offset, bits);
+        }
+
+        /// @brief a field_group can be fused into a single word when all of its fields are integers, bools, or
+        /// enums of their default bit length, totaling 64 bits or less (loading also requires non-const lvalues)
+        template <typename... T>
+        struct fusable_group
+        {
+            static constexpr size_t bits = 0u;
+            static constexpr bool storable = true;
+            static constexpr bool loadable = true;
+        };
+        template <typename T, typename... Rest>
+        struct fusable_group<T, Rest...>
+        {
+            using field_type = typename remove_cvref_cpp11<T>::type;
+            static constexpr size_t bits = default_bitsize<field_type>::value + fusable_group<Rest...>::bits;
+            static constexpr bool storable = (std::is_integral<field_type>::value || std::is_enum<field_type>::value) &&
+                                             bits <= 64u && fusable_group<Rest...>::storable;
+            static constexpr bool loadable = storable && std::is_lvalue_reference<T>::value &&
+                                             !std::is_const<typename std::remove_reference<T>::type>::value && fusable_group<Rest...>::loadable;
+        };
+
+        /// @brief the bits of a fused field, as stored by bitcpy
+        template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int *>::type = nullptr>
+        constexpr uint64_t fused_field_bits(const T value) noexcept
+        {
+            return static_cast<uint64_t>(static_cast<typename std::make_unsigned<T>::type>(value));
+        }
+        template <typename T, typename std::enable_if<std::is_enum<T>::value, int *>::type = nullptr>
+        constexpr uint64_t fused_field_bits(const T value) noexcept
+        {
+            return fused_field_bits(static_cast<typename std::underlying_type<T>::type>(value));
+        }
+        constexpr uint64_t fused_field_bits(const bool value) noexcept
+        {
+            return value ? 1u : 0u;
+        }
+
+        /// @brief the field loaded from the low bits of a fused word, as loaded by bitcpy
+        template <typename T, typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value, int *>::type = nullptr>
+        inline void load_fused_field(T &value, const uint64_t bits) noexcept
+        {
+            value = static_cast<T>(static_cast<typename std::make_unsigned<T>::type>(bits));
+        }
+        template <typename T, typename std::enable_if<std::is_enum<T>::value, int *>::type = nullptr>
+        inline void load_fused_field(T &value, const uint64_t bits) noexcept
+        {
+            typename std::underlying_type<T>::type underlying = 0;
+            load_fused_field(underlying, bits);
+            value = static_cast<T>(underlying);
+        }
+        inline void load_fused_field(bool &value, const uint64_t bits) noexcept
+        {
+            value = (bits & 1u) != 0u;
+        }
+
+        /// @brief assembles the fields of a group into the low bits of one word, first field most significant
+        inline uint64_t fuse_fields(const field_group<> &, const uint64_t word) noexcept
+        {
+            return word;
+        }
+        template <typename T, typename... Rest>
+        inline uint64_t fuse_fields(const field_group<T, Rest...> &fields, const uint64_t word) noexcept
+        {
+            using field_type = typename remove_cvref_cpp11<T>::type;
+            return fuse_fields(fields.rest, shift_left_64(word, default_bitsize<field_type>::value) | fused_field_bits(fields.value));
+        }
+
+        /// @brief splits one word (as assembled by fuse_fields) back into the fields of a group
+        inline void unfuse_fields(field_group<> &, const uint64_t) noexcept {}
+        template <typename T, typename... Rest>
+        inline void unfuse_fields(field_group<T, Rest...> &fields, const uint64_t word) noexcept
+        {
+            constexpr size_t shift = fusable_group<Rest...>::bits;
+            load_fused_field(fields.value, shift >= 64u ? 0u : (word >> shift));
+            unfuse_fields(fields.rest, word);
+        }
+    }
+
+#if !defined(configCPP_SERDES_LIB_EXCLUDE_CPP_CRC) && BITCPY_CONSTEXPR_SUPPORTED
+    // implementation details
+    namespace detail
+    {
+        /// @brief continues a CRC calculation, with the runtime dispatched kernel when there is one for the
+        /// algorithm (currently CRC-32C, with configCPP_SERDES_ENABLE_CPU_DISPATCH defined, see bitcpy_cpu_dispatch.h)
+        template <typename cpp_crc_type>
+        inline typename cpp_crc_type::type dispatched_crc(const uint8_t *const bytes, const size_t num_bytes, const typename cpp_crc_type::type prior_crc_value)
+        {
+            return cpp_crc_type::calc(bytes, num_bytes, prior_crc_value);
+        }
+#ifdef configCPP_SERDES_ENABLE_CPU_DISPATCH
+        template <>
+        inline uint32_t dispatched_crc<CRC32::C>(const uint8_t *const bytes, const size_t num_bytes, const uint32_t prior_crc_value)
+        {
+            return cpu_dispatch::crc32c(bytes, num_bytes, prior_crc_value);
+        }
+#endif
+    }
+#endif
+
+    // implementation details
+    namespace detail
+    {
+        /// @brief serial bytes outside of a packet's buffer, handed out by a packet backend (see packet::outside_buffer)
+        struct serial_window
+        {
+            uint8_t *bytes; ///< the serial bytes from the requested byte on, nullptr if they're only counted (see sizing_packet)
+            size_t size;    ///< number of bytes in the window, 0 if the requested bytes aren't available
+        };
+
+        /// @brief the segments holding the serial bytes outside of a packet's buffer, for byte iterators (see
+        /// packet::outside_segments)
+        struct serial_segments
+        {
+            const buffer_segment *list; ///< the segments, nullptr if the bytes are only counted (see sizing_packet)
+            size_t first_byte;          ///< serial byte offset of the first segment
+            size_t end_byte;            ///< the serial byte after the last one that can be accessed
+        };
+
+        /// @brief serial bytes a packet backend holds in place, which fields are copied to/from without asking the
+        /// backend for them (see packet::outside_span)
+        struct serial_span
+        {
+            uint8_t *bytes;    ///< the serial bytes from first_byte on, nullptr if they're only counted (see sizing_packet)
+            size_t first_byte; ///< serial byte offset of the first byte in the span
+            size_t end_byte;   ///< the serial byte after the last one in the span
+        };
+
+#ifdef configCPP_SERDES_ENABLE_FORMAT_RECORDING
+        /// @brief the kinds of format steps a recording packet backend is told about (see packet::record_step)
+        enum class format_step_e : uint8_t
+        {
+            FIELD,         ///< a field (or the rest of an array) copied to/from the serial bytes
+            ALIGN,         ///< an alignment, even one that didn't move the bit offset
+            DATA_DEPENDENT ///< a construct whose layout or result depends on the values (arrays with a referenced size,
+                           ///< delimited arrays, validators, formatters, and custom types)
+        };
+
+        /// @brief how a field's serial bits are loaded into it
+        enum class field_kind_e : uint8_t
+        {
+            UNSIGNED, ///< zero extended (unsigned integers, enums, and floating point values)
+            SIGNED,   ///< sign extended (signed integers)
+            BOOL      ///< true if any of the bits are set
+        };
+
+        /// @brief a format step, as seen by a recording packet backend (see packet::record_step)
+        struct format_step
+        {
+            format_step_e type;  ///< the kind of step
+            const void *field;   ///< the first field element (FIELD only)
+            size_t element_size; ///< size of each field element in bytes (FIELD only)
+            size_t count;        ///< number of field elements (FIELD only)
+            size_t bits;         ///< bits per field element, or the alignment in bits
+            field_kind_e kind;   ///< how the field elements are loaded (FIELD only)
+
+            /// @brief the step of "count" fields of type T, "bits" bits each
+            template <typename T>
+            static format_step field_of(const T *const first, const size_t count, const size_t bits) noexcept
+            {
+                return {format_step_e::FIELD, first, sizeof(T), count, bits,
+                        std::is_same<T, bool>::value ? field_kind_e::BOOL
+                        : (std::is_integral<T>::value && std::is_signed<T>::value) ? field_kind_e::SIGNED
+                                                                                   : field_kind_e::UNSIGNED};
+            }
+        };
+#endif
+    }
+
     /// @brief a serialization/deserialization helper class, with load, store, and stream operators
     struct packet
     {
@@ -57,6 +265,12 @@ namespace serdes
         mode_e mode;                          ///< the serdes mode (LOADING, STORING, or UNSPECIFIED)
         status_e status = status_e::NO_ERROR; ///< the current error status of the serdes process
         const size_t bit_capacity;            ///< buffer.bit_capacity() value
+        endian_e endian = endian_e::BIG;      ///< default byte order of multi-byte fields (see serdes::little_endian)
+        bit_order_e bit_order = bit_order_e::MSB_FIRST; ///< bit numbering, LSB_FIRST implies little endian fields, except serdes::big_endian ones (see lsb_first_bitcpy)
+
+        virtual ~packet() = default;
+        packet(const packet &) = default;
+        packet &operator=(const packet &) = default;
 
         /// @brief resets the bit offset to 0 and the status to NO_ERROR
         inline void reset() noexcept
@@ -65,6 +279,13 @@ namespace serdes
             bit_offset = 0;
         }
 
+        /// @brief the number of serial bits the packet can hold: its buffer's, or the serial data's of a packet
+        /// backend without a buffer (see outside_buffer)
+        inline size_t serial_bit_capacity() const noexcept
+        {
+            return bit_capacity != 0u ? bit_capacity : outside_bit_capacity();
+        }
+
         /// @brief Construct a new packet object from an c style array pointer
         /// @tparam   T_pointer: the array's base pointer type
         /// @param    array_init: an array pointer (without size)
@@ -187,10 +408,10 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_load();
-            const size_t bits_touched = bitcpy(value, buffer, bit_offset, bits);
+            const size_t bits_touched = detail::ordered_load(bit_order, endian, value, buffer, bit_offset, bits);
             bit_offset += bits_touched;
             if (bits_touched < bits)
-                status = status_e::EXCEEDED_SERIAL_SIZE;
+                load_outside_buffer(value, bits);
         }
 
         /// @brief [[deserialize]] loads from serial buffer into a "custom_type" overriden type,
@@ -218,6 +439,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_load();
+            record_data_dependent();
             custom_type<typename detail::remove_cvref_cpp11<T>::type>::format(*this, std::forward<T>(value), bits);
         }
 
@@ -245,6 +467,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_load();
+            record_data_dependent();
             custom_type<typename detail::remove_cvref_cpp11<T>::type>::format(*this, std::forward<T>(value));
         }
 
@@ -305,6 +528,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_load();
+            record_data_dependent();
             if (value.formatter_lambda == nullptr)
             {
                 status = status_e::FORMATTER_NOT_SET;
@@ -323,26 +547,19 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_load();
+            record_data_dependent();
             using elem_type = typename delimited_array<T>::elem_type;
             constexpr size_t bits_per_element = sizeof(elem_type) * 8;
 
-            // shortcut for memory aligned situations
-            if (bits == bits_per_element && buffer.element_size == sizeof(elem_type) && bit_offset % bits_per_element == 0)
+            size_t i = 0;
+            // shortcut for memory aligned situations (elements are copied as is, so only in the default field order)
+            if (bits == bits_per_element && buffer.element_size == sizeof(elem_type) && bit_offset % bits_per_element == 0 &&
+                endian == endian_e::BIG && bit_order == bit_order_e::MSB_FIRST && bit_capacity >= bits_per_element)
             {
-                if (bit_capacity < bits_per_element)
-                {
-                    status = status_e::EXCEEDED_SERIAL_SIZE;
-                    return;
-                }
                 const size_t max_bit_offset_minus_one_element = bit_capacity - bits_per_element;
                 const elem_type *buffer_head = &reinterpret_cast<const elem_type *>(buffer.value)[bit_offset / bits_per_element];
-                for (size_t i = 0; i < value.max_size; i++)
+                for (; i < value.max_size && bit_offset <= max_bit_offset_minus_one_element; i++)
                 {
-                    if (bit_offset > max_bit_offset_minus_one_element)
-                    {
-                        status = status_e::EXCEEDED_SERIAL_SIZE;
-                        return;
-                    }
                     const elem_type &source_value = *buffer_head;
                     value.value[i] = source_value;
                     bit_offset += bits;
@@ -351,20 +568,15 @@ namespace serdes
                     ++buffer_head;
                 }
             }
-            else
+            // the other elements (all of them without the shortcut, or the ones past the end of the buffer)
+            for (; i < value.max_size; i++)
             {
-                for (size_t i = 0; i < value.max_size; i++)
-                {
-                    const size_t bits_touched = bitcpy(value.value[i], buffer, bit_offset, bits);
-                    bit_offset += bits_touched;
-                    if (bits_touched < bits)
-                    {
-                        status = status_e::EXCEEDED_SERIAL_SIZE;
-                        return;
-                    }
-                    if (value.value[i] == value.delimiter)
-                        return;
-                }
+                const size_t bits_touched = ordered_load(value.value[i], bits);
+                bit_offset += bits_touched;
+                if (bits_touched < bits && !load_outside_buffer(value.value[i], bits))
+                    return;
+                if (value.value[i] == value.delimiter)
+                    return;
             }
             status = status_e::DELIMITER_NOT_FOUND;
         }
@@ -379,6 +591,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_load();
+            record_data_dependent();
             for (size_t i = 0; i < value.max_size; i++)
             {
                 value.value[i].format(*this);
@@ -411,6 +624,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_load();
+            record_array_size(value);
 
             // here the "size" reference is finally copied, in case it changed after the reference bind occurred
             size_t array_size = static_cast<size_t>(value.size);
@@ -421,21 +635,21 @@ namespace serdes
             }
             const size_t total_bits = array_size * sizeof(typename serdes::array<T, T2>::elem_type) * 8;
             // shortcut for memory aligned situations
-            if (sizeof(typename serdes::array<T, T2>::elem_type) == 1 && bits == 8 && buffer.element_size == 1 && (bit_offset & 7u) == 0u && bit_capacity - bit_offset >= total_bits)
+            if (sizeof(typename serdes::array<T, T2>::elem_type) == 1 && bits == 8 && buffer.element_size == 1 && (bit_offset & 7u) == 0u && bit_offset <= bit_capacity && bit_capacity - bit_offset >= total_bits)
             {
                 std::memcpy(&value.value[0], &reinterpret_cast<uint8_t *>(buffer.value)[bit_offset >> 3], array_size);
                 bit_offset += total_bits;
                 return;
             }
+            // shortcut for bitpacked arrays that are known to fit, unpacked in a single pass
+            if (bulk_load(&value.value[0], array_size, bits))
+                return;
             for (size_t i = 0; i < array_size; i++)
             {
-                const size_t bits_touched = bitcpy(value.value[i], buffer, bit_offset, bits);
+                const size_t bits_touched = ordered_load(value.value[i], bits);
                 bit_offset += bits_touched;
                 if (bits_touched < bits)
-                {
-                    status = status_e::EXCEEDED_SERIAL_SIZE;
-                    return;
-                }
+                    return load_array_outside_buffer(&value.value[i], array_size - i, bits);
             }
         }
 
@@ -453,6 +667,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_load();
+            record_array_size(value);
 
             // here the "size" reference is finally copied, in case it changed after the reference bind occurred
             size_t array_size = static_cast<size_t>(value.size);
@@ -475,6 +690,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_load();
+            record_array_size(value);
 
             // here the "size" reference is finally copied, in case it changed after the reference bind occurred
             size_t array_size = static_cast<size_t>(value.size);
@@ -545,6 +761,37 @@ namespace serdes
             load(value.value, value.bits);
         }
 
+        /// @brief [[deserialize]] loads a field using a specific byte order (see serdes::little_endian)
+        /// @tparam   T: the field type
+        /// @param    field: the field and its byte order
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void load(byte_order<T> field)
+        {
+            const endian_e default_endian = endian;
+            const bit_order_e default_bit_order = bit_order;
+            endian = field.endian;
+            // a big endian field is MSB first even in an LSB first packet (see serdes::big_endian)
+            if (field.endian == endian_e::BIG)
+                bit_order = bit_order_e::MSB_FIRST;
+            // plain rvalues are still rejected, while wrappers (such as bitpack) are loaded through
+            load(static_cast<typename std::conditional<detail::supported_by_bitcpy<T>::value, T &&, T &>::type>(field.value));
+            endian = default_endian;
+            bit_order = default_bit_order;
+        }
+
+        /// @brief [[deserialize]] loads a group of fields (see serdes::group), with a single bitcpy when the
+        /// group can be fused into one word
+        /// @tparam   T: the field types
+        /// @param    fields: the grouped fields
+        template <typename... T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void load(field_group<T...> fields)
+        {
+            if (status != status_e::NO_ERROR)
+                return;
+            ensure_load();
+            load_group(fields, std::integral_constant<bool, detail::fusable_group<T...>::loadable>());
+        }
+
         /// @brief [[deserialize]] loads from serial buffer into a packet_base reference
         /// @param    value: referenced packet_base reference
         inline void load(packet_base &value)
@@ -579,10 +826,10 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_store();
-            const size_t bits_touched = bitcpy(buffer, value, bit_offset, bits);
+            const size_t bits_touched = detail::ordered_store(bit_order, endian, buffer, value, bit_offset, bits);
             bit_offset += bits_touched;
             if (bits_touched < bits)
-                status = status_e::EXCEEDED_SERIAL_SIZE;
+                store_outside_buffer(value, bits);
         }
 
         /// @brief [[serialize]] stores a "custom_type" overriden type into a serial buffer,
@@ -611,6 +858,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_store();
+            record_data_dependent();
             custom_type<typename detail::remove_cvref_cpp11<T>::type>::format(*this, std::forward<T>(value), bits);
         }
 
@@ -638,6 +886,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_store();
+            record_data_dependent();
             custom_type<typename detail::remove_cvref_cpp11<T>::type>::format(*this, std::forward<T>(value));
         }
 
@@ -717,25 +966,18 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_store();
+            record_data_dependent();
             using elem_type = typename detail::remove_cvref_cpp11<typename delimited_array<T>::elem_type>::type;
             constexpr size_t bits_per_element = sizeof(elem_type) * 8;
-            // shortcut for memory aligned situations
-            if (bits == bits_per_element && buffer.element_size == sizeof(elem_type) && bit_offset % bits_per_element == 0)
+            size_t i = 0;
+            // shortcut for memory aligned situations (elements are copied as is, so only in the default field order)
+            if (bits == bits_per_element && buffer.element_size == sizeof(elem_type) && bit_offset % bits_per_element == 0 &&
+                endian == endian_e::BIG && bit_order == bit_order_e::MSB_FIRST && bit_capacity >= bits_per_element)
             {
-                if (bit_capacity < bits_per_element)
-                {
-                    status = status_e::EXCEEDED_SERIAL_SIZE;
-                    return;
-                }
                 const size_t max_bit_offset_minus_one_element = bit_capacity - bits_per_element;
                 elem_type *buffer_head = &reinterpret_cast<elem_type *>(buffer.value)[bit_offset / bits_per_element];
-                for (size_t i = 0; i < value.max_size; i++)
+                for (; i < value.max_size && bit_offset <= max_bit_offset_minus_one_element; i++)
                 {
-                    if (bit_offset > max_bit_offset_minus_one_element)
-                    {
-                        status = status_e::EXCEEDED_SERIAL_SIZE;
-                        return;
-                    }
                     const elem_type &source_value = value.value[i];
                     *buffer_head = source_value;
                     bit_offset += bits;
@@ -744,20 +986,15 @@ namespace serdes
                     ++buffer_head;
                 }
             }
-            else
+            // the other elements (all of them without the shortcut, or the ones past the end of the buffer)
+            for (; i < value.max_size; i++)
             {
-                for (size_t i = 0; i < value.max_size; i++)
-                {
-                    const size_t bits_touched = bitcpy(buffer, value.value[i], bit_offset, bits);
-                    bit_offset += bits_touched;
-                    if (bits_touched < bits)
-                    {
-                        status = status_e::EXCEEDED_SERIAL_SIZE;
-                        return;
-                    }
-                    if (value.value[i] == value.delimiter)
-                        return;
-                }
+                const size_t bits_touched = ordered_store(value.value[i], bits);
+                bit_offset += bits_touched;
+                if (bits_touched < bits && !store_outside_buffer(value.value[i], bits))
+                    return;
+                if (value.value[i] == value.delimiter)
+                    return;
             }
             status = status_e::DELIMITER_NOT_FOUND;
         }
@@ -771,6 +1008,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_store();
+            record_data_dependent();
             for (size_t i = 0; i < value.max_size; i++)
             {
                 value.value[i].format(*this);
@@ -803,6 +1041,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_store();
+            record_array_size(value);
 
             // here the "size" reference is finally copied, in case it changed after the reference bind occurred
             size_t array_size = static_cast<size_t>(value.size);
@@ -813,21 +1052,21 @@ namespace serdes
             }
             const size_t total_bits = array_size * sizeof(typename serdes::array<T, T2>::elem_type) * 8;
             // shortcut for memory aligned situations
-            if (sizeof(typename serdes::array<T, T2>::elem_type) == 1 && bits == 8 && buffer.element_size == 1 && (bit_offset & 7u) == 0u && bit_capacity - bit_offset >= total_bits)
+            if (sizeof(typename serdes::array<T, T2>::elem_type) == 1 && bits == 8 && buffer.element_size == 1 && (bit_offset & 7u) == 0u && bit_offset <= bit_capacity && bit_capacity - bit_offset >= total_bits)
             {
                 std::memcpy(&reinterpret_cast<uint8_t *>(buffer.value)[bit_offset >> 3], &value.value[0], array_size);
                 bit_offset += total_bits;
                 return;
             }
+            // shortcut for bitpacked arrays that are known to fit, packed in a single pass
+            if (bulk_store(&value.value[0], array_size, bits))
+                return;
             for (size_t i = 0; i < array_size; i++)
             {
-                const size_t bits_touched = bitcpy(buffer, value.value[i], bit_offset, bits);
+                const size_t bits_touched = ordered_store(value.value[i], bits);
                 bit_offset += bits_touched;
                 if (bits_touched < bits)
-                {
-                    status = status_e::EXCEEDED_SERIAL_SIZE;
-                    return;
-                }
+                    return store_array_outside_buffer(&value.value[i], array_size - i, bits);
             }
         }
 
@@ -845,6 +1084,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_store();
+            record_array_size(value);
 
             // here the "size" reference is finally copied, in case it changed after the reference bind occurred
             size_t array_size = static_cast<size_t>(value.size);
@@ -867,6 +1107,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_store();
+            record_array_size(value);
 
             // here the "size" reference is finally copied, in case it changed after the reference bind occurred
             size_t array_size = static_cast<size_t>(value.size);
@@ -903,6 +1144,7 @@ namespace serdes
             if (status != status_e::NO_ERROR)
                 return;
             ensure_store();
+            record_data_dependent();
             if (value.formatter_lambda == nullptr)
             {
                 status = status_e::FORMATTER_NOT_SET;
@@ -955,6 +1197,36 @@ namespace serdes
             store(value.value, value.bits);
         }
 
+        /// @brief [[serialize]] stores a field using a specific byte order (see serdes::little_endian)
+        /// @tparam   T: the field type
+        /// @param    field: the field and its byte order
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void store(const byte_order<T> &field)
+        {
+            const endian_e default_endian = endian;
+            const bit_order_e default_bit_order = bit_order;
+            endian = field.endian;
+            // a big endian field is MSB first even in an LSB first packet (see serdes::big_endian)
+            if (field.endian == endian_e::BIG)
+                bit_order = bit_order_e::MSB_FIRST;
+            store(field.value);
+            endian = default_endian;
+            bit_order = default_bit_order;
+        }
+
+        /// @brief [[serialize]] stores a group of fields (see serdes::group), with a single bitcpy when the
+        /// group can be fused into one word
+        /// @tparam   T: the field types
+        /// @param    fields: the grouped fields
+        template <typename... T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void store(const field_group<T...> &fields)
+        {
+            if (status != status_e::NO_ERROR)
+                return;
+            ensure_store();
+            store_group(fields, std::integral_constant<bool, detail::fusable_group<T...>::storable>());
+        }
+
         /// @brief [[serialize]] stores a packet_base reference into a serial buffer
         /// @param    value: value to store
         inline void store(const packet_base &value)
@@ -972,6 +1244,19 @@ namespace serdes
             store(value);
         }
 
+        /// @brief [[serialize]] stores a const static_packet_base reference into a serial buffer (non-const objects
+        /// are stored through their format method directly)
+        /// @tparam   Derived: the type derived from static_packet_base
+        /// @param    value: value to store
+        template <typename Derived>
+        CPP_SERDES_LIB_PACKET_API_INLINE2 void store(const static_packet_base<Derived> &value)
+        {
+            if (status != status_e::NO_ERROR)
+                return;
+            ensure_store();
+            const_cast<Derived &>(static_cast<const Derived &>(value)).format(*this);
+        }
+
         //
         // stream operator SECTION (<< is store, >> is load)
         //
@@ -1019,7 +1304,7 @@ namespace serdes
         /// @tparam   T: value type
         /// @param    x: value
         /// @param    bits: number of bits to store/load the value into/out-of
-        template <typename T, size_t N>
+        template <typename T, size_t N, typename std::enable_if<!detail::supported_by_bitcpy<T>::value, int *>::type = nullptr>
         CPP_SERDES_LIB_PACKET_API_INLINE1 void add(T (&x)[N], size_t bits)
         {
             if (mode == mode_e::LOADING)
@@ -1047,7 +1332,7 @@ namespace serdes
         /// @brief adds an array field to the serial format for both serialization and deserialization
         /// @tparam   T: value type
         /// @param    x: value
-        template <typename T, size_t N>
+        template <typename T, size_t N, typename std::enable_if<!detail::supported_by_bitcpy<T>::value, int *>::type = nullptr>
         CPP_SERDES_LIB_PACKET_API_INLINE1 void add(T (&x)[N])
         {
             if (mode == mode_e::LOADING)
@@ -1058,6 +1343,20 @@ namespace serdes
                     store(x[i]);
         }
 
+        /// @brief adds an array of bitcpy compatible values to the serial format for both serialization and
+        /// deserialization (handled as a whole array, so that the bulk array copies can be used)
+        /// @tparam   T: value type
+        /// @param    x: value
+        /// @param    bits: number of bits to store/load each value element into/out-of
+        template <typename T, size_t N, typename std::enable_if<detail::supported_by_bitcpy<T>::value, int *>::type = nullptr>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void add(T (&x)[N], size_t bits = detail::default_bitsize<T>::value)
+        {
+            if (mode == mode_e::LOADING)
+                load(x, bits);
+            else if (mode == mode_e::STORING)
+                store(x, bits);
+        }
+
         /// @brief adds a referenced field to the serial format for both serialization and deserialization
         /// along with a validation process to run before serialization, and/or after deserialization
         /// @tparam   T: value type
@@ -1068,6 +1367,7 @@ namespace serdes
         {
             if (status != status_e::NO_ERROR)
                 return;
+            record_data_dependent();
             if (mode == mode_e::LOADING)
                 load(std::forward<T>(value));
             if (!std::forward<F>(validation)())
@@ -1127,14 +1427,10 @@ namespace serdes
         {
             if (status != status_e::NO_ERROR)
                 return {buffer, 0u, 0u};
-            const size_t max_num_bytes = buffer.size * buffer.element_size;
             const size_t end_byte_index_plus_one = start.value + size.value;
-            if (end_byte_index_plus_one >= max_num_bytes)
-            {
-                status = status_e::NUM_BYTES_OVER_MAX;
-                return {buffer, 0u, 0u};
-            }
-            return {buffer, start.value, end_byte_index_plus_one};
+            if (end_byte_index_plus_one < buffer.size * buffer.element_size)
+                return {buffer, start.value, end_byte_index_plus_one};
+            return outside_byte_iterator(start.value, end_byte_index_plus_one);
         }
 
         /// @brief Will return an iterator to the raw serial bytes in the packet
@@ -1182,94 +1478,1059 @@ namespace serdes
         {
             auto crc_calculated = cpp_crc_type::null_crc;
             for (auto &segment : previous_bytes())
-                crc_calculated = cpp_crc_type::calc(segment.bytes, segment.num_bytes, crc_calculated);
-            if (crc_field != nullptr && mode == serdes::mode_e::STORING)
+                crc_calculated = detail::dispatched_crc<cpp_crc_type>(segment.bytes, segment.num_bytes, crc_calculated);
+            if (crc_field != nullptr && mode == serdes::mode_e::STORING && holds_serial_data())
                 *crc_field = crc_calculated;
             return crc_calculated;
         }
 #endif
 
-    private:
-        /// @brief adds the specified pad bits, without any safety status checking
-        /// @param    bits
-        inline void pad_assuming_no_prior_errors(const size_t bits) noexcept
+    protected:
+        /// @brief the serial bytes a packet backend holds in place (like its current segment), which the fields that
+        /// didn't fit in the buffer are copied to/from directly when they're inside it. Only the fields outside of it
+        /// cost a virtual outside_buffer call, which can move the span. The span is a member of the backend (so a
+        /// packet only pays for the pointer), nullptr unless a backend sets it.
+        const detail::serial_span *outside_span = nullptr;
+
+#ifdef configCPP_SERDES_ENABLE_FORMAT_RECORDING
+        /// @brief set by a packet backend that records formats, to be told about every step (see record_step)
+        bool recording = false;
+
+        /// @brief tells a recording packet backend about a format step: the fields that reach the backend, the
+        /// aligns, and the constructs that depend on the values. Only called while recording is set.
+        virtual void record_step(const detail::format_step &step) noexcept
         {
-            const size_t next_bit_offset = bit_offset + bits;
-            if (next_bit_offset > bit_capacity)
+            (void)step;
+        }
+#endif
+
+        // the format recording hooks (see serdes_compiled_format.h) only exist with
+        // configCPP_SERDES_ENABLE_FORMAT_RECORDING defined, otherwise they're empty and the packet never checks
+        // whether it's recording
+
+        /// @brief tells a recording packet backend about the fields that reached it (see record_step)
+        template <typename T>
+        inline void record_field(const T *const first, const size_t count, const size_t bits) noexcept
+        {
+#ifdef configCPP_SERDES_ENABLE_FORMAT_RECORDING
+            if (recording)
+                record_step(detail::format_step::field_of(first, count, bits));
+#else
+            (void)first;
+            (void)count;
+            (void)bits;
+#endif
+        }
+
+        /// @brief tells a recording packet backend about an align, even one that doesn't move the bit offset
+        inline void record_align(const size_t bits) noexcept
+        {
+#ifdef configCPP_SERDES_ENABLE_FORMAT_RECORDING
+            if (recording)
+                record_step({detail::format_step_e::ALIGN, nullptr, 0u, 0u, bits, detail::field_kind_e::UNSIGNED});
+#else
+            (void)bits;
+#endif
+        }
+
+        /// @brief tells a recording packet backend that the format depends on the values
+        inline void record_data_dependent() noexcept
+        {
+#ifdef configCPP_SERDES_ENABLE_FORMAT_RECORDING
+            if (recording)
+                record_step({detail::format_step_e::DATA_DEPENDENT, nullptr, 0u, 0u, 0u, detail::field_kind_e::UNSIGNED});
+#endif
+        }
+
+        /// @brief tells a recording packet backend that an array's size depends on the values, when it's a reference
+        /// (an rvalue size is a constant of the format, like a fixed size array's)
+        template <typename T, typename ST>
+        inline void record_array_size(const serdes::array<T, ST> &value) noexcept
+        {
+#ifdef configCPP_SERDES_ENABLE_FORMAT_RECORDING
+            if (recording && &value.size != &value.rvalue_size)
+                record_data_dependent();
+#else
+            (void)value;
+#endif
+        }
+
+        /// @brief a packet backend's serial bytes outside of its buffer (a backend has an empty buffer, so that it's
+        /// asked for every field). Only called after a field didn't fit in the buffer, or in the outside_span.
+        /// @param    byte: serial byte offset of the first requested byte
+        /// @param    size: number of bytes requested (the rest of an array, up to the window size that's returned)
+        /// @param    needed: number of bytes of the next field, that the returned window must hold
+        /// @param    field: the field (or the rest of an array) that's loaded or stored, sized field_size bytes
+        /// @return   serial_window: the bytes from "byte" on, in place or in a bounce buffer that's written back by
+        /// outside_buffer_stored, with a size of 0 if they aren't available (EXCEEDED_SERIAL_SIZE)
+        virtual detail::serial_window outside_buffer(const size_t byte, const size_t size, const size_t needed, const void *const field, const size_t field_size) noexcept
+        {
+            (void)byte;
+            (void)size;
+            (void)needed;
+            (void)field;
+            (void)field_size;
+            return {nullptr, 0u};
+        }
+
+        /// @brief called after a window returned by outside_buffer was stored to (so a bounce buffer can be copied
+        /// to the serial bytes)
+        virtual void outside_buffer_stored() noexcept {}
+
+        /// @brief the number of serial bits a packet backend holds outside of its buffer (for pads and aligns)
+        virtual size_t outside_bit_capacity() const noexcept
+        {
+            return 0u;
+        }
+
+        /// @brief the segments holding a packet backend's serial bytes outside of its buffer (for byte iterators)
+        virtual detail::serial_segments outside_segments() const noexcept
+        {
+            return {nullptr, 0u, 0u};
+        }
+
+        /// @brief the outside_span's bytes from "byte" on, or a window with a size of 0 if the span doesn't hold the
+        /// "needed" bytes from it
+        inline detail::serial_window span_window(const size_t byte, const size_t needed) const noexcept
+        {
+            if (outside_span == nullptr || byte < outside_span->first_byte || byte >= outside_span->end_byte || needed > outside_span->end_byte - byte)
+                return {nullptr, 0u};
+            return {outside_span->bytes != nullptr ? outside_span->bytes + (byte - outside_span->first_byte) : nullptr,
+                    outside_span->end_byte - byte};
+        }
+
+        /// @brief checks if the packet holds serial data (a sizing packet only counts the bits)
+        inline bool holds_serial_data() const noexcept
+        {
+            return bit_capacity != 0u || outside_segments().list != nullptr;
+        }
+
+        /// @brief [[deserialize]] loads a field that didn't fit in the buffer from a packet backend's serial bytes
+        /// (out of line, so the default path only inlines the call)
+        /// @return   bool: false if the bytes aren't available (and the status was set)
+        template <typename T>
+        __attribute__((noinline)) bool load_outside_buffer(T &value, const size_t bits) noexcept
+        {
+            record_field(&value, 1u, bits);
+            const size_t shift = bit_offset & 7u;
+            const size_t size = (shift + bits + 7u) / 8u;
+            detail::serial_window window = span_window(bit_offset / 8u, size);
+            if (window.size == 0u)
+                window = outside_buffer(bit_offset / 8u, size, size, &value, sizeof(T));
+            if (window.size < size || (window.bytes != nullptr &&
+                                       detail::ordered_load(bit_order, endian, value, sized_pointer<uint8_t>(window.bytes, window.size), shift, bits) < bits))
             {
                 status = status_e::EXCEEDED_SERIAL_SIZE;
-                return;
+                return false;
             }
-            bit_offset = next_bit_offset;
+            bit_offset += bits;
+            return true;
         }
 
-        /// @brief adds the specified alignment bits, without any safety status checking
-        /// @param    bits
-        inline void align_assuming_no_prior_errors(size_t bits) noexcept
+        /// @brief [[serialize]] stores a field that didn't fit in the buffer into a packet backend's serial bytes
+        /// (see load_outside_buffer)
+        /// @return   bool: false if the bytes aren't available (and the status was set)
+        template <typename T>
+        __attribute__((noinline)) bool store_outside_buffer(const T &value, const size_t bits) noexcept
+        {
+            record_field(&value, 1u, bits);
+            const size_t shift = bit_offset & 7u;
+            const size_t size = (shift + bits + 7u) / 8u;
+            detail::serial_window window = span_window(bit_offset / 8u, size);
+            const bool in_span = window.size != 0u;
+            if (!in_span)
+                window = outside_buffer(bit_offset / 8u, size, size, &value, sizeof(T));
+            if (window.size < size || (window.bytes != nullptr &&
+                                       detail::ordered_store(bit_order, endian, sized_pointer<uint8_t>(window.bytes, window.size), value, shift, bits) < bits))
+            {
+                status = status_e::EXCEEDED_SERIAL_SIZE;
+                return false;
+            }
+            if (window.bytes != nullptr && !in_span)
+                outside_buffer_stored();
+            bit_offset += bits;
+            return true;
+        }
+
+        /// @brief [[deserialize]] loads the rest of an array that didn't fit in the buffer from a packet backend's
+        /// serial bytes, as many elements per window as it holds (with the bulk kernels when they apply)
+        template <typename T>
+        __attribute__((noinline)) void load_array_outside_buffer(T *const values, const size_t count, const size_t bits) noexcept
         {
-            const size_t alignment = bit_offset % bits;
-            if (alignment > 0)
+            record_field(values, count, bits);
+            for (size_t i = 0; i < count;)
             {
-                const size_t next_bit_offset = bit_offset + bits - alignment;
-                if (next_bit_offset > bit_capacity)
+                const size_t shift = bit_offset & 7u;
+                const size_t needed = (shift + bits + 7u) / 8u;
+                const size_t size = (shift + (count - i) * bits + 7u) / 8u;
+                detail::serial_window window = span_window(bit_offset / 8u, needed);
+                if (window.size == 0u)
+                    window = outside_buffer(bit_offset / 8u, size, needed, &values[i], (count - i) * sizeof(T));
+                if (window.size < needed)
                 {
                     status = status_e::EXCEEDED_SERIAL_SIZE;
                     return;
                 }
-                bit_offset = next_bit_offset;
+                // a window holding the rest of the array (like a sizing packet's unbounded one) takes all of it
+                const size_t run = window.size >= size ? count - i : (window.size * 8u - shift) / bits;
+                if (window.bytes != nullptr)
+                {
+                    const sized_pointer<uint8_t> bytes(window.bytes, window.size);
+                    if (run < 2u || bits > sizeof(T) * 8u || !bulk_load_at(&values[i], bytes, shift, run, bits))
+                        for (size_t j = 0; j < run; ++j)
+                            if (detail::ordered_load(bit_order, endian, values[i + j], bytes, shift + j * bits, bits) < bits)
+                            {
+                                bit_offset += j * bits;
+                                status = status_e::EXCEEDED_SERIAL_SIZE;
+                                return;
+                            }
+                }
+                bit_offset += run * bits;
+                i += run;
             }
         }
 
-        /// @brief ensures that the mode is in LOADING mode if the user used a load specific operator
-        inline void ensure_load() noexcept
+        /// @brief [[serialize]] stores the rest of an array that didn't fit in the buffer into a packet backend's
+        /// serial bytes (see load_array_outside_buffer)
+        template <typename T>
+        __attribute__((noinline)) void store_array_outside_buffer(const T *const values, const size_t count, const size_t bits) noexcept
         {
-            if (mode != mode_e::LOADING)
+            record_field(values, count, bits);
+            for (size_t i = 0; i < count;)
             {
-                if (mode == mode_e::STORING)
-                    reset();
-                mode = mode_e::LOADING;
+                const size_t shift = bit_offset & 7u;
+                const size_t needed = (shift + bits + 7u) / 8u;
+                const size_t size = (shift + (count - i) * bits + 7u) / 8u;
+                detail::serial_window window = span_window(bit_offset / 8u, needed);
+                const bool in_span = window.size != 0u;
+                if (!in_span)
+                    window = outside_buffer(bit_offset / 8u, size, needed, &values[i], (count - i) * sizeof(T));
+                if (window.size < needed)
+                {
+                    status = status_e::EXCEEDED_SERIAL_SIZE;
+                    return;
+                }
+                // a window holding the rest of the array (like a sizing packet's unbounded one) takes all of it
+                const size_t run = window.size >= size ? count - i : (window.size * 8u - shift) / bits;
+                if (window.bytes != nullptr)
+                {
+                    const sized_pointer<uint8_t> bytes(window.bytes, window.size);
+                    if (run < 2u || bits > sizeof(T) * 8u || !bulk_store_at(bytes, shift, &values[i], run, bits))
+                        for (size_t j = 0; j < run; ++j)
+                            if (detail::ordered_store(bit_order, endian, bytes, values[i + j], shift + j * bits, bits) < bits)
+                            {
+                                if (!in_span)
+                                    outside_buffer_stored();
+                                bit_offset += j * bits;
+                                status = status_e::EXCEEDED_SERIAL_SIZE;
+                                return;
+                            }
+                    if (!in_span)
+                        outside_buffer_stored();
+                }
+                bit_offset += run * bits;
+                i += run;
             }
         }
 
-        /// @brief ensures that the mode is in STORING mode if the user used a store specific operator
-        inline void ensure_store() noexcept
+        /// @brief a byte iterator over serial bytes that aren't all in the buffer, from a packet backend's segments
+        /// (out of line, like load_outside_buffer)
+        __attribute__((noinline)) byte_iterator_type outside_byte_iterator(const size_t start, const size_t end) noexcept
         {
-            if (mode != mode_e::STORING)
+            const detail::serial_segments outside = outside_segments();
+            if (end >= outside.end_byte)
             {
-                if (mode == mode_e::LOADING)
-                    reset();
-                mode = mode_e::STORING;
+                status = status_e::NUM_BYTES_OVER_MAX;
+                return {buffer, 0u, 0u};
+            }
+            if (outside.list == nullptr)
+                return {buffer, 0u, 0u};
+            if (start < outside.first_byte)
+            {
+                status = status_e::OUTSIDE_LOOK_BACK_WINDOW;
+                return {buffer, 0u, 0u};
             }
+            return {buffer, start, end, outside.list, outside.first_byte};
         }
-    };
 
-    template <typename T_array, size_t N>
-    status_t packet_base::store(T_array (&target_buffer)[N], size_t max_elements, size_t bit_offset)
-    {
-        if (N < max_elements)
-            max_elements = N;
-        packet pkt_obj(serdes::sized_pointer<T_array>(&target_buffer[0], max_elements), bit_offset, mode_e::STORING);
-        format(pkt_obj);
-        return {pkt_obj.status, pkt_obj.bit_offset};
-    }
+        /// @brief [[deserialize]] copies one field at the bit offset, in the packet's bit and byte order (without
+        /// advancing the bit offset)
+        /// @return   size_t: number of bits copied (less than bits if the field doesn't fit)
+        template <typename T>
+        inline size_t ordered_load(T &value, const size_t bits) noexcept
+        {
+            return detail::ordered_load(bit_order, endian, value, buffer, bit_offset, bits);
+        }
 
-    template <typename T_pointer, typename std::enable_if<std::is_pointer<T_pointer>::value, int *>::type>
-    status_t packet_base::store(T_pointer target_buffer, size_t max_elements, size_t bit_offset)
-    {
-        packet pkt_obj(serdes::sized_pointer<typename std::remove_pointer<T_pointer>::type>(target_buffer, max_elements), bit_offset, mode_e::STORING);
-        format(pkt_obj);
-        return {pkt_obj.status, pkt_obj.bit_offset};
-    }
+        /// @brief [[serialize]] copies one field to the bit offset, in the packet's bit and byte order (without
+        /// advancing the bit offset)
+        /// @return   size_t: number of bits copied (less than bits if the field doesn't fit)
+        template <typename T>
+        inline size_t ordered_store(const T &value, const size_t bits) noexcept
+        {
+            return detail::ordered_store(bit_order, endian, buffer, value, bit_offset, bits);
+        }
 
-    template <typename T_sized_pointer, typename std::enable_if<serdes::detail::is_sized_pointer<T_sized_pointer>::value, int *>::type>
-    status_t packet_base::store(T_sized_pointer target_buffer, size_t bit_offset)
-    {
-        packet pkt_obj(target_buffer, bit_offset, mode_e::STORING);
-        format(pkt_obj);
-        return {pkt_obj.status, pkt_obj.bit_offset};
-    }
-    template <typename T_array, size_t N>
-    status_t packet_base::load(const T_array (&source_buffer)[N], size_t max_elements, size_t bit_offset)
+        /// @brief checks if an array can use the bulk bitcpy kernels, which requires a bit width that
+        /// doesn't exceed the element type, and enough room for every element (otherwise the per
+        /// element path is used, so that partial writes and errors behave the same)
+        /// @tparam   T: array element type
+        /// @param    count: number of array elements
+        /// @param    bits: bits per element
+        /// @return   true if detail::bulk_pack/bulk_unpack can be used
+        template <typename T>
+        inline bool bulk_bitcpy_fits(const size_t count, const size_t bits) const noexcept
+        {
+            return bits != 0u && bits <= sizeof(T) * 8u && count > 1u &&
+                   bit_offset <= bit_capacity && count * bits <= bit_capacity - bit_offset;
+        }
+
+        /// @brief packs an array with the bulk bitcpy kernel if possible, without any safety status checking
+        /// @return   true if the array was stored, false if it needs to be stored element by element
+        template <typename T>
+        inline bool bulk_store(const T *const values, const size_t count, const size_t bits) noexcept
+        {
+            if (!bulk_bitcpy_fits<T>(count, bits) || !bulk_store_at(buffer, bit_offset, values, count, bits))
+                return false;
+            bit_offset += count * bits;
+            return true;
+        }
+
+        /// @brief unpacks an array with the bulk bitcpy kernel if possible, without any safety status checking
+        /// @return   true if the array was loaded, false if it needs to be loaded element by element
+        template <typename T>
+        inline bool bulk_load(T *const values, const size_t count, const size_t bits) noexcept
+        {
+            if (!bulk_bitcpy_fits<T>(count, bits) || !bulk_load_at(values, buffer, bit_offset, count, bits))
+                return false;
+            bit_offset += count * bits;
+            return true;
+        }
+
+        /// @brief packs an array into serial bytes that are known to hold it, at a bit offset, with the bulk bitcpy
+        /// kernel if the packet's bit and byte order allow it
+        /// @return   true if the array was stored, false if it needs to be stored element by element
+        template <typename T, typename std::enable_if<detail::supported_by_bulk_bitcpy<T>::value, int *>::type = nullptr>
+        inline bool bulk_store_at(const sized_pointer<void> &dest, const size_t offset, const T *const values, const size_t count, const size_t bits) const noexcept
+        {
+            if (bit_order == bit_order_e::LSB_FIRST || (endian == endian_e::LITTLE && sizeof(T) > 1u))
+            {
+                // only full width little endian (or LSB first) elements in a byte array have a bulk path (a plain
+                // memcpy on little endian platforms), everything else is stored element by element
+                if (bits != sizeof(T) * 8u || (offset & 7u) != 0u || dest.element_size != 1u)
+                    return false;
+                detail::little_endian_pack(&reinterpret_cast<uint8_t *>(dest.value)[offset >> 3], values, count);
+            }
+            else if (bits == sizeof(T) * 8u && (offset & 7u) == 0u)
+            {
+                // full width elements on byte boundaries are just a (byte swapping) copy
+                if (dest.element_size == 1u)
+                    detail::big_endian_pack(&reinterpret_cast<uint8_t *>(dest.value)[offset >> 3], values, count);
+                else if (dest.element_size == sizeof(T) && offset % bits == 0u)
+                    std::memcpy(&reinterpret_cast<uint8_t *>(dest.value)[offset >> 3], values, count * sizeof(T));
+                else
+                    detail::bulk_pack(dest, values, count, offset, bits);
+            }
+            else
+                detail::bulk_pack(dest, values, count, offset, bits);
+            return true;
+        }
+        template <typename T, typename std::enable_if<std::is_same<T, bool>::value, int *>::type = nullptr>
+        inline bool bulk_store_at(const sized_pointer<void> &dest, const size_t offset, const T *const values, const size_t count, const size_t bits) const noexcept
+        {
+            // one bit per bool is packed 8 (and 64) at a time, LSB first bit numbering is stored bool by bool
+            if (bits != 1u || bit_order == bit_order_e::LSB_FIRST)
+                return false;
+            detail::bulk_pack(dest, values, count, offset, bits);
+            return true;
+        }
+        template <typename T, typename std::enable_if<!detail::supported_by_bulk_bitcpy<T>::value && !std::is_same<T, bool>::value, int *>::type = nullptr>
+        constexpr bool bulk_store_at(const sized_pointer<void> &, const size_t, const T *const, const size_t, const size_t) const noexcept
+        {
+            return false;
+        }
+
+        /// @brief unpacks an array from serial bytes that are known to hold it, at a bit offset (see bulk_store_at)
+        /// @return   true if the array was loaded, false if it needs to be loaded element by element
+        template <typename T, typename std::enable_if<detail::supported_by_bulk_bitcpy<T>::value, int *>::type = nullptr>
+        inline bool bulk_load_at(T *const values, const sized_pointer<void> &source, const size_t offset, const size_t count, const size_t bits) const noexcept
+        {
+            if (bit_order == bit_order_e::LSB_FIRST || (endian == endian_e::LITTLE && sizeof(T) > 1u))
+            {
+                // see bulk_store_at
+                if (bits != sizeof(T) * 8u || (offset & 7u) != 0u || source.element_size != 1u)
+                    return false;
+                detail::little_endian_unpack(values, &reinterpret_cast<const uint8_t *>(source.value)[offset >> 3], count);
+            }
+            else if (bits == sizeof(T) * 8u && (offset & 7u) == 0u)
+            {
+                // full width elements on byte boundaries are just a (byte swapping) copy
+                if (source.element_size == 1u)
+                    detail::big_endian_unpack(values, &reinterpret_cast<const uint8_t *>(source.value)[offset >> 3], count);
+                else if (source.element_size == sizeof(T) && offset % bits == 0u)
+                    std::memcpy(values, &reinterpret_cast<const uint8_t *>(source.value)[offset >> 3], count * sizeof(T));
+                else
+                    detail::bulk_unpack(values, source, count, offset, bits);
+            }
+            else
+                detail::bulk_unpack(values, source, count, offset, bits);
+            return true;
+        }
+        template <typename T, typename std::enable_if<std::is_same<T, bool>::value, int *>::type = nullptr>
+        inline bool bulk_load_at(T *const values, const sized_pointer<void> &source, const size_t offset, const size_t count, const size_t bits) const noexcept
+        {
+            // see the bool bulk_store_at
+            if (bits != 1u || bit_order == bit_order_e::LSB_FIRST)
+                return false;
+            detail::bulk_unpack(values, source, count, offset, bits);
+            return true;
+        }
+        template <typename T, typename std::enable_if<!detail::supported_by_bulk_bitcpy<T>::value && !std::is_same<T, bool>::value, int *>::type = nullptr>
+        constexpr bool bulk_load_at(T *const, const sized_pointer<void> &, const size_t, const size_t, const size_t) const noexcept
+        {
+            return false;
+        }
+
+        /// @brief adds the specified pad bits, without any safety status checking
+        /// @param    bits
+        inline void pad_assuming_no_prior_errors(const size_t bits) noexcept
+        {
+            const size_t next_bit_offset = bit_offset + bits;
+            if (next_bit_offset > bit_capacity && next_bit_offset > outside_bit_capacity())
+            {
+                status = status_e::EXCEEDED_SERIAL_SIZE;
+                return;
+            }
+            bit_offset = next_bit_offset;
+        }
+
+        /// @brief adds the specified alignment bits, without any safety status checking
+        /// @param    bits
+        inline void align_assuming_no_prior_errors(size_t bits) noexcept
+        {
+            record_align(bits);
+            const size_t alignment = bit_offset % bits;
+            if (alignment > 0)
+            {
+                const size_t next_bit_offset = bit_offset + bits - alignment;
+                if (next_bit_offset > bit_capacity && next_bit_offset > outside_bit_capacity())
+                {
+                    status = status_e::EXCEEDED_SERIAL_SIZE;
+                    return;
+                }
+                bit_offset = next_bit_offset;
+            }
+        }
+
+        /// @brief checks if a fused group can be copied with a single bitcpy, which requires the default bit and
+        /// byte order, and room for the whole group (otherwise each field is copied, so partial writes and errors
+        /// behave the same).
+        /// @param    bits: total bits of the fused group
+        /// @return   true if the group can be copied as a single word
+        inline bool fused_group_fits(const size_t bits) const noexcept
+        {
+            return bit_order == bit_order_e::MSB_FIRST && endian == endian_e::BIG &&
+                   bit_offset <= bit_capacity && bits <= bit_capacity - bit_offset;
+        }
+
+        /// @brief stores a group as a single word if possible, otherwise one field at a time
+        template <typename... T>
+        inline void store_group(const field_group<T...> &fields, std::true_type) noexcept
+        {
+            constexpr size_t bits = detail::fusable_group<T...>::bits;
+            if (!fused_group_fits(bits))
+                return store_group(fields, std::false_type());
+            bitcpy(buffer, detail::fuse_fields(fields, 0u), bit_offset, bits);
+            bit_offset += bits;
+        }
+        inline void store_group(const field_group<> &, std::false_type) noexcept {}
+        template <typename T, typename... Rest>
+        inline void store_group(const field_group<T, Rest...> &fields, std::false_type)
+        {
+            store(fields.value);
+            store_group(fields.rest, std::false_type());
+        }
+
+        /// @brief loads a group as a single word if possible, otherwise one field at a time
+        template <typename... T>
+        inline void load_group(field_group<T...> &fields, std::true_type) noexcept
+        {
+            constexpr size_t bits = detail::fusable_group<T...>::bits;
+            if (!fused_group_fits(bits))
+                return load_group(fields, std::false_type());
+            uint64_t word = 0u;
+            bitcpy(word, buffer, bit_offset, bits);
+            detail::unfuse_fields(fields, word);
+            bit_offset += bits;
+        }
+        inline void load_group(field_group<> &, std::false_type) noexcept {}
+        template <typename T, typename... Rest>
+        inline void load_group(field_group<T, Rest...> &fields, std::false_type)
+        {
+            load(std::forward<T>(fields.value));
+            load_group(fields.rest, std::false_type());
+        }
+
+        /// @brief ensures that the mode is in LOADING mode if the user used a load specific operator
+        inline void ensure_load() noexcept
+        {
+            if (mode != mode_e::LOADING)
+            {
+                if (mode == mode_e::STORING)
+                    reset();
+                mode = mode_e::LOADING;
+            }
+        }
+
+        /// @brief ensures that the mode is in STORING mode if the user used a store specific operator
+        inline void ensure_store() noexcept
+        {
+            if (mode != mode_e::STORING)
+            {
+                if (mode == mode_e::LOADING)
+                    reset();
+                mode = mode_e::STORING;
+            }
+        }
+    };
+
+    // implementation details
+    namespace detail
+    {
+        /// @brief how a typed_packet handles a field: 0 = hand it to the generic packet implementation,
+        /// 1 = a plain value, 2 = a bitpack of a plain value, 3 = a type with a "format" method
+        template <typename T, typename T_plain = typename remove_cvref_cpp11<T>::type>
+        struct typed_packet_route
+            : std::integral_constant<int,
+                (std::is_arithmetic<T_plain>::value || std::is_enum<T_plain>::value) ? 1 : has_format_method<T>::value ? 3 : 0>
+        {
+        };
+        template <typename T, typename T2, typename ST>
+        struct typed_packet_route<T, bitpack<T2, ST>>
+            : std::integral_constant<int, (std::is_arithmetic<typename std::remove_cv<T2>::type>::value || std::is_enum<typename std::remove_cv<T2>::type>::value) ? 2 : 0>
+        {
+        };
+
+        /// @brief true if "add(x, args...)" is a plain field that may be followed by a bit count
+        template <typename... Args>
+        struct typed_packet_bits_args : std::false_type
+        {
+        };
+        template <>
+        struct typed_packet_bits_args<> : std::true_type
+        {
+        };
+        template <typename T>
+        struct typed_packet_bits_args<T> : std::is_integral<typename remove_cvref_cpp11<T>::type>
+        {
+        };
+
+        /// @brief the serialized bits of a type whose size is known at compile time (plain values, fixed arrays of
+        /// them, and static_format bindings), or 0 if it's only known at runtime
+        template <typename T, typename Enable = void>
+        struct static_serialized_bits : std::integral_constant<size_t, 0u>
+        {
+        };
+        template <typename T>
+        struct static_serialized_bits<T, typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type>
+            : std::integral_constant<size_t, default_bitsize<T>::value>
+        {
+        };
+        template <typename T, size_t N>
+        struct static_serialized_bits<T[N], void> : std::integral_constant<size_t, N * static_serialized_bits<typename std::remove_cv<T>::type>::value>
+        {
+        };
+    }
+
+    /// @brief a packet whose buffer element type is known at compile time.
+    ///
+    /// A serdes::packet stores its buffer as a sized_pointer<void>, so every field has to switch on the
+    /// runtime element size. A typed_packet<T_array> resolves values, bitpacks, and nested "format" calls
+    /// directly against a sized_pointer<T_array> instead. It is still a serdes::packet, so it can be passed
+    /// to any existing "void format(serdes::packet&)" method (which will use the generic path), while types
+    /// with a templated "template <typename T_packet> void format(T_packet&)" method are handed the
+    /// typed_packet itself. Everything else (arrays, formatters, validators, ...) uses the packet implementation.
+    ///
+    /// An unchecked typed_packet (see serdes::unchecked_packet) compiles the capacity and prior status checks out of
+    /// its value, bitpack, and nested format paths, it is only safe once the format is known to fit.
+    /// @tparam   T_array: the buffer's element type (uint8_t, uint16_t, uint32_t, or uint64_t)
+    /// @tparam   Checked: false to skip the per field capacity and status checks (see serdes::unchecked_packet)
+    /// @tparam   Elements: the buffer's number of elements if it's known at compile time (see serdes::static_packet),
+    /// or 0 if it's only known at runtime
+    template <typename T_array, bool Checked = true, size_t Elements = 0>
+    struct typed_packet : packet
+    {
+        static_assert(std::is_integral<T_array>::value && !std::is_signed<T_array>::value && sizeof(T_array) <= 8u &&
+                          std::is_same<T_array, typename std::remove_cv<T_array>::type>::value,
+                      "typed_packet requires an unsigned integral buffer element type of up to 64 bits");
+
+        /// @brief Construct a new typed packet object from an c style array pointer
+        /// @tparam   T_pointer: the array's base pointer type (T_array* or const T_array*)
+        /// @param    array_init: an array pointer (without size)
+        /// @param    max_elements: the maximum number of elements to use in the array
+        /// @param    b_offset: bit offset to start serdes process at
+        /// @param    m: starting mode (LOADING/STORING/UNSPECIFIED)
+        template <typename T_pointer, typename std::enable_if<std::is_pointer<T_pointer>::value &&
+                                                                  std::is_same<typename std::remove_cv<typename std::remove_pointer<T_pointer>::type>::type, T_array>::value,
+                                                              int *>::type = nullptr>
+        typed_packet(T_pointer array_init, size_t max_elements = ~size_t(0), size_t b_offset = 0, mode_e m = mode_e::UNSPECIFIED)
+            : packet(array_init, max_elements, b_offset, m) {}
+
+        /// @brief Construct a new typed packet object from an c style array
+        /// @tparam   N: the size of the array
+        /// @param    array_init: the array
+        /// @param    max_elements: the maximum number of elements to use in the array (can be <= N)
+        /// @param    b_offset: bit offset to start serdes process at
+        /// @param    m: starting mode (LOADING/STORING/UNSPECIFIED)
+        template <size_t N>
+        typed_packet(T_array (&array_init)[N], size_t max_elements = ~size_t(0), size_t b_offset = 0, mode_e m = mode_e::UNSPECIFIED)
+            : packet(array_init, max_elements, b_offset, m) {}
+
+        /// @brief Construct a new typed packet object from a const c style array (for loading)
+        /// @tparam   N: the size of the array
+        /// @param    array_init: the array
+        /// @param    max_elements: the maximum number of elements to use in the array (can be <= N)
+        /// @param    b_offset: bit offset to start serdes process at
+        /// @param    m: starting mode (LOADING/STORING/UNSPECIFIED)
+        template <size_t N>
+        typed_packet(const T_array (&array_init)[N], size_t max_elements = ~size_t(0), size_t b_offset = 0, mode_e m = mode_e::UNSPECIFIED)
+            : packet(array_init, max_elements, b_offset, m) {}
+
+        /// @brief Construct a new typed packet object from an sized_pointer array for size safety
+        /// @tparam   T_sized_array: T_array or const T_array
+        /// @param    array_init: an array with size information
+        /// @param    b_offset: bit offset to start serdes process at
+        /// @param    m: starting mode (LOADING/STORING/UNSPECIFIED)
+        template <typename T_sized_array, typename std::enable_if<std::is_same<typename std::remove_cv<T_sized_array>::type, T_array>::value, int *>::type = nullptr>
+        typed_packet(sized_pointer<T_sized_array> array_init, size_t b_offset = 0, mode_e m = mode_e::UNSPECIFIED)
+            : packet(array_init, b_offset, m) {}
+
+        /// @brief [[deserialize]] loads from the serial buffer (same as packet::load, but with values,
+        /// bitpacks, and format methods resolved against the typed buffer)
+        /// @tparam   T: type of the target value to load into
+        /// @param    value: target value to load into
+        /// @param    args: optional arguments (such as the number of bits)
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void load(T &&value, Args &&...args)
+        {
+            static_assert(fits_statically<T, sizeof...(Args)>(), "the value can never fit in the static_packet's buffer");
+            // plain values can only be loaded into non-const lvalues, anything else is left to packet to reject
+            constexpr int route = detail::typed_packet_route<T>::value;
+            constexpr bool writable = std::is_lvalue_reference<T>::value && !std::is_const<typename std::remove_reference<T>::type>::value;
+            load_route(std::integral_constant<int, (route == 1 && !writable) ? 0 : route>{}, std::forward<T>(value), std::forward<Args>(args)...);
+        }
+
+        /// @brief [[serialize]] stores into the serial buffer (same as packet::store, but with values,
+        /// bitpacks, and format methods resolved against the typed buffer)
+        /// @tparam   T: value type
+        /// @param    value: value to store
+        /// @param    args: optional arguments (such as the number of bits)
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void store(T &&value, Args &&...args)
+        {
+            static_assert(fits_statically<T, sizeof...(Args)>(), "the value can never fit in the static_packet's buffer");
+            store_route(detail::typed_packet_route<T>{}, std::forward<T>(value), std::forward<Args>(args)...);
+        }
+
+        /// @brief adds a field to the serial format for both serialization and deserialization
+        /// @tparam   T: value type
+        /// @param    x: value
+        /// @param    args: optional arguments (the number of bits, or a validation function)
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void add(T &&x, Args &&...args)
+        {
+            add_route(std::integral_constant<bool, detail::typed_packet_route<T>::value != 0 && detail::typed_packet_bits_args<Args...>::value>{},
+                      std::forward<T>(x), std::forward<Args>(args)...);
+        }
+
+        /// @brief [[deserialize]] loads serial data into the passed value (same as load)
+        /// @tparam   T: value type
+        /// @param    x: value reference
+        /// @return   typed_packet&: resulting modified packet process
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 typed_packet &operator>>(T &&x)
+        {
+            load(std::forward<T>(x));
+            return *this;
+        }
+
+        /// @brief [[serialize]] stores the passed value into the serial data (same as store)
+        /// @tparam   T: value type
+        /// @param    x: value
+        /// @return   typed_packet&: resulting modified packet process
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 typed_packet &operator<<(T &&x)
+        {
+            store(std::forward<T>(x));
+            return *this;
+        }
+
+#if (defined(__GNUC__) && !defined(__clang__))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Weffc++"
+#endif
+        /// @brief adds a field to the serial format for both serialization and deserialization (same as add())
+        /// @tparam   T: value type
+        /// @param    value: value
+        /// @return   typed_packet&: modified packet process after the add
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 typed_packet &operator+(T &&value)
+        {
+            add(std::forward<T>(value));
+            return *this;
+        }
+#if (defined(__GNUC__) && !defined(__clang__))
+#pragma GCC diagnostic pop
+#endif
+
+    private:
+        /// @brief the buffer with its element type restored, and its size folded to a constant when it's static
+        inline sized_pointer<T_array> typed_buffer() const noexcept
+        {
+            return {static_cast<T_array *>(buffer.value), Elements != 0u ? Elements : buffer.size};
+        }
+
+        /// @brief false if a value with a compile time size (and no explicit bit count) is larger than a static buffer
+        template <typename T, size_t NumArgs>
+        static constexpr bool fits_statically() noexcept
+        {
+            return Elements == 0u || NumArgs != 0u ||
+                   detail::static_serialized_bits<typename detail::remove_cvref_cpp11<T>::type>::value <= Elements * sizeof(T_array) * 8u;
+        }
+
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void load_route(std::integral_constant<int, 0>, T &&value, Args &&...args)
+        {
+            packet::load(std::forward<T>(value), std::forward<Args>(args)...);
+        }
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void load_route(std::integral_constant<int, 1>, T &value, size_t bits = detail::default_bitsize<T>::value)
+        {
+            if (Checked && status != status_e::NO_ERROR)
+                return;
+            ensure_load();
+            if (!Checked && bit_order == bit_order_e::MSB_FIRST && endian == endian_e::BIG)
+            {
+                // (the size isn't checked here, it only keeps the 64 bit reads of byte buffers inside the buffer)
+                detail::sized_bitcpy(value, static_cast<const T_array *>(buffer.value), buffer.size, bit_offset, bits);
+                bit_offset += bits;
+                return;
+            }
+            const size_t bits_touched = detail::ordered_load(bit_order, endian, value, typed_buffer(), bit_offset, bits);
+            bit_offset += bits_touched;
+            if (bits_touched < bits)
+                status = status_e::EXCEEDED_SERIAL_SIZE;
+        }
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void load_route(std::integral_constant<int, 2>, T &&value)
+        {
+            load(value.value, value.bits);
+        }
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE2 void load_route(std::integral_constant<int, 3>, T &&value)
+        {
+            if (Checked && status != status_e::NO_ERROR)
+                return;
+            ensure_load();
+            std::forward<T>(value).format(*this);
+        }
+
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void store_route(std::integral_constant<int, 0>, T &&value, Args &&...args)
+        {
+            packet::store(std::forward<T>(value), std::forward<Args>(args)...);
+        }
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void store_route(std::integral_constant<int, 1>, const T &value, size_t bits = detail::default_bitsize<typename detail::remove_cvref_cpp11<T>::type>::value)
+        {
+            if (Checked && status != status_e::NO_ERROR)
+                return;
+            ensure_store();
+            if (!Checked && bit_order == bit_order_e::MSB_FIRST && endian == endian_e::BIG)
+            {
+                bitcpy(static_cast<T_array *>(buffer.value), value, bit_offset, bits);
+                bit_offset += bits;
+                return;
+            }
+            const size_t bits_touched = detail::ordered_store(bit_order, endian, typed_buffer(), value, bit_offset, bits);
+            bit_offset += bits_touched;
+            if (bits_touched < bits)
+                status = status_e::EXCEEDED_SERIAL_SIZE;
+        }
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void store_route(std::integral_constant<int, 2>, const T &value)
+        {
+            store(value.value, value.bits);
+        }
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE2 void store_route(std::integral_constant<int, 3>, T &&value)
+        {
+            if (Checked && status != status_e::NO_ERROR)
+                return;
+            ensure_store();
+            std::forward<T>(value).format(*this);
+        }
+
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void add_route(std::false_type, T &&x, Args &&...args)
+        {
+            packet::add(std::forward<T>(x), std::forward<Args>(args)...);
+        }
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void add_route(std::true_type, T &&x, Args &&...args)
+        {
+            if (mode == mode_e::LOADING)
+                load(std::forward<T>(x), std::forward<Args>(args)...);
+            else if (mode == mode_e::STORING)
+                store(std::forward<T>(x), std::forward<Args>(args)...);
+        }
+    };
+
+    /// @brief a typed_packet without per field capacity and status checks (see serdes::unchecked_store), only safe
+    /// once the format is known to fit. Errors of the packet implementation (arrays, validators, formatters, ...)
+    /// are still reported, and the status keeps the first one, but the plain fields after an error are still
+    /// loaded or stored, so the serial data or the object is only meaningful if the status is NO_ERROR.
+    template <typename T_array>
+    using unchecked_packet = typed_packet<T_array, false>;
+
+    /// @brief a typed_packet over a fixed size buffer (a c style array or a std::array), which keeps the capacity
+    /// as a compile time constant instead of erasing it, so any value whose size is known at compile time (a plain
+    /// value, a fixed array, or a static_format binding) that can never fit is rejected by a static_assert. The
+    /// runtime bounds checks of other values compare against the constant, which costs about the same as a
+    /// typed_packet's. Existing "void format(serdes::packet&)" methods work as usual, through the generic packet path.
+    ///
+    /// Examples:\n
+    /// \code{.cpp}
+    ///     uint8_t buffer[8];
+    ///     serdes::static_packet<uint8_t, 8> p(buffer);
+    ///     p << header_format::bind(header);  // doesn't compile if the format is larger than 64 bits
+    ///     static_assert(header_format::bits <= decltype(p)::capacity_bits, "");
+    /// \endcode
+    /// @tparam   T_array: the buffer's element type (uint8_t, uint16_t, uint32_t, or uint64_t)
+    /// @tparam   N: the buffer's number of elements
+    template <typename T_array, size_t N>
+    struct static_packet : typed_packet<T_array, true, N>
+    {
+        static_assert(N > 0u, "a static_packet needs a buffer with at least one element");
+
+        static constexpr size_t capacity_bits = N * sizeof(T_array) * 8u; ///< bit capacity of the buffer
+
+        /// @brief Construct a new static packet object from a c style array
+        /// @param    array_init: the array
+        /// @param    b_offset: bit offset to start serdes process at
+        /// @param    m: starting mode (LOADING/STORING/UNSPECIFIED)
+        static_packet(T_array (&array_init)[N], size_t b_offset = 0, mode_e m = mode_e::UNSPECIFIED)
+            : typed_packet<T_array, true, N>(array_init, N, b_offset, m) {}
+
+        /// @brief Construct a new static packet object from a const c style array (for loading)
+        /// @param    array_init: the array
+        /// @param    b_offset: bit offset to start serdes process at
+        /// @param    m: starting mode (LOADING/STORING/UNSPECIFIED)
+        static_packet(const T_array (&array_init)[N], size_t b_offset = 0, mode_e m = mode_e::UNSPECIFIED)
+            : typed_packet<T_array, true, N>(array_init, N, b_offset, m) {}
+
+        /// @brief Construct a new static packet object from a std::array
+        /// @param    array_init: the array
+        /// @param    b_offset: bit offset to start serdes process at
+        /// @param    m: starting mode (LOADING/STORING/UNSPECIFIED)
+        static_packet(std::array<T_array, N> &array_init, size_t b_offset = 0, mode_e m = mode_e::UNSPECIFIED)
+            : typed_packet<T_array, true, N>(array_init.data(), N, b_offset, m) {}
+
+        /// @brief Construct a new static packet object from a const std::array (for loading)
+        /// @param    array_init: the array
+        /// @param    b_offset: bit offset to start serdes process at
+        /// @param    m: starting mode (LOADING/STORING/UNSPECIFIED)
+        static_packet(const std::array<T_array, N> &array_init, size_t b_offset = 0, mode_e m = mode_e::UNSPECIFIED)
+            : typed_packet<T_array, true, N>(array_init.data(), N, b_offset, m) {}
+    };
+    template <typename T_array, size_t N>
+    constexpr size_t static_packet<T_array, N>::capacity_bits;
+
+    /// @brief [[serialize]] stores a value whose serialized size is known at compile time (a plain value, a fixed
+    /// array of them, or a static_format binding), with the capacity validated once up front instead of for every
+    /// field. A value that can never fit the buffer is rejected by a static_assert, and one that doesn't fit at
+    /// bit_offset is stored with the normal checked store instead (which reports EXCEEDED_SERIAL_SIZE). Values
+    /// whose size is only known at runtime can use an unchecked_packet directly, once their size was validated.
+    ///
+    /// Only formats compiled against the packet type get the unchecked paths: values, bitpacks, static_format
+    /// bindings, and templated "template <typename T_packet> void format(T_packet&)" methods. A packet_base's virtual
+    /// "void format(serdes::packet&)" always runs the checked serdes::packet paths, even inside an unchecked_packet.
+    ///
+    /// Examples:\n
+    /// \code{.cpp}
+    ///     serdes::unchecked_store(header_format::bind(header), buffer);
+    /// \endcode
+    /// @tparam   T: a value with a compile time serialized size
+    /// @param    value: the value (or static_format binding) to store
+    /// @param    target_buffer: the target serial array
+    /// @param    bit_offset: the starting bit offset
+    /// @return   serdes::status_t: the store process's resulting status
+    template <typename T, typename T_array, size_t N>
+    status_t unchecked_store(T &&value, T_array (&target_buffer)[N], size_t bit_offset = 0)
+    {
+        constexpr size_t bits = detail::static_serialized_bits<typename detail::remove_cvref_cpp11<T>::type>::value;
+        constexpr size_t capacity = N * sizeof(T_array) * 8u;
+        static_assert(bits != 0u, "unchecked_store needs a value whose serialized size is known at compile time");
+        static_assert(bits <= capacity, "the value can never fit in the buffer");
+        if (bit_offset > capacity - bits)
+        {
+            typed_packet<T_array> checked_pkt(target_buffer, N, bit_offset, mode_e::STORING);
+            checked_pkt.store(std::forward<T>(value));
+            return {checked_pkt.status, checked_pkt.bit_offset};
+        }
+        unchecked_packet<T_array> pkt_obj(target_buffer, N, bit_offset, mode_e::STORING);
+        pkt_obj.store(std::forward<T>(value));
+        return {pkt_obj.status, pkt_obj.bit_offset};
+    }
+
+    /// @brief [[deserialize]] loads a value whose serialized size is known at compile time, with the capacity
+    /// validated once up front instead of for every field (see unchecked_store)
+    /// @tparam   T: a value with a compile time serialized size
+    /// @param    value: the value (or static_format binding) to load into
+    /// @param    source_buffer: the source serial array
+    /// @param    bit_offset: the starting bit offset
+    /// @return   serdes::status_t: the load process's resulting status
+    template <typename T, typename T_array, size_t N>
+    status_t unchecked_load(T &&value, const T_array (&source_buffer)[N], size_t bit_offset = 0)
+    {
+        constexpr size_t bits = detail::static_serialized_bits<typename detail::remove_cvref_cpp11<T>::type>::value;
+        constexpr size_t capacity = N * sizeof(T_array) * 8u;
+        static_assert(bits != 0u, "unchecked_load needs a value whose serialized size is known at compile time");
+        static_assert(bits <= capacity, "the value can never fit in the buffer");
+        if (bit_offset > capacity - bits)
+        {
+            typed_packet<T_array> checked_pkt(source_buffer, N, bit_offset, mode_e::LOADING);
+            checked_pkt.load(std::forward<T>(value));
+            return {checked_pkt.status, checked_pkt.bit_offset};
+        }
+        unchecked_packet<T_array> pkt_obj(source_buffer, N, bit_offset, mode_e::LOADING);
+        pkt_obj.load(std::forward<T>(value));
+        return {pkt_obj.status, pkt_obj.bit_offset};
+    }
+
+    /// @brief a packet backend that only counts the bits a store would serialize: it has no buffer, and every field
+    /// advances the bit offset without being written (see serialized_bits)
+    struct sizing_packet : packet
+    {
+        /// @brief Construct a new sizing packet object
+        /// @param    b_offset: bit offset to start counting at (only matters to aligns)
+        explicit sizing_packet(size_t b_offset = 0) noexcept
+            : packet(static_cast<uint8_t *>(nullptr), 0u, b_offset, mode_e::STORING)
+        {
+            outside_span = &counted;
+        }
+
+        sizing_packet(const sizing_packet &) = delete;
+        sizing_packet &operator=(const sizing_packet &) = delete;
+
+    protected:
+        detail::serial_window outside_buffer(const size_t, const size_t size, const size_t, const void *const, const size_t) noexcept override
+        {
+            return {nullptr, size};
+        }
+        size_t outside_bit_capacity() const noexcept override
+        {
+            return ~size_t(0);
+        }
+        detail::serial_segments outside_segments() const noexcept override
+        {
+            return {nullptr, 0u, ~size_t(0)};
+        }
+
+    private:
+        /// @brief every serial byte is counted in the span, so fields are counted without a virtual call
+        const detail::serial_span counted = {nullptr, 0u, ~size_t(0)};
+    };
+
+    /// @brief [[sizing]] walks the format of any storable value without a buffer, and returns the exact number of bits
+    /// a store would serialize. Nothing is written, and no capacity limit applies, so this is much cheaper than a
+    /// store into a worst case sized scratch buffer. Fixed layouts can skip the walk entirely: a static_format's size
+    /// is a compile time constant.
+    ///
+    /// Examples:\n
+    /// \code{.cpp}
+    ///     std::vector<uint8_t> buffer((serdes::serialized_bits(message).bits + 7u) / 8u);
+    ///     serdes::serialized_bits(header_format::bind(header)); // constant, for a static_format
+    /// \endcode
+    /// @tparam   T: any type that can be stored into a packet
+    /// @param    value: the value (or object) to measure
+    /// @param    bit_offset: the starting bit offset (only matters to aligns)
+    /// @return   serdes::status_t: the status a store would end with, and the number of bits it would store
+    template <typename T>
+    status_t serialized_bits(T &&value, size_t bit_offset = 0)
+    {
+        sizing_packet pkt_obj(bit_offset);
+        pkt_obj.store(std::forward<T>(value));
+        return {pkt_obj.status, pkt_obj.bit_offset - bit_offset};
+    }
+
+    // implementation details
+    namespace detail
+    {
+        /// @brief the size of a fixed size type's format, measured by its first object (see fixed_serialized_bits)
+        template <typename T>
+        struct fixed_size_cache
+        {
+            static status_t measured(const T &value)
+            {
+                static const status_t bits = serdes::serialized_bits(value);
+                return bits;
+            }
+        };
+    }
+
+    /// @brief [[sizing]] the serialized size of a type whose format stores the same bits for every object of it (no
+    /// arrays or strings with a runtime size, optional fields or runtime bit widths), measured by the sizing walk on
+    /// the first call for the type and then returned from a cache, so repeated sizing of fixed packet_base formats
+    /// costs nothing. The size is measured at bit offset 0, and is only correct for fixed size formats.
+    ///
+    /// Examples:\n
+    /// \code{.cpp}
+    ///     uint8_t buffer[64];
+    ///     if (serdes::fixed_serialized_bits(header).bits <= sizeof(buffer) * 8u)
+    ///         header.store(buffer);
+    /// \endcode
+    /// @tparam   T: any type that can be stored into a packet, with a fixed size format
+    /// @param    value: any object of the type (only the first one is measured)
+    /// @return   serdes::status_t: the status a store of the first object would end with, and its number of bits
+    template <typename T>
+    status_t fixed_serialized_bits(const T &value)
+    {
+        return detail::fixed_size_cache<T>::measured(value);
+    }
+
+    inline status_t packet_base::serialized_bits(size_t bit_offset) const
+    {
+        return serdes::serialized_bits(*this, bit_offset);
+    }
+
+    template <typename T_array, size_t N>
+    status_t packet_base::store(T_array (&target_buffer)[N], size_t max_elements, size_t bit_offset)
+    {
+        if (N < max_elements)
+            max_elements = N;
+        packet pkt_obj(serdes::sized_pointer<T_array>(&target_buffer[0], max_elements), bit_offset, mode_e::STORING);
+        format(pkt_obj);
+        return {pkt_obj.status, pkt_obj.bit_offset};
+    }
+
+    template <typename T_pointer, typename std::enable_if<std::is_pointer<T_pointer>::value, int *>::type>
+    status_t packet_base::store(T_pointer target_buffer, size_t max_elements, size_t bit_offset)
+    {
+        packet pkt_obj(serdes::sized_pointer<typename std::remove_pointer<T_pointer>::type>(target_buffer, max_elements), bit_offset, mode_e::STORING);
+        format(pkt_obj);
+        return {pkt_obj.status, pkt_obj.bit_offset};
+    }
+
+    template <typename T_sized_pointer, typename std::enable_if<serdes::detail::is_sized_pointer<T_sized_pointer>::value, int *>::type>
+    status_t packet_base::store(T_sized_pointer target_buffer, size_t bit_offset)
+    {
+        packet pkt_obj(target_buffer, bit_offset, mode_e::STORING);
+        format(pkt_obj);
+        return {pkt_obj.status, pkt_obj.bit_offset};
+    }
+    template <typename T_array, size_t N>
+    status_t packet_base::load(const T_array (&source_buffer)[N], size_t max_elements, size_t bit_offset)
     {
         if (N < max_elements)
             max_elements = N;
@@ -1301,6 +2562,82 @@ namespace serdes
     {
         return load(std::forward<T>(value));
     }
+
+    template <typename Derived>
+    template <typename T_array, size_t N>
+    status_t static_packet_base<Derived>::store(T_array (&target_buffer)[N], size_t max_elements, size_t bit_offset)
+    {
+        if (N < max_elements)
+            max_elements = N;
+        packet pkt_obj(serdes::sized_pointer<T_array>(&target_buffer[0], max_elements), bit_offset, mode_e::STORING);
+        derived().format(pkt_obj);
+        return {pkt_obj.status, pkt_obj.bit_offset};
+    }
+    template <typename Derived>
+    template <typename T_pointer, typename std::enable_if<std::is_pointer<T_pointer>::value, int *>::type>
+    status_t static_packet_base<Derived>::store(T_pointer target_buffer, size_t max_elements, size_t bit_offset)
+    {
+        packet pkt_obj(serdes::sized_pointer<typename std::remove_pointer<T_pointer>::type>(target_buffer, max_elements), bit_offset, mode_e::STORING);
+        derived().format(pkt_obj);
+        return {pkt_obj.status, pkt_obj.bit_offset};
+    }
+    template <typename Derived>
+    template <typename T_sized_pointer, typename std::enable_if<serdes::detail::is_sized_pointer<T_sized_pointer>::value, int *>::type>
+    status_t static_packet_base<Derived>::store(T_sized_pointer target_buffer, size_t bit_offset)
+    {
+        packet pkt_obj(target_buffer, bit_offset, mode_e::STORING);
+        derived().format(pkt_obj);
+        return {pkt_obj.status, pkt_obj.bit_offset};
+    }
+    template <typename Derived>
+    template <typename T_array, size_t N>
+    status_t static_packet_base<Derived>::load(const T_array (&source_buffer)[N], size_t max_elements, size_t bit_offset)
+    {
+        if (N < max_elements)
+            max_elements = N;
+        packet pkt_obj(serdes::sized_pointer<const T_array>(&source_buffer[0], max_elements), bit_offset, mode_e::LOADING);
+        derived().format(pkt_obj);
+        return {pkt_obj.status, pkt_obj.bit_offset};
+    }
+    template <typename Derived>
+    template <typename T_pointer, typename std::enable_if<std::is_pointer<T_pointer>::value, int *>::type>
+    status_t static_packet_base<Derived>::load(const T_pointer source_buffer, size_t max_elements, size_t bit_offset)
+    {
+        packet pkt_obj(serdes::sized_pointer<const typename std::remove_pointer<T_pointer>::type>(source_buffer, max_elements), bit_offset, mode_e::LOADING);
+        derived().format(pkt_obj);
+        return {pkt_obj.status, pkt_obj.bit_offset};
+    }
+    template <typename Derived>
+    template <typename T_sized_pointer, typename std::enable_if<serdes::detail::is_sized_pointer<T_sized_pointer>::value, int *>::type>
+    status_t static_packet_base<Derived>::load(const T_sized_pointer source_buffer, size_t bit_offset)
+    {
+        packet pkt_obj(source_buffer, bit_offset, mode_e::LOADING);
+        derived().format(pkt_obj);
+        return {pkt_obj.status, pkt_obj.bit_offset};
+    }
+    template <typename Derived>
+    status_t static_packet_base<Derived>::serialized_bits(size_t bit_offset) const
+    {
+        return serdes::serialized_bits(*this, bit_offset);
+    }
+    template <typename Derived>
+    template <typename T>
+    CPP_SERDES_LIB_PACKET_API_INLINE1 status_t static_packet_base<Derived>::operator>>(T &&value)
+    {
+        return store(std::forward<T>(value));
+    }
+    template <typename Derived>
+    template <typename T>
+    CPP_SERDES_LIB_PACKET_API_INLINE1 status_t static_packet_base<Derived>::operator<<(T &&value)
+    {
+        return load(std::forward<T>(value));
+    }
 }
 
+// compile time schemas, incremental loading, segmented packets, and word sinks build on the complete packet definition above
+#include "serdes_static_format.h"
+#include "serdes_incremental_load.h"
+#include "serdes_segmented_packet.h"
+#include "serdes_word_sink.h"
+
 #endif // _SERDES_H_
@@ -0,0 +1,256 @@
+/// @file serdes_bit_stream.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines bit_stream_packet, a loading packet that decodes its plain fields with a 64 bit refill
+/// accumulator, for sequentially loading dense bitpacked streams. This header isn't included by serdes.h, include
+/// it to use it.
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _SERDES_BIT_STREAM_H_
+#define _SERDES_BIT_STREAM_H_
+
+#include "serdes.h"
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    /// @brief a loading packet whose element type is known at compile time (like a typed_packet), that loads its
+    /// plain values and bitpacks with a classic bit reader: the unread bits are kept left aligned in a 64 bit
+    /// accumulator, fields are peeled off its top with a shift, and it's refilled (with a single big endian 64 bit
+    /// read for byte buffers) once it runs low, instead of locating every field's element and masking it from
+    /// scratch.
+    ///
+    /// It's still a serdes::packet: "void format(serdes::packet&)" methods, arrays, formatters, validators, and
+    /// little endian or LSB first fields use the packet implementation, and types with a templated
+    /// "template <typename T_packet> void format(T_packet&)" method are handed the bit_stream_packet itself. The
+    /// accumulator follows the bit offset, so after anything else moves it (including setting bit_offset directly)
+    /// it's refilled from the new bit offset. A field that doesn't fit fails with EXCEEDED_SERIAL_SIZE, exactly like
+    /// a packet's, and nothing past the buffer is read.
+    ///
+    /// Examples:\n
+    /// \code{.cpp}
+    ///     serdes::bit_stream_packet<uint8_t> pkt(capture, capture_size);
+    ///     while (pkt.status == serdes::status_e::NO_ERROR && pkt.bit_offset < end_of_samples)
+    ///         pkt >> serdes::bitpack<int16_t, int>(sample, 12);
+    /// \endcode
+    /// @tparam   T_array: the buffer's element type (uint8_t, uint16_t, uint32_t, or uint64_t)
+    template <typename T_array>
+    struct bit_stream_packet : packet
+    {
+        static_assert(std::is_integral<T_array>::value && !std::is_signed<T_array>::value && sizeof(T_array) <= 8u &&
+                          std::is_same<T_array, typename std::remove_cv<T_array>::type>::value,
+                      "bit_stream_packet requires an unsigned integral buffer element type of up to 64 bits");
+
+        /// @brief Construct a new bit stream packet object from an c style array pointer, in LOADING mode
+        /// @param    array_init: an array pointer (without size)
+        /// @param    max_elements: the maximum number of elements to use in the array
+        /// @param    b_offset: bit offset to start loading at
+        bit_stream_packet(const T_array *array_init, size_t max_elements, size_t b_offset = 0)
+            : packet(array_init, max_elements, b_offset, mode_e::LOADING) {}
+
+        /// @brief Construct a new bit stream packet object from a c style array, in LOADING mode
+        /// @tparam   N: the size of the array
+        /// @param    array_init: the array
+        /// @param    max_elements: the maximum number of elements to use in the array (can be <= N)
+        /// @param    b_offset: bit offset to start loading at
+        template <size_t N>
+        bit_stream_packet(const T_array (&array_init)[N], size_t max_elements = ~size_t(0), size_t b_offset = 0)
+            : packet(array_init, max_elements, b_offset, mode_e::LOADING) {}
+
+        /// @brief Construct a new bit stream packet object from an sized_pointer array for size safety, in LOADING mode
+        /// @param    array_init: an array with size information
+        /// @param    b_offset: bit offset to start loading at
+        bit_stream_packet(sized_pointer<const T_array> array_init, size_t b_offset = 0)
+            : packet(array_init, b_offset, mode_e::LOADING) {}
+
+        bit_stream_packet(const bit_stream_packet &) = delete;
+        bit_stream_packet &operator=(const bit_stream_packet &) = delete;
+
+        /// @brief [[deserialize]] loads from the serial buffer (same as packet::load, but with values and bitpacks
+        /// read from the accumulator, and format methods resolved against the bit_stream_packet)
+        /// @tparam   T: type of the target value to load into
+        /// @param    value: target value to load into
+        /// @param    args: optional arguments (such as the number of bits)
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void load(T &&value, Args &&...args)
+        {
+            // plain values can only be loaded into non-const lvalues, anything else is left to packet to reject
+            constexpr int route = detail::typed_packet_route<T>::value;
+            constexpr bool writable = std::is_lvalue_reference<T>::value && !std::is_const<typename std::remove_reference<T>::type>::value;
+            load_route(std::integral_constant<int, (route == 1 && !writable) ? 0 : route>{}, std::forward<T>(value), std::forward<Args>(args)...);
+        }
+
+        /// @brief adds a field to the serial format, which a bit_stream_packet always loads (same as load)
+        /// @tparam   T: value type
+        /// @param    x: value
+        /// @param    args: optional arguments (the number of bits, or a validation function)
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void add(T &&x, Args &&...args)
+        {
+            add_route(std::integral_constant<bool, detail::typed_packet_route<T>::value != 0 && detail::typed_packet_bits_args<Args...>::value>{},
+                      std::forward<T>(x), std::forward<Args>(args)...);
+        }
+
+        /// @brief [[deserialize]] loads serial data into the passed value (same as load)
+        /// @tparam   T: value type
+        /// @param    x: value reference
+        /// @return   bit_stream_packet&: resulting modified packet process
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 bit_stream_packet &operator>>(T &&x)
+        {
+            load(std::forward<T>(x));
+            return *this;
+        }
+
+#if (defined(__GNUC__) && !defined(__clang__))
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Weffc++"
+#endif
+        /// @brief adds a field to the serial format (same as add())
+        /// @tparam   T: value type
+        /// @param    value: value
+        /// @return   bit_stream_packet&: modified packet process after the add
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 bit_stream_packet &operator+(T &&value)
+        {
+            add(std::forward<T>(value));
+            return *this;
+        }
+#if (defined(__GNUC__) && !defined(__clang__))
+#pragma GCC diagnostic pop
+#endif
+
+    private:
+        static constexpr size_t bits_per_T_array = sizeof(T_array) * 8u;
+        uint64_t reader_bits = 0u;  ///< the unread bits, left aligned (the bits after them are zeros)
+        size_t reader_count = 0u;   ///< number of unread bits in reader_bits
+        size_t reader_end = 0u;     ///< serial bit offset of the first bit after them
+
+        /// @brief moves serial bits into the accumulator (from the bit offset, if something else moved it), as
+        /// many as fit in it (or are left in the buffer)
+        __attribute__((always_inline)) inline void refill() noexcept
+        {
+            if (reader_end - reader_count != bit_offset)
+            {
+                reader_bits = 0u;
+                reader_count = 0u;
+                reader_end = bit_offset;
+            }
+            const T_array *const source = static_cast<const T_array *>(buffer.value);
+            const size_t end_bit = bit_capacity;
+#ifndef configBITCPY_DISABLE_WIDE_ACCESS
+            if (sizeof(T_array) == 1u && (reader_end >> 3) + 8u <= (end_bit >> 3))
+            {
+                // 64 bits from the byte reader_end is in, whose bits before reader_end are shifted out (so at
+                // least 57 bits are added, as whole bytes past it)
+                const size_t skipped = reader_end & 7u;
+                const size_t added = 64u - (reader_count > skipped ? reader_count : skipped);
+                reader_bits |= (detail::load_big_endian_u64(reinterpret_cast<const uint8_t *>(&source[reader_end >> 3])) << skipped) >> reader_count;
+                reader_count += added;
+                reader_end += added;
+                return;
+            }
+#endif
+            while (reader_end < end_bit)
+            {
+                const size_t skipped = reader_end % bits_per_T_array;
+                const size_t available = bits_per_T_array - skipped;
+                if (available > 64u - reader_count)
+                    return;
+                const uint64_t element = static_cast<uint64_t>(source[reader_end / bits_per_T_array]) << (64u - bits_per_T_array);
+                reader_bits |= (element << skipped) >> reader_count;
+                reader_count += available;
+                reader_end += available;
+            }
+        }
+
+        /// @brief takes the next "bits" (up to the number of unread bits) off the top of the accumulator
+        __attribute__((always_inline)) inline uint64_t take(const size_t bits) noexcept
+        {
+            const uint64_t value = reader_bits >> (64u - bits);
+            reader_bits = bits < 64u ? reader_bits << bits : 0u;
+            reader_count -= bits;
+            return value;
+        }
+
+        /// @brief reads the next "bits" (1 to 64), which must be inside the buffer
+        __attribute__((always_inline)) inline uint64_t read(const size_t bits) noexcept
+        {
+            if (reader_count < bits || reader_end - reader_count != bit_offset)
+                refill();
+            if (reader_count >= bits)
+                return take(bits);
+            return read_across_refill(bits);
+        }
+
+        /// @brief reads a field that's split across a refill (only 64 bit elements, or fields of over 57 bits, can be)
+        __attribute__((noinline)) uint64_t read_across_refill(const size_t bits) noexcept
+        {
+            const size_t high_bits = reader_count;
+            const uint64_t high = high_bits != 0u ? take(high_bits) : 0u;
+            bit_offset += high_bits;
+            refill();
+            bit_offset -= high_bits;
+            return (high << (bits - high_bits)) | take(bits - high_bits);
+        }
+
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void load_route(std::integral_constant<int, 0>, T &&value, Args &&...args)
+        {
+            packet::load(std::forward<T>(value), std::forward<Args>(args)...);
+        }
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void load_route(std::integral_constant<int, 1>, T &value, size_t bits = detail::default_bitsize<T>::value)
+        {
+            if (status != status_e::NO_ERROR)
+                return;
+            ensure_load();
+            if (bit_order != bit_order_e::MSB_FIRST || endian != endian_e::BIG || bits == 0u || bits > sizeof(T) * 8u)
+                return packet::load(value, bits);
+            if (bit_offset > bit_capacity || bits > bit_capacity - bit_offset)
+            {
+                status = status_e::EXCEEDED_SERIAL_SIZE;
+                return;
+            }
+            load_value(value, read(bits), bits);
+            bit_offset += bits;
+        }
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void load_route(std::integral_constant<int, 2>, T &&value)
+        {
+            load(value.value, value.bits);
+        }
+        template <typename T>
+        CPP_SERDES_LIB_PACKET_API_INLINE2 void load_route(std::integral_constant<int, 3>, T &&value)
+        {
+            if (status != status_e::NO_ERROR)
+                return;
+            ensure_load();
+            std::forward<T>(value).format(*this);
+        }
+
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void add_route(std::false_type, T &&x, Args &&...args)
+        {
+            packet::add(std::forward<T>(x), std::forward<Args>(args)...);
+        }
+        template <typename T, typename... Args>
+        CPP_SERDES_LIB_PACKET_API_INLINE1 void add_route(std::true_type, T &&x, Args &&...args)
+        {
+            load(std::forward<T>(x), std::forward<Args>(args)...);
+        }
+
+        /// @brief stores a read field into a value, like bitcpy does (sign extending signed integers)
+        template <typename T>
+        static inline void load_value(T &value, const uint64_t bits_read, const size_t bits) noexcept
+        {
+            detail::store_unpacked_element(value, bits_read, bits);
+        }
+        static inline void load_value(bool &value, const uint64_t bits_read, const size_t) noexcept
+        {
+            value = bits_read != 0u;
+        }
+    };
+}
+
+#endif // _SERDES_BIT_STREAM_H_
@@ -0,0 +1,82 @@
+/// @file serdes_bitset.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines std::bitset support (a custom_type specialization). This header isn't included by serdes.h (so
+/// serdes.h doesn't bring in <bitset>), include it to serialize bitsets.
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _SERDES_BITSET_H_
+#define _SERDES_BITSET_H_
+
+#include <bitset>
+#include "serdes.h"
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    /// @brief std::bitset support: a bitset is formatted as an N bit unsigned value, so bit N-1 is the most
+    /// significant bit, in up to 64 bit chunks. MSB first big endian packets serialize the most significant chunk
+    /// first (the bitset reads as one big number), little endian and LSB first packets serialize the least
+    /// significant chunk first (matching their layout of wide values). Bitsets that don't fit aren't touched.
+    template <size_t N>
+    struct custom_type<std::bitset<N>>
+    {
+        static void format(packet &pkt, std::bitset<N> &item)
+        {
+            if (pkt.mode == mode_e::LOADING)
+                load(pkt, item);
+            else
+                format(pkt, static_cast<const std::bitset<N> &>(item));
+        }
+
+        static void format(packet &pkt, const std::bitset<N> &item)
+        {
+            if (!fits(pkt))
+                return;
+            const std::bitset<N> chunk_mask(~uint64_t(0));
+            for (size_t serialized_bits = 0; serialized_bits < N; serialized_bits += 64u)
+            {
+                const size_t chunk_bits = chunk_size(serialized_bits);
+                pkt.store(((item >> chunk_shift(pkt, serialized_bits, chunk_bits)) & chunk_mask).to_ullong(), chunk_bits);
+            }
+        }
+
+    private:
+        static void load(packet &pkt, std::bitset<N> &item)
+        {
+            if (!fits(pkt))
+                return;
+            std::bitset<N> result;
+            for (size_t serialized_bits = 0; serialized_bits < N; serialized_bits += 64u)
+            {
+                const size_t chunk_bits = chunk_size(serialized_bits);
+                uint64_t chunk = 0u;
+                pkt.load(chunk, chunk_bits);
+                result |= std::bitset<N>(chunk) << chunk_shift(pkt, serialized_bits, chunk_bits);
+            }
+            item = result;
+        }
+
+        static bool fits(packet &pkt) noexcept
+        {
+            const size_t capacity = pkt.serial_bit_capacity();
+            if (pkt.status == status_e::NO_ERROR && (pkt.bit_offset > capacity || N > capacity - pkt.bit_offset))
+                pkt.status = status_e::EXCEEDED_SERIAL_SIZE;
+            return pkt.status == status_e::NO_ERROR;
+        }
+
+        static constexpr size_t chunk_size(const size_t serialized_bits) noexcept
+        {
+            return N - serialized_bits < 64u ? N - serialized_bits : 64u;
+        }
+
+        static size_t chunk_shift(const packet &pkt, const size_t serialized_bits, const size_t chunk_bits) noexcept
+        {
+            if (pkt.bit_order == bit_order_e::MSB_FIRST && pkt.endian == endian_e::BIG)
+                return N - serialized_bits - chunk_bits;
+            return serialized_bits;
+        }
+    };
+}
+
+#endif // _SERDES_BITSET_H_
@@ -16,6 +16,14 @@
 /// @brief CppSerdes library namespace
 namespace serdes
 {
+    /// @brief one piece of serial data that's split across several buffers (see segmented_packet), with the same
+    /// members (in the same order) as a POSIX iovec, so a segment list can be passed to readv/writev
+    struct buffer_segment
+    {
+        void *data;  ///< start of the segment
+        size_t size; ///< number of bytes in the segment
+    };
+
     /// @brief allows iteration through the bytes of a buffer, even when the buffer's
     /// underlying type is not a byte array, but instead something larger like a uin32_t[].
     class byte_iterator_type
@@ -40,10 +48,18 @@ namespace serdes
             {
                 if (p_parent != nullptr)
                 {
+                    // segmented serial data is iterated one segment at a time
+                    if (p_parent->segments != nullptr)
+                    {
+                        p_parent->seek_segment();
+                        p_parent->start_index = p_parent->segment_first_byte + p_parent->segments[p_parent->segment_index].size;
+                        if (p_parent->start_index >= p_parent->end_plus_one_index)
+                            p_parent = nullptr;
+                    }
                     // for element_size == 1 or for big endian machines, the data is already in
                     // correctly ordered byte form, so it doesn't need to be iterated over
                     // and we can exit here immediately by setting p_parent == nullptr.
-                    if (p_parent->buffer.element_size == 1 || !detail::on_little_endian_platform())
+                    else if (p_parent->buffer.element_size == 1 || !detail::on_little_endian_platform())
                     {
                         p_parent = nullptr;
                     }
@@ -68,6 +84,15 @@ namespace serdes
                     return current_segment;
                 }
                 auto &p       = *p_parent;
+                if (p.segments != nullptr)
+                {
+                    p.seek_segment();
+                    const buffer_segment &segment  = p.segments[p.segment_index];
+                    const size_t segment_end_index = p.segment_first_byte + segment.size;
+                    current_segment.bytes     = static_cast<uint8_t *>(segment.data) + (p.start_index - p.segment_first_byte);
+                    current_segment.num_bytes = (segment_end_index < p.end_plus_one_index ? segment_end_index : p.end_plus_one_index) - p.start_index;
+                    return current_segment;
+                }
                 uint8_t *data = reinterpret_cast<uint8_t *>(p.buffer.value);
                 if (detail::on_little_endian_platform())
                 {
@@ -113,14 +138,28 @@ namespace serdes
         sized_pointer<void> &buffer;
         size_t start_index;
         size_t end_plus_one_index;
+        const buffer_segment *segments = nullptr; ///< the segment list of a segmented_packet, otherwise nullptr
+        size_t segment_index = 0u;                ///< the segment holding start_index
+        size_t segment_first_byte = 0u;           ///< byte index of the first byte of that segment (non zero for the sliding segment of a word_sink_packet)
         inline byte_iterator_type(
             sized_pointer<void> &data_arg,
             size_t starting_byte,
-            size_t ending_byte)
+            size_t ending_byte,
+            const buffer_segment *segment_list = nullptr,
+            size_t segment_list_first_byte = 0u)
             : buffer{data_arg},
               start_index{starting_byte},
-              end_plus_one_index{ending_byte}
+              end_plus_one_index{ending_byte},
+              segments{segment_list},
+              segment_first_byte{segment_list_first_byte}
+        {
+        }
+
+        /// @brief moves forward to the segment holding start_index
+        inline void seek_segment()
         {
+            while (start_index - segment_first_byte >= segments[segment_index].size)
+                segment_first_byte += segments[segment_index++].size;
         }
     };
 
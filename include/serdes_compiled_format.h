@@ -0,0 +1,614 @@
+/// @file serdes_compiled_format.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines compiled_format, which records an object's format() once into a flat list of operations, and
+/// replays it for every object of the same type without walking the format. This header isn't included by
+/// serdes.h, include it to use it (with configCPP_SERDES_ENABLE_FORMAT_RECORDING defined wherever serdes.h is
+/// included, which adds the recording hooks to the packet).
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _SERDES_COMPILED_FORMAT_H_
+#define _SERDES_COMPILED_FORMAT_H_
+
+#include "serdes.h"
+
+#ifndef configCPP_SERDES_ENABLE_FORMAT_RECORDING
+#error "compiled_format records formats through the packet's recording hooks, define configCPP_SERDES_ENABLE_FORMAT_RECORDING (before every include of serdes.h) to add them"
+#endif
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    // implementation details
+    namespace detail
+    {
+        /// @brief the operations of a compiled_format: fields by their element type, pads, and aligns
+        enum class compiled_op_e : uint8_t
+        {
+            U8,
+            U16,
+            U32,
+            U64,
+            S8,
+            S16,
+            S32,
+            S64,
+            BOOL,
+            PAD,
+            ALIGN
+        };
+
+        /// @brief a recorded operation: "count" fields of "bits" bits each, starting "offset" bytes into the object
+        /// (or the bits of a pad, or the alignment of an align)
+        struct compiled_op
+        {
+            size_t offset;
+            size_t count;
+            size_t bits;
+            compiled_op_e type;
+            size_t position; ///< serial bits from the last align (or the start) to the first field, or to the align
+
+            bool operator==(const compiled_op &other) const noexcept
+            {
+                return offset == other.offset && count == other.count && bits == other.bits && type == other.type;
+            }
+        };
+
+        /// @brief true if T declares "static constexpr bool fixed_layout = true" (see compiled_format)
+        template <typename T, typename = void>
+        struct declares_fixed_layout : std::false_type
+        {
+        };
+        template <typename T>
+        struct declares_fixed_layout<T, typename std::enable_if<T::fixed_layout>::type> : std::true_type
+        {
+        };
+
+        /// @brief the packet backend a compiled_format records an object's format with: it has unbounded serial
+        /// bytes (stores are only counted, like a sizing_packet's, and loads read the fill byte), every field, align,
+        /// and data dependent construct is told to it (see packet::record_step), and the bits between them are
+        /// recorded as pads
+        struct format_recorder : packet
+        {
+            /// @brief Construct a new format recorder object
+            /// @param    object_init: the recorded object (every field must be inside it)
+            /// @param    object_size_init: size of the recorded object in bytes
+            /// @param    ops_init: the recorded operations
+            /// @param    max_ops_init: maximum number of recorded operations
+            /// @param    b_offset: bit offset to record at (only matters to aligns)
+            /// @param    m: the recorded mode (LOADING or STORING)
+            /// @param    fill_init: the byte every serial byte loads as
+            format_recorder(void *const object_init, const size_t object_size_init, compiled_op *const ops_init,
+                            const size_t max_ops_init, const size_t b_offset, const mode_e m, const uint8_t fill_init = 0u) noexcept
+                : packet(static_cast<uint8_t *>(nullptr), 0u, b_offset, m),
+                  object{static_cast<const unsigned char *>(object_init)},
+                  object_size{object_size_init},
+                  ops{ops_init},
+                  max_ops{max_ops_init},
+                  count{0u},
+                  expected_offset{b_offset},
+                  replayable{true},
+                  fill{fill_init},
+                  fill_bytes{}
+            {
+                recording = true;
+            }
+
+            format_recorder(const format_recorder &) = delete;
+            format_recorder &operator=(const format_recorder &) = delete;
+
+            /// @brief records the bits after the last step (a trailing pad)
+            /// @return   true if the recorded format can be replayed
+            bool finish() noexcept
+            {
+                record_gap();
+                return replayable && status == status_e::NO_ERROR;
+            }
+
+            const unsigned char *const object;
+            const size_t object_size;
+            compiled_op *const ops;
+            const size_t max_ops;
+            size_t count;           ///< number of recorded operations
+            size_t expected_offset; ///< the bit offset after the last step, if nothing else moved it
+            mutable bool replayable;
+
+        protected:
+            void record_step(const format_step &step) noexcept override
+            {
+                record_gap();
+                if (step.type == format_step_e::ALIGN)
+                {
+                    if (step.bits == 0u)
+                        replayable = false;
+                    else
+                    {
+                        append({0u, 1u, step.bits, compiled_op_e::ALIGN, 0u});
+                        expected_offset = bit_offset + (step.bits - bit_offset % step.bits) % step.bits;
+                    }
+                    return;
+                }
+                // fields are replayed in the default bit and byte order, by their offset in the object
+                const unsigned char *const first = static_cast<const unsigned char *>(step.field);
+                if (step.type == format_step_e::DATA_DEPENDENT ||
+                    bit_order != bit_order_e::MSB_FIRST || endian != endian_e::BIG ||
+                    step.bits == 0u || step.bits > step.element_size * 8u || step.element_size > 8u ||
+                    (step.element_size & (step.element_size - 1u)) != 0u ||
+                    first < object || first > object + object_size || step.count > (object + object_size - first) / step.element_size)
+                {
+                    replayable = false;
+                    return;
+                }
+                const compiled_op_e type = step.kind == field_kind_e::BOOL ? compiled_op_e::BOOL
+                                           : static_cast<compiled_op_e>((step.kind == field_kind_e::SIGNED ? 4u : 0u) +
+                                                                        (step.element_size == 1u ? 0u : step.element_size == 2u ? 1u : step.element_size == 4u ? 2u : 3u));
+                const size_t offset = static_cast<size_t>(first - object);
+                // a field that continues the last one (like the rest of an array) extends it
+                if (count != 0u && ops[count - 1u].type == type && ops[count - 1u].bits == step.bits &&
+                    ops[count - 1u].offset + ops[count - 1u].count * step.element_size == offset)
+                    ops[count - 1u].count += step.count;
+                else
+                    append({offset, step.count, step.bits, type, 0u});
+                expected_offset = bit_offset + step.count * step.bits;
+            }
+
+            detail::serial_window outside_buffer(const size_t, const size_t size, const size_t, const void *const, const size_t) noexcept override
+            {
+                if (mode != mode_e::LOADING)
+                    return {nullptr, size};
+                std::memset(fill_bytes, fill, sizeof(fill_bytes));
+                return {fill_bytes, size < sizeof(fill_bytes) ? size : sizeof(fill_bytes)};
+            }
+            size_t outside_bit_capacity() const noexcept override
+            {
+                return ~size_t(0);
+            }
+            detail::serial_segments outside_segments() const noexcept override
+            {
+                // byte iterators (and the CRCs calculated with them) depend on the serial bytes
+                replayable = false;
+                return {nullptr, 0u, ~size_t(0)};
+            }
+
+        private:
+            const uint8_t fill;
+            uint8_t fill_bytes[32]; ///< the window handed to every load (a field of up to 64 bits needs 9 bytes)
+
+            /// @brief records the bits skipped since the last step as a pad (moving back can't be replayed)
+            void record_gap() noexcept
+            {
+                if (bit_offset < expected_offset)
+                    replayable = false;
+                else if (bit_offset > expected_offset)
+                    append({0u, 1u, bit_offset - expected_offset, compiled_op_e::PAD, 0u});
+                expected_offset = bit_offset;
+            }
+
+            void append(const compiled_op &op) noexcept
+            {
+                if (count == max_ops)
+                {
+                    replayable = false;
+                    return;
+                }
+                ops[count++] = op;
+            }
+        };
+    }
+
+    template <typename T_object, size_t MaxOps>
+    struct compiled_format_binding;
+
+    /// @brief an object's format() recorded once into a flat list of operations (field offsets in the object, widths,
+    /// and types, pads, and aligns), which is then replayed in a tight loop for any object of the same type, instead
+    /// of walking the format and locating every field's serial element from scratch.
+    ///
+    /// Compiling is an explicit opt-in: the type declares "static constexpr bool fixed_layout = true;", promising
+    /// that its format doesn't branch on its values, or take a field's bits, an array's size, or anything else
+    /// about its layout from them (the replay uses whatever the format did while recording, a runtime bits argument
+    /// is captured as the value it had). The format is recorded through a packet backend that's told about every
+    /// step (see packet::record_step), which needs configCPP_SERDES_ENABLE_FORMAT_RECORDING defined wherever
+    /// serdes.h is included: that adds a recording flag to the packet, and a check of it to the out of line packet
+    /// backend paths, aligns, and the data dependent constructs below (the fields copied to/from a buffer aren't
+    /// checked).
+    ///
+    /// The promise is checked where the recording can tell. The data dependent constructs (serdes::array with a
+    /// referenced size, delimited arrays, containers, validators, formatters, custom types, CRCs, fields outside of
+    /// the object, and little endian or LSB first fields) are detected. The format is also recorded loading serial
+    /// data of all zeros and of all ones, which must record the same operations as storing the prototype, so a
+    /// branch on a loaded value (or bits taken from one) is detected when those loads take it differently. Either
+    /// way, the compiled_format then simply calls the object's format() every time.
+    ///
+    /// The recorded operations are replayed into a packet's buffer in the default bit and byte order, when the whole
+    /// format fits. Otherwise (and for packet backends, like a segmented_packet) format() is called, so partial
+    /// stores and errors are the same.
+    ///
+    /// Examples:\n
+    /// \code{.cpp}
+    ///     struct sensor_record : serdes::packet_base
+    ///     {
+    ///         static constexpr bool fixed_layout = true;
+    ///         ...
+    ///     };
+    ///     static const serdes::compiled_format<sensor_record> compiled(sensor_record{});
+    ///     serdes::packet(buffer) << compiled.bind(record);
+    ///     compiled.load(record, buffer);
+    /// \endcode
+    /// @tparam   T_object: the type with a "void format(serdes::packet&)" method (usually derived from packet_base),
+    /// declaring fixed_layout
+    /// @tparam   MaxOps: maximum number of recorded operations, larger formats are never replayed
+    template <typename T_object, size_t MaxOps = 32>
+    struct compiled_format
+    {
+        static_assert(detail::has_format_method<T_object &>::value, "compiled_format requires a type with a \"void format(serdes::packet&)\" method");
+        static_assert(detail::declares_fixed_layout<T_object>::value,
+                      "compiled_format requires the type to declare \"static constexpr bool fixed_layout = true;\" (its format's layout doesn't depend on its values)");
+        static_assert(std::is_copy_constructible<T_object>::value, "compiled_format records the format of copies of the prototype");
+
+        /// @brief records the format of copies of the prototype object: storing, and loading serial data of all
+        /// zeros and of all ones (at another bit offset, so aligns can be told apart from pads), which must all
+        /// record the same operations
+        /// @param    prototype: any object of the type (the stored one is recorded)
+        explicit compiled_format(const T_object &prototype) noexcept
+            : ops{},
+              num_ops{0u},
+              fixed_bits{0u},
+              align_slack{0u},
+              tail_bits{0u},
+              has_align{false},
+              is_replayable{false}
+        {
+            T_object stored(prototype);
+            detail::format_recorder storing(&stored, sizeof(T_object), ops, MaxOps, 0u, mode_e::STORING);
+            storing.store(stored);
+            is_replayable = storing.finish();
+            num_ops = storing.count;
+            for (const uint8_t fill : {uint8_t(0x00u), uint8_t(0xFFu)})
+            {
+                T_object loaded(prototype);
+                detail::compiled_op loading_ops[MaxOps];
+                detail::format_recorder loading(&loaded, sizeof(T_object), loading_ops, MaxOps, 13u, mode_e::LOADING, fill);
+                loading.load(loaded);
+                is_replayable = loading.finish() && is_replayable && loading.count == num_ops;
+                for (size_t i = 0; i < num_ops && is_replayable; i++)
+                    is_replayable = ops[i] == loading_ops[i];
+            }
+            for (size_t i = 0; i < num_ops; i++)
+            {
+                ops[i].position = tail_bits;
+                if (ops[i].type == detail::compiled_op_e::ALIGN)
+                {
+                    has_align = true;
+                    align_slack += ops[i].bits - 1u;
+                    tail_bits = 0u;
+                }
+                else
+                {
+                    fixed_bits += ops[i].bits * ops[i].count;
+                    tail_bits += ops[i].bits * ops[i].count;
+                }
+            }
+        }
+
+        /// @brief returns true if the format was recorded, false if it falls back to calling format()
+        inline bool replayable() const noexcept { return is_replayable; }
+
+        /// @brief returns the number of recorded operations
+        inline size_t size() const noexcept { return num_ops; }
+
+        /// @brief binds an object to the compiled format, so it can be used with any packet operator
+        /// @param    object: object to serialize or deserialize
+        /// @return   compiled_format_binding: a temporary with a format(packet&) method
+        compiled_format_binding<T_object, MaxOps> bind(T_object &object) const noexcept
+        {
+            return compiled_format_binding<T_object, MaxOps>{*this, object};
+        }
+
+        /// @brief binds a const object to the compiled format, which can only be stored
+        /// @param    object: object to serialize
+        /// @return   compiled_format_binding: a temporary with a format(packet&) method
+        compiled_format_binding<const T_object, MaxOps> bind(const T_object &object) const noexcept
+        {
+            return compiled_format_binding<const T_object, MaxOps>{*this, object};
+        }
+
+        /// @brief [[serialize]] stores an object into a serial array
+        /// @param    object: the object to serialize
+        /// @param    target_buffer: the target serial array
+        /// @param    bit_offset: the starting bit offset
+        /// @return   serdes::status_t: the store process's resulting status
+        template <typename T_array, size_t N>
+        status_t store(const T_object &object, T_array (&target_buffer)[N], size_t bit_offset = 0) const
+        {
+            packet pkt(target_buffer, N, bit_offset, mode_e::STORING);
+            pkt.store(bind(object));
+            return {pkt.status, pkt.bit_offset};
+        }
+
+        /// @brief [[deserialize]] loads an object from a serial array
+        /// @param    object: the object to deserialize into
+        /// @param    source_buffer: the source serial array
+        /// @param    bit_offset: the starting bit offset
+        /// @return   serdes::status_t: the load process's resulting status
+        template <typename T_array, size_t N>
+        status_t load(T_object &object, const T_array (&source_buffer)[N], size_t bit_offset = 0) const
+        {
+            packet pkt(source_buffer, N, bit_offset, mode_e::LOADING);
+            pkt.load(bind(object));
+            return {pkt.status, pkt.bit_offset};
+        }
+
+        /// @brief [[serialize]] replays the recorded operations into the packet, or calls format() if they can't be
+        /// replayed (the format is data dependent, or doesn't fit, or the packet isn't in the default bit and byte
+        /// order, or is a packet backend)
+        void store(const T_object &object, packet &pkt) const
+        {
+            if (!fits(pkt))
+                return const_cast<T_object &>(object).format(pkt);
+            const unsigned char *const base = reinterpret_cast<const unsigned char *>(&object);
+            switch (pkt.buffer.element_size)
+            {
+            case 1u:
+                return replay_store<uint8_t>(base, pkt);
+            case 2u:
+                return replay_store<uint16_t>(base, pkt);
+            case 4u:
+                return replay_store<uint32_t>(base, pkt);
+            default:
+                return replay_store<uint64_t>(base, pkt);
+            }
+        }
+
+        /// @brief [[deserialize]] replays the recorded operations from the packet, or calls format() if they can't be
+        /// replayed (see store)
+        void load(T_object &object, packet &pkt) const
+        {
+            if (!fits(pkt))
+                return object.format(pkt);
+            unsigned char *const base = reinterpret_cast<unsigned char *>(&object);
+            switch (pkt.buffer.element_size)
+            {
+            case 1u:
+#ifndef configBITCPY_DISABLE_WIDE_ACCESS
+                // 9 bytes can be read at any field
+                if (((pkt.bit_offset + fixed_bits + align_slack) >> 3) + 9u <= (pkt.bit_capacity >> 3))
+                    return replay_load_windows(base, pkt);
+#endif
+                return replay_load(base, pkt, detail::bit_reader<uint8_t>(static_cast<const uint8_t *>(pkt.buffer.value), pkt.bit_offset));
+            case 2u:
+                return replay_load(base, pkt, detail::bit_reader<uint16_t>(static_cast<const uint16_t *>(pkt.buffer.value), pkt.bit_offset));
+            case 4u:
+                return replay_load(base, pkt, detail::bit_reader<uint32_t>(static_cast<const uint32_t *>(pkt.buffer.value), pkt.bit_offset));
+            default:
+                return replay_load(base, pkt, detail::bit_reader<uint64_t>(static_cast<const uint64_t *>(pkt.buffer.value), pkt.bit_offset));
+            }
+        }
+
+    private:
+        detail::compiled_op ops[MaxOps];
+        size_t num_ops;
+        size_t fixed_bits;  ///< total bits of all operations except aligns
+        size_t align_slack; ///< the most bits the aligns can add
+        size_t tail_bits;   ///< serial bits after the last align (or all of them)
+        bool has_align;
+        bool is_replayable;
+
+        /// @brief checks if the recorded operations can be replayed into the packet's buffer: capacity is checked
+        /// once for the whole format, so the replayed fields can't run out of space
+        bool fits(const packet &pkt) const noexcept
+        {
+            if (!is_replayable || pkt.bit_capacity == 0u || pkt.bit_order != bit_order_e::MSB_FIRST || pkt.endian != endian_e::BIG ||
+                pkt.bit_offset > pkt.bit_capacity)
+                return false;
+            const size_t available = pkt.bit_capacity - pkt.bit_offset;
+            if (!has_align || available >= fixed_bits + align_slack)
+                return fixed_bits <= available;
+            size_t end = pkt.bit_offset;
+            for (size_t i = 0; i < num_ops; i++)
+                end += ops[i].type == detail::compiled_op_e::ALIGN ? align_bits(ops[i].bits, end) : ops[i].bits * ops[i].count;
+            return end <= pkt.bit_capacity;
+        }
+
+        static size_t align_bits(const size_t alignment, const size_t bit_offset) noexcept
+        {
+            return (alignment - bit_offset % alignment) % alignment;
+        }
+
+        /// @brief [[serialize]] appends each field to a bit_writer, so every serial array element is written once.
+        /// Pads and aligns restart the writer, keeping the skipped bits.
+        template <typename T_array>
+        void replay_store(const unsigned char *const base, packet &pkt) const noexcept
+        {
+            T_array *const array = static_cast<T_array *>(pkt.buffer.value);
+            size_t bit_offset = pkt.bit_offset;
+            detail::bit_writer<T_array> writer(array, bit_offset);
+            for (size_t i = 0; i < num_ops; i++)
+            {
+                const detail::compiled_op &op = ops[i];
+                if (op.type == detail::compiled_op_e::PAD || op.type == detail::compiled_op_e::ALIGN)
+                {
+                    writer.flush();
+                    bit_offset += op.type == detail::compiled_op_e::PAD ? op.bits : align_bits(op.bits, bit_offset);
+                    writer = detail::bit_writer<T_array>(array, bit_offset);
+                    continue;
+                }
+                const unsigned char *field = base + op.offset;
+                const size_t size = element_size(op.type);
+                for (size_t n = 0; n < op.count; n++, field += size)
+                    writer.write(field_bits(field, op.type) & detail::bitmask<uint64_t>(op.bits), op.bits);
+                bit_offset += op.bits * op.count;
+            }
+            writer.flush();
+            pkt.bit_offset = bit_offset;
+        }
+
+        /// @brief [[deserialize]] reads each field from a bit_reader, so every serial array element is read once.
+        /// Pads and aligns restart the reader.
+        template <typename T_reader>
+        void replay_load(unsigned char *const base, packet &pkt, T_reader reader) const noexcept
+        {
+            size_t bit_offset = pkt.bit_offset;
+            for (size_t i = 0; i < num_ops; i++)
+            {
+                const detail::compiled_op &op = ops[i];
+                if (op.type == detail::compiled_op_e::PAD || op.type == detail::compiled_op_e::ALIGN)
+                {
+                    bit_offset += op.type == detail::compiled_op_e::PAD ? op.bits : align_bits(op.bits, bit_offset);
+                    reader = restart(reader, pkt, bit_offset);
+                    continue;
+                }
+                unsigned char *field = base + op.offset;
+                const size_t size = element_size(op.type);
+                for (size_t n = 0; n < op.count; n++, field += size)
+                    set_field(field, op.type, reader.read(op.bits), op.bits);
+                bit_offset += op.bits * op.count;
+            }
+            pkt.bit_offset = bit_offset;
+        }
+
+        template <typename T_array>
+        static detail::bit_reader<T_array> restart(const detail::bit_reader<T_array> &, const packet &pkt, const size_t bit_offset) noexcept
+        {
+            return detail::bit_reader<T_array>(static_cast<const T_array *>(pkt.buffer.value), bit_offset);
+        }
+
+#ifndef configBITCPY_DISABLE_WIDE_ACCESS
+        /// @brief [[deserialize]] reads each field of a byte array out of its own big endian 64 bit window, at its
+        /// recorded position from the last align, so the fields don't wait on each other (the windows must be
+        /// inside the array)
+        void replay_load_windows(unsigned char *const base, packet &pkt) const noexcept
+        {
+            const uint8_t *const source = static_cast<const uint8_t *>(pkt.buffer.value);
+            size_t start = pkt.bit_offset;
+            for (size_t i = 0; i < num_ops; i++)
+            {
+                const detail::compiled_op &op = ops[i];
+                if (op.type == detail::compiled_op_e::PAD)
+                    continue;
+                if (op.type == detail::compiled_op_e::ALIGN)
+                {
+                    start += op.position;
+                    start += align_bits(op.bits, start);
+                    continue;
+                }
+                unsigned char *field = base + op.offset;
+                const size_t size = element_size(op.type);
+                for (size_t n = 0, bit = start + op.position; n < op.count; n++, bit += op.bits, field += size)
+                {
+                    const uint8_t *const bytes = &source[bit >> 3];
+                    const size_t shift = bit & 7u;
+                    uint64_t window = detail::load_big_endian_u64(bytes) << shift;
+                    if (op.bits > 57u) // the field can reach the 9th byte
+                        window |= ((static_cast<uint64_t>(bytes[8]) << 56u) >> (63u - shift)) >> 1u;
+                    set_field(field, op.type, window >> (64u - op.bits), op.bits);
+                }
+            }
+            pkt.bit_offset = start + tail_bits;
+        }
+#endif
+
+        static size_t element_size(const detail::compiled_op_e type) noexcept
+        {
+            return type == detail::compiled_op_e::BOOL ? sizeof(bool) : size_t(1u) << (static_cast<size_t>(type) & 3u);
+        }
+
+        /// @brief a field's raw value (only its low bits are stored, so every type is stored as the unsigned type of
+        /// the same size)
+        __attribute__((always_inline)) static inline uint64_t field_bits(const unsigned char *const field, const detail::compiled_op_e type) noexcept
+        {
+            switch (type)
+            {
+            case detail::compiled_op_e::U8:
+            case detail::compiled_op_e::S8:
+                return load_raw<uint8_t>(field);
+            case detail::compiled_op_e::U16:
+            case detail::compiled_op_e::S16:
+                return load_raw<uint16_t>(field);
+            case detail::compiled_op_e::U32:
+            case detail::compiled_op_e::S32:
+                return load_raw<uint32_t>(field);
+            case detail::compiled_op_e::BOOL:
+                return load_raw<bool>(field);
+            default:
+                return load_raw<uint64_t>(field);
+            }
+        }
+
+        /// @brief sets a field from its serial bits, like a packet does (sign extending signed fields)
+        __attribute__((always_inline)) static inline void set_field(unsigned char *const field, const detail::compiled_op_e type, const uint64_t value, const size_t bits) noexcept
+        {
+            switch (type)
+            {
+            case detail::compiled_op_e::U8:
+                return store_raw<uint8_t>(field, value, bits);
+            case detail::compiled_op_e::U16:
+                return store_raw<uint16_t>(field, value, bits);
+            case detail::compiled_op_e::U32:
+                return store_raw<uint32_t>(field, value, bits);
+            case detail::compiled_op_e::U64:
+                return store_raw<uint64_t>(field, value, bits);
+            case detail::compiled_op_e::S8:
+                return store_raw<int8_t>(field, value, bits);
+            case detail::compiled_op_e::S16:
+                return store_raw<int16_t>(field, value, bits);
+            case detail::compiled_op_e::S32:
+                return store_raw<int32_t>(field, value, bits);
+            case detail::compiled_op_e::S64:
+                return store_raw<int64_t>(field, value, bits);
+            default:
+                return store_raw<bool>(field, value != 0u, bits);
+            }
+        }
+
+        template <typename T>
+        static inline uint64_t load_raw(const unsigned char *const field) noexcept
+        {
+            T value;
+            std::memcpy(&value, field, sizeof(T));
+            return static_cast<uint64_t>(value);
+        }
+
+        template <typename T>
+        static inline void store_raw(unsigned char *const field, const uint64_t value, const size_t bits) noexcept
+        {
+            T element;
+            detail::store_unpacked_element(element, value, bits);
+            std::memcpy(field, &element, sizeof(T));
+        }
+    };
+
+    /// @brief an object bound to a compiled_format, with a format method so it can be used with any packet operator
+    /// @tparam   T_object: the bound object type (const objects can only be stored)
+    /// @tparam   MaxOps: the compiled_format's maximum number of operations
+    template <typename T_object, size_t MaxOps>
+    struct compiled_format_binding
+    {
+        const compiled_format<typename std::remove_const<T_object>::type, MaxOps> &compiled; ///< the recorded format
+        T_object &object;                                                                   ///< the bound object
+
+        /// @brief loads or stores the bound object, depending on the packet mode
+        /// @param    pkt: the packet to serialize into or deserialize from
+        void format(packet &pkt) const
+        {
+            if (pkt.status != status_e::NO_ERROR)
+                return;
+            if (pkt.mode == mode_e::LOADING)
+                load(pkt, std::is_const<T_object>{});
+            else
+                compiled.store(object, pkt);
+        }
+
+    private:
+        void load(packet &pkt, std::true_type /* const object */) const noexcept
+        {
+            pkt.status = status_e::NO_LOAD_TO_RVALUE;
+        }
+
+        void load(packet &pkt, std::false_type /* non-const object */) const
+        {
+            compiled.load(object, pkt);
+        }
+    };
+}
+
+#endif // _SERDES_COMPILED_FORMAT_H_
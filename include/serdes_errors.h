@@ -47,7 +47,21 @@ namespace serdes
         START_BYTE_PAST_CURRENT = 7,
 
         /// @brief a byte_iterator was passed a starting + number of bytes that was past the end of the buffer
-        NUM_BYTES_OVER_MAX= 8
+        NUM_BYTES_OVER_MAX= 8,
+
+        /// @brief an incremental_loader ran out of received data before the object was loaded,
+        /// loading continues when more data is fed to it
+        NEED_MORE_DATA = 9,
+
+        /// @brief a byte_iterator was passed a starting byte that a word_sink_packet already emitted to its sink,
+        /// only the bytes in its look-back window can still be iterated over
+        OUTSIDE_LOOK_BACK_WINDOW = 10,
+
+        /// @brief a record_reader reached the end of its source between records, so there are no more records
+        END_OF_RECORDS = 11,
+
+        /// @brief a record_reader loaded a record that used no serial data, so the reader can't move past it
+        EMPTY_RECORD = 12
     };
 
     /// @brief converts an error status enum to a c style string
@@ -76,6 +90,14 @@ namespace serdes
             return "START_BYTE_PAST_CURRENT";
         case status_e::NUM_BYTES_OVER_MAX:
             return "NUM_BYTES_OVER_MAX";
+        case status_e::NEED_MORE_DATA:
+            return "NEED_MORE_DATA";
+        case status_e::OUTSIDE_LOOK_BACK_WINDOW:
+            return "OUTSIDE_LOOK_BACK_WINDOW";
+        case status_e::END_OF_RECORDS:
+            return "END_OF_RECORDS";
+        case status_e::EMPTY_RECORD:
+            return "EMPTY_RECORD";
         default:
             return "(null)";
         }
@@ -1,6 +1,6 @@
 /// @file serdes_format_modifiers.h
 /// @author Darren V Levine (DarrenVLevine@gmail.com)
-/// @brief Defines format modification classes: align, pad, bitpack, array, delimited_array
+/// @brief Defines format modification classes: align, pad, bitpack, array, delimited_array, byte_order
 ///
 /// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
 ///
@@ -214,6 +214,105 @@ namespace serdes
         delimited_array(T &v, const elem_type &&d) noexcept : value{v.data()}, delimiter{std::move(d)}, max_size(v.size()) {}
     };
 
+    /// @brief the byte order used for multi-byte fields
+    enum class endian_e
+    {
+        /// @brief most significant byte first (the default)
+        BIG,
+
+        /// @brief least significant byte first (see little_endian_bitcpy for the exact layout)
+        LITTLE
+    };
+
+    /// @brief the bit numbering used for serial data
+    enum class bit_order_e
+    {
+        /// @brief bit 0 is the most significant bit of the first array element (the default)
+        MSB_FIRST,
+
+        /// @brief bit 0 is the least significant bit of the first array element, like CAN "Intel" signals
+        /// or USB HID reports (see lsb_first_bitcpy for the exact layout)
+        LSB_FIRST
+    };
+
+    /// @brief stores/loads a field (a value, bitpack, array, or type with a format method) in a specific
+    /// byte order, overriding the packet's default byte order (packet::endian) for just that field.
+    /// Create it with serdes::little_endian(field) or serdes::big_endian(field).
+    /// @tparam   T: the field type, a reference for lvalues (and held by value for rvalues)
+    template <typename T>
+    struct byte_order
+    {
+        /// @brief the field (or a reference to it)
+        T value;
+
+        /// @brief the byte order to use for the field
+        endian_e endian;
+    };
+
+    /// @brief stores/loads a field least significant byte first, for example:
+    /// "packet + serdes::little_endian(x) + serdes::little_endian(serdes::bitpack<uint32_t, int>(y, 24))".
+    /// The fields of an LSB first packet are already little endian (with LSB first bit numbering), so this only
+    /// changes fields in MSB first packets.
+    /// @tparam   T: the field type
+    /// @param    value: the field
+    /// @return   byte_order<T>: the field with its byte order
+    template <typename T>
+    constexpr byte_order<T> little_endian(T &&value) noexcept
+    {
+        return {std::forward<T>(value), endian_e::LITTLE};
+    }
+
+    /// @brief stores/loads a field most significant byte first, for use in packets that default to little endian.
+    /// In an LSB first packet the field is also copied with MSB first bit numbering (exactly like in an MSB first
+    /// packet), which is how a CAN DBC Motorola signal sits in a frame of Intel signals: on a byte boundary it fills
+    /// its bytes most significant byte first, and a signal whose most significant bit is bit i (0 = LSB) of byte b
+    /// starts at bit offset 8 * b + 7 - i.
+    /// @tparam   T: the field type
+    /// @param    value: the field
+    /// @return   byte_order<T>: the field with its byte order
+    template <typename T>
+    constexpr byte_order<T> big_endian(T &&value) noexcept
+    {
+        return {std::forward<T>(value), endian_e::BIG};
+    }
+
+    /// @brief a sequence of adjacent fields stored/loaded as one field. Created with serdes::group(fields...)
+    /// @tparam   T: the field types, references for lvalues (and held by value for rvalues)
+    template <typename... T>
+    struct field_group
+    {
+    };
+
+    /// @brief a sequence of adjacent fields stored/loaded as one field. Created with serdes::group(fields...)
+    /// @tparam   T: the first field type, a reference for lvalues (and held by value for rvalues)
+    /// @tparam   Rest: the remaining field types
+    template <typename T, typename... Rest>
+    struct field_group<T, Rest...>
+    {
+        /// @brief the first field (or a reference to it)
+        T value;
+
+        /// @brief the remaining fields
+        field_group<Rest...> rest;
+    };
+
+    /// @brief groups adjacent fields, so that "packet + serdes::group(id, flags, seq, len)" produces the
+    /// same serial data as "packet + id + flags + seq + len". When every field is an integer, bool, or enum
+    /// of its default bit length, and they total 64 bits or less, the group is assembled in a single word and
+    /// written/read with one bounds check and one bitcpy. Any other fields are stored/loaded one at a time.
+    /// @tparam   T: the field types
+    /// @param    fields: the fields, in serial order
+    /// @return   field_group<T...>: the grouped fields
+    constexpr field_group<> group() noexcept
+    {
+        return {};
+    }
+    template <typename T, typename... Rest>
+    constexpr field_group<T, Rest...> group(T &&value, Rest &&...rest) noexcept
+    {
+        return {std::forward<T>(value), group(std::forward<Rest>(rest)...)};
+    }
+
     struct packet_base;
     struct formatter;
     template <typename FieldType, typename FuncType>
@@ -245,6 +344,11 @@ namespace serdes
         {
             static constexpr size_t value = 0u;
         };
+        template <typename... T>
+        struct default_bitsize<field_group<T...>>
+        {
+            static constexpr size_t value = 0u;
+        };
         template <typename T>
         struct is_formatter : std::false_type
         {
@@ -290,6 +394,14 @@ namespace serdes
         struct is_format_modifier<delimited_array<T>> : std::true_type
         {
         };
+        template <typename T>
+        struct is_format_modifier<byte_order<T>> : std::true_type
+        {
+        };
+        template <typename... T>
+        struct is_format_modifier<field_group<T...>> : std::true_type
+        {
+        };
     }
 }
 
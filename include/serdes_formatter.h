@@ -7,17 +7,140 @@
 #ifndef _SERDES_FORMATTER_H_
 #define _SERDES_FORMATTER_H_
 
-#include <functional>
+#include <new>
 #include "bitcpy_common.h"
 
+// the number of bytes a serdes::formatter reserves inline for its callable (the lambda captures), formatters never
+// allocate, so a callable larger than this is rejected by a static_assert. init_formatter() only captures references
+// so the default is plenty, define this to grow it for custom formatter lambdas capturing large objects by value.
+#ifndef configCPP_SERDES_FORMATTER_CAPACITY
+#define configCPP_SERDES_FORMATTER_CAPACITY (4u * sizeof(void *))
+#endif
+
 /// @brief CppSerdes library namespace
 namespace serdes
 {
     struct packet; // forward declaration
 
+    // implementation details
+    namespace detail
+    {
+        /// @brief a fixed capacity "void(packet &)" callable, like std::function but always stored inline. It never
+        /// allocates (including on copy or reassignment), and calls through a single function pointer
+        /// @tparam Capacity the number of bytes available for the callable object
+        template <size_t Capacity>
+        struct inline_formatter_function
+        {
+            inline_formatter_function() noexcept : storage(), invoker(nullptr), manager(nullptr) {}
+
+            inline_formatter_function(std::nullptr_t) noexcept : inline_formatter_function() {}
+
+            /// @brief constructs from a function pointer, a nullptr function pointer results in an empty object
+            inline_formatter_function(void (*function)(packet &)) noexcept : inline_formatter_function()
+            {
+                if (function != nullptr)
+                    emplace(function);
+            }
+
+            /// @brief constructs from any callable object (usually a lambda) which fits within the Capacity
+            template <typename F, typename std::enable_if<!std::is_same<typename std::decay<F>::type, inline_formatter_function>::value &&
+                                                              !std::is_pointer<typename std::decay<F>::type>::value &&
+                                                              !std::is_same<typename std::decay<F>::type, std::nullptr_t>::value,
+                                                          int *>::type = nullptr>
+            inline_formatter_function(F &&function) : inline_formatter_function()
+            {
+                emplace(std::forward<F>(function));
+            }
+
+            inline_formatter_function(const inline_formatter_function &other) : inline_formatter_function()
+            {
+                copy_from(other);
+            }
+
+            inline_formatter_function &operator=(const inline_formatter_function &other)
+            {
+                if (this != &other)
+                {
+                    reset();
+                    copy_from(other);
+                }
+                return *this;
+            }
+
+            ~inline_formatter_function()
+            {
+                reset();
+            }
+
+            /// @brief runs the stored callable, which must not be empty
+            void operator()(packet &pkt) const
+            {
+                invoker(storage, pkt);
+            }
+
+            explicit operator bool() const noexcept { return invoker != nullptr; }
+            friend bool operator==(const inline_formatter_function &f, std::nullptr_t) noexcept { return f.invoker == nullptr; }
+            friend bool operator==(std::nullptr_t, const inline_formatter_function &f) noexcept { return f.invoker == nullptr; }
+            friend bool operator!=(const inline_formatter_function &f, std::nullptr_t) noexcept { return f.invoker != nullptr; }
+            friend bool operator!=(std::nullptr_t, const inline_formatter_function &f) noexcept { return f.invoker != nullptr; }
+
+        private:
+            alignas(std::max_align_t) mutable unsigned char storage[Capacity];
+            void (*invoker)(void *, packet &);
+            // copies the callable into dest from source, or destroys dest if source is nullptr.
+            // left as nullptr for trivial callables, which are copied by memcpy and never destroyed
+            void (*manager)(void *, const void *);
+
+            template <typename F>
+            static void invoke(void *object, packet &pkt)
+            {
+                (*static_cast<F *>(object))(pkt);
+            }
+
+            template <typename F>
+            static void manage(void *dest, const void *source)
+            {
+                if (source != nullptr)
+                    ::new (dest) F(*static_cast<const F *>(source));
+                else
+                    static_cast<F *>(dest)->~F();
+            }
+
+            template <typename F>
+            void emplace(F &&function)
+            {
+                using callable = typename std::decay<F>::type;
+                static_assert(sizeof(callable) <= Capacity, "serdes::formatter callable is too large, reduce its captures or increase configCPP_SERDES_FORMATTER_CAPACITY");
+                static_assert(alignof(callable) <= alignof(std::max_align_t), "serdes::formatter callable is over aligned");
+                ::new (static_cast<void *>(storage)) callable(std::forward<F>(function));
+                invoker = &invoke<callable>;
+                manager = (std::is_trivially_copyable<callable>::value && std::is_trivially_destructible<callable>::value) ? nullptr : &manage<callable>;
+            }
+
+            void copy_from(const inline_formatter_function &other)
+            {
+                if (other.manager != nullptr)
+                    other.manager(storage, other.storage);
+                else if (other.invoker != nullptr)
+                    std::memcpy(storage, other.storage, Capacity);
+                invoker = other.invoker;
+                manager = other.manager;
+            }
+
+            void reset() noexcept
+            {
+                if (manager != nullptr)
+                    manager(storage, nullptr);
+                invoker = nullptr;
+                manager = nullptr;
+            }
+        };
+    }
+
     /// @brief a lambda function wrapper that can describe any serialization/deserialization formatting
     /// process. While it does use more overhead (because of the lambda), it also can describe any
-    /// format process as manipulatable runtime data, which the other hard coded interfaces don't allow.\n
+    /// format process as manipulatable runtime data, which the other hard coded interfaces don't allow.
+    /// The lambda is stored inline (never heap allocated) within configCPP_SERDES_FORMATTER_CAPACITY bytes.\n
     ///
     /// Examples:\n
     /// \code{.cpp}
@@ -32,7 +155,7 @@ namespace serdes
     struct formatter
     {
         /// @brief the formatting function taking a packet process (and any captures) as instructions
-        std::function<void(packet &)> formatter_lambda;
+        detail::inline_formatter_function<configCPP_SERDES_FORMATTER_CAPACITY> formatter_lambda;
     };
 
     /// @brief used to initialize a formatter object to be required but uninitialized.
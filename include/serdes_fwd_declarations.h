@@ -10,6 +10,7 @@
 ///   struct validator;
 ///   struct packet;
 ///   struct packet_base;
+///   struct static_packet_base<Derived>;
 ///
 /// This is useful when using object oriented design in header files that get included by a lot of other code.
 /// It will get you into trouble if you try to use the methods without including serdes.h first, you will get
@@ -101,6 +102,11 @@ namespace serdes
         template <typename T_sized_pointer, typename std::enable_if<serdes::detail::is_sized_pointer<T_sized_pointer>::value, int *>::type = nullptr>
         serdes::status_t load(const T_sized_pointer source_buffer, size_t bit_offset = 0);
 
+        /// @brief [[sizing]] walks the format() process without a buffer, to find the exact size store() would serialize
+        /// @param    bit_offset: the starting bit offset (only matters to aligns)
+        /// @return   serdes::status_t: the status a store would end with, and the number of bits it would store
+        serdes::status_t serialized_bits(size_t bit_offset = 0) const;
+
         /// @brief [[serialize]] stores the packet_base object into the passed serial data (same as store)
         /// @tparam   T: value type
         /// @param    value: serial buffer
@@ -117,5 +123,91 @@ namespace serdes
 
         virtual ~packet_base() = default;
     };
+
+    /// @brief inheritable base class with the same store/load API as packet_base, for types that are never used
+    /// polymorphically: the derived class's format method is called statically (CRTP), so objects carry no virtual
+    /// table pointer, and nested objects (including the elements of a serdes::array) have their formats inlined.
+    /// The derived class defines "void format(serdes::packet&)" (or a templated "format(T_packet&)"), without override.
+    /// @tparam   Derived: the class deriving from static_packet_base<Derived>
+    template <typename Derived>
+    struct static_packet_base
+    {
+        /// @brief [[serialize]] stores data into the target "sized" serial array according to the format() process
+        /// @tparam   T_array: the target buffer base type
+        /// @tparam   N: the size of the buffer
+        /// @param    target_buffer: the target serial data to store data into
+        /// @param    max_elements: the maximum number of elements to use in the array (can be <= N)
+        /// @param    bit_offset: the starting bit offset
+        /// @return   serdes::status_t: the store process's resulting status
+        template <typename T_array, size_t N>
+        serdes::status_t store(T_array (&target_buffer)[N], size_t max_elements = N, size_t bit_offset = 0);
+
+        /// @brief [[serialize]] stores data into the target (un-sized) pointer according to the format() process
+        /// @tparam   T_pointer: pointer type of the target buffer
+        /// @param    target_buffer: the target serial data to store data into
+        /// @param    max_elements: the maximum number of elements to use in the array
+        /// @param    bit_offset: the starting bit offset
+        /// @return   serdes::status_t: the store process's resulting status
+        template <typename T_pointer, typename std::enable_if<std::is_pointer<T_pointer>::value, int *>::type = nullptr>
+        serdes::status_t store(T_pointer target_buffer, size_t max_elements = ~size_t(0), size_t bit_offset = 0);
+
+        /// @brief [[serialize]] stores data into the target sized_pointer according to the format() process
+        /// @tparam   T_sized_pointer: the sized_pointer type of the target buffer
+        /// @param    target_buffer: the target serial data to store data into (holds info on its own size)
+        /// @param    bit_offset: the starting bit offset
+        /// @return   serdes::status_t: the store process's resulting status
+        template <typename T_sized_pointer, typename std::enable_if<serdes::detail::is_sized_pointer<T_sized_pointer>::value, int *>::type = nullptr>
+        serdes::status_t store(T_sized_pointer target_buffer, size_t bit_offset = 0);
+
+        /// @brief [[deserialize]] loads data from the source "sized" array according to the format() process
+        /// @tparam   T_array: the source buffer base type
+        /// @tparam   N: the size of the buffer
+        /// @param    source_buffer: the source serial data to read data from
+        /// @param    max_elements: the maximum number of elements to read in the array (can be <= N)
+        /// @param    bit_offset: the starting bit offset
+        /// @return   serdes::status_t: the load process's resulting status
+        template <typename T_array, size_t N>
+        serdes::status_t load(const T_array (&source_buffer)[N], size_t max_elements = N, size_t bit_offset = 0);
+
+        /// @brief [[deserialize]] loads data out of a source (un-sized) pointer according to the format() process
+        /// @tparam   T_pointer: the source buffer base type
+        /// @param    source_buffer: the source serial data to read data from
+        /// @param    max_elements: the maximum number of elements to read in the array
+        /// @param    bit_offset: the starting bit offset
+        /// @return   serdes::status_t: the load process's resulting status
+        template <typename T_pointer, typename std::enable_if<std::is_pointer<T_pointer>::value, int *>::type = nullptr>
+        serdes::status_t load(const T_pointer source_buffer, size_t max_elements = ~size_t(0), size_t bit_offset = 0);
+
+        /// @brief [[deserialize]] loads data out of a sized_pointer object according to the format() process
+        /// @tparam   T_sized_pointer: the source buffer sized_pointer type
+        /// @param    source_buffer: the source serial data to read data from
+        /// @param    bit_offset: the starting bit offset
+        /// @return   serdes::status_t: the load process's resulting status
+        template <typename T_sized_pointer, typename std::enable_if<serdes::detail::is_sized_pointer<T_sized_pointer>::value, int *>::type = nullptr>
+        serdes::status_t load(const T_sized_pointer source_buffer, size_t bit_offset = 0);
+
+        /// @brief [[sizing]] walks the format() process without a buffer, to find the exact size store() would serialize
+        /// @param    bit_offset: the starting bit offset (only matters to aligns)
+        /// @return   serdes::status_t: the status a store would end with, and the number of bits it would store
+        serdes::status_t serialized_bits(size_t bit_offset = 0) const;
+
+        /// @brief [[serialize]] stores the object into the passed serial data (same as store)
+        /// @tparam   T: value type
+        /// @param    value: serial buffer
+        /// @return   status_t: status of the store operation
+        template <typename T>
+        serdes::status_t operator>>(T &&value);
+
+        /// @brief [[deserialize]] loads the object from the passed serial data (same as load)
+        /// @tparam   T: value type
+        /// @param    value: serial buffer
+        /// @return   status_t: status of the load operation
+        template <typename T>
+        serdes::status_t operator<<(T &&value);
+
+    private:
+        /// @brief the derived object, whose format method is called directly
+        Derived &derived() noexcept { return static_cast<Derived &>(*this); }
+    };
 }
 #endif // _SERDES_FWD_DECLARATIONS_H_
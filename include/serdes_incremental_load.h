@@ -0,0 +1,203 @@
+/// @file serdes_incremental_load.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines incremental_loader, which loads an object from serial data that arrives in pieces (for
+/// example from a UART or a TCP stream), continuing where it ran out of data every time more data is fed to it
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _SERDES_INCREMENTAL_LOAD_H_
+#define _SERDES_INCREMENTAL_LOAD_H_
+
+#include "serdes.h"
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    /// @brief loads an object from serial data that arrives in pieces. Received bytes are appended to a staging
+    /// buffer (either copied by feed(), or received into free_space() and then passed to commit()), and loading
+    /// continues after every piece: status_e::NEED_MORE_DATA means the object needs more bytes, NO_ERROR means
+    /// it's loaded, and any other status is the error that stopped loading (like EXCEEDED_SERIAL_SIZE once the
+    /// staging buffer is full).
+    ///
+    /// The loader saves the serial byte where the last pass ran out of data, and the bytes the field there
+    /// needs: a commit that doesn't complete that field returns NEED_MORE_DATA without loading anything. A pass
+    /// still walks the object's format() from the start (so any format works, including data dependent ones),
+    /// but the fields and array elements of the object that lie before the saved byte were loaded by an earlier
+    /// pass, so they're only counted, not copied again: a large payload is unpacked once, no matter how many
+    /// pieces it arrives in. Fields that aren't members of the object (like temporaries) are loaded again. The
+    /// format mustn't move the bit offset back to reload an object member from later serial bytes.
+    ///
+    /// Examples:\n
+    /// \code{.cpp}
+    ///     uint8_t staging[512];
+    ///     serdes::incremental_loader<my_packet> loader(message, staging);
+    ///     while (loader.status() == serdes::status_e::NEED_MORE_DATA)
+    ///         loader.commit(read(fd, loader.free_space(), loader.free_bytes()));
+    /// \endcode
+    /// @tparam   T_object: the loaded type (anything a packet can load, usually derived from packet_base)
+    template <typename T_object>
+    struct incremental_loader
+    {
+        /// @brief Construct a new incremental loader, which hasn't received anything yet
+        /// @param    object: the object to load
+        /// @param    staging_buffer: holds the received bytes, so it limits the size of the serial data
+        /// @param    bit_offset: bit offset of the object in the serial data
+        template <size_t N>
+        incremental_loader(T_object &object, uint8_t (&staging_buffer)[N], size_t bit_offset = 0) noexcept
+            : incremental_loader(object, &staging_buffer[0], N, bit_offset) {}
+
+        /// @brief Construct a new incremental loader, which hasn't received anything yet
+        /// @param    object: the object to load
+        /// @param    staging_buffer: holds the received bytes, so it limits the size of the serial data
+        /// @param    staging_size: size of the staging buffer in bytes
+        /// @param    bit_offset: bit offset of the object in the serial data
+        incremental_loader(T_object &object, uint8_t *staging_buffer, size_t staging_size, size_t bit_offset = 0) noexcept
+            : loaded_object(object),
+              staging{staging_buffer},
+              staging_capacity{staging_size},
+              received{0u},
+              start_offset{bit_offset},
+              end_offset{bit_offset},
+              load_status{status_e::NEED_MORE_DATA},
+              saved_byte{0u},
+              stall_end{0u} {}
+
+        incremental_loader(const incremental_loader &) = delete;
+        incremental_loader &operator=(const incremental_loader &) = delete;
+
+        /// @brief copies received bytes into the staging buffer, and continues loading
+        /// @param    data: the received bytes
+        /// @param    size: number of received bytes (bytes that don't fit in the staging buffer are dropped)
+        /// @return   status_e: see status()
+        status_e feed(const void *data, size_t size) noexcept
+        {
+            if (size > free_bytes())
+                size = free_bytes();
+            if (size != 0u)
+                std::memcpy(free_space(), data, size);
+            return commit(size);
+        }
+
+        /// @brief continues loading after bytes were received directly into free_space()
+        /// @param    size: number of bytes received into free_space() (at most free_bytes())
+        /// @return   status_e: see status()
+        status_e commit(size_t size) noexcept
+        {
+            if (load_status != status_e::NEED_MORE_DATA)
+                return load_status;
+            received += size < free_bytes() ? size : free_bytes();
+            if (received < stall_end)
+                return load_status;
+            loading_packet pkt(*this);
+            pkt.load(loaded_object);
+            end_offset = pkt.bit_offset;
+            load_status = pkt.status;
+            if (stall_end > received)
+                saved_byte = pkt.stall_byte;
+            if (load_status == status_e::EXCEEDED_SERIAL_SIZE && received < staging_capacity)
+                load_status = status_e::NEED_MORE_DATA;
+            return load_status;
+        }
+
+        /// @brief NEED_MORE_DATA until the object is loaded (NO_ERROR), or loading failed (any other status)
+        status_e status() const noexcept
+        {
+            return load_status;
+        }
+
+        /// @brief the status and the bit offset just past the object (once it's loaded), like packet_base::load
+        status_t result() const noexcept
+        {
+            return {load_status, end_offset};
+        }
+
+        /// @brief where the next received bytes go, for receiving them without a copy (see commit())
+        uint8_t *free_space() const noexcept
+        {
+            return staging + received;
+        }
+
+        /// @brief number of bytes that can still be received
+        size_t free_bytes() const noexcept
+        {
+            return staging_capacity - received;
+        }
+
+        /// @brief number of received bytes that hold the loaded object, any bytes received after it (like the
+        /// start of the next message) are still in the staging buffer after them
+        size_t consumed_bytes() const noexcept
+        {
+            return load_status == status_e::NO_ERROR ? (end_offset + 7u) / 8u : 0u;
+        }
+
+        /// @brief number of received bytes
+        size_t received_bytes() const noexcept
+        {
+            return received;
+        }
+
+    private:
+        /// @brief the packet backend of a pass, serving the received bytes, and only counting the bytes of object
+        /// members that an earlier pass loaded
+        struct loading_packet : packet
+        {
+            explicit loading_packet(incremental_loader &owner) noexcept
+                : packet(static_cast<uint8_t *>(nullptr), 0u, owner.start_offset, mode_e::LOADING),
+                  loader(owner),
+                  received_segment{owner.staging, owner.received},
+                  stall_byte{0u}
+            {
+                loader.stall_end = 0u;
+            }
+
+            loading_packet(const loading_packet &) = delete;
+            loading_packet &operator=(const loading_packet &) = delete;
+
+            incremental_loader &loader;
+            const buffer_segment received_segment;
+            size_t stall_byte; ///< first byte of the field this pass ran out of data at
+
+        protected:
+            detail::serial_window outside_buffer(const size_t byte, const size_t, const size_t needed, const void *const field, const size_t field_size) noexcept override
+            {
+                const unsigned char *const object = reinterpret_cast<const unsigned char *>(&loader.loaded_object);
+                const unsigned char *const first = static_cast<const unsigned char *>(field);
+                if (byte < loader.saved_byte && needed <= loader.saved_byte - byte &&
+                    first >= object && first + field_size <= object + sizeof(T_object))
+                    return {nullptr, loader.saved_byte - byte};
+                if (byte >= loader.received || needed > loader.received - byte)
+                {
+                    if (loader.stall_end == 0u)
+                    {
+                        stall_byte = byte;
+                        loader.stall_end = byte + needed;
+                    }
+                    return {nullptr, 0u};
+                }
+                return {loader.staging + byte, loader.received - byte};
+            }
+
+            size_t outside_bit_capacity() const noexcept override
+            {
+                return loader.received * 8u;
+            }
+
+            detail::serial_segments outside_segments() const noexcept override
+            {
+                return {&received_segment, 0u, loader.received};
+            }
+        };
+
+        T_object &loaded_object;
+        uint8_t *const staging;
+        const size_t staging_capacity;
+        size_t received;
+        const size_t start_offset;
+        size_t end_offset;
+        status_e load_status;
+        size_t saved_byte; ///< the object's serial bytes before it were loaded by an earlier pass
+        size_t stall_end;  ///< the last pass ran out of data until this many bytes were received
+    };
+}
+
+#endif // _SERDES_INCREMENTAL_LOAD_H_
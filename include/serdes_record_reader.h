@@ -0,0 +1,318 @@
+/// @file serdes_record_reader.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines record_reader, which loads back-to-back records from a FILE*, a file descriptor, or a
+/// std::istream through a refillable window, optionally reading ahead on a background thread. This header isn't
+/// included by serdes.h (it brings in the C and C++ I/O headers), include it to use it.
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _SERDES_RECORD_READER_H_
+#define _SERDES_RECORD_READER_H_
+
+#include <cstdio>
+#include <istream>
+#include "serdes.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <cerrno>
+#include <unistd.h>
+#endif
+
+// define this to add the read-ahead thread of the record_reader (it brings in std::thread, so link with -pthread on
+// GCC and Clang)
+#ifdef configCPP_SERDES_ENABLE_READ_AHEAD_THREAD
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#endif
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    /// @brief where a record_reader reads its serial data from: a read function and the object it reads
+    struct byte_source
+    {
+        /// @brief reads up to "size" bytes into "dest"
+        /// @return   size_t: number of bytes read, 0 at the end of the data (or on a read error)
+        size_t (*read_function)(const byte_source &source, uint8_t *dest, size_t size);
+        void *object;   ///< the FILE, std::istream, or user object read from
+        int descriptor; ///< the file descriptor read from
+
+        size_t read(uint8_t *dest, size_t size) const
+        {
+            return read_function(*this, dest, size);
+        }
+    };
+
+    // implementation details
+    namespace detail
+    {
+        inline size_t read_file(const byte_source &source, uint8_t *dest, size_t size)
+        {
+            return std::fread(dest, 1u, size, static_cast<std::FILE *>(source.object));
+        }
+
+        inline size_t read_stream(const byte_source &source, uint8_t *dest, size_t size)
+        {
+            std::istream &stream = *static_cast<std::istream *>(source.object);
+            stream.read(reinterpret_cast<char *>(dest), static_cast<std::streamsize>(size));
+            return static_cast<size_t>(stream.gcount());
+        }
+
+#if defined(__unix__) || defined(__APPLE__)
+        inline size_t read_descriptor(const byte_source &source, uint8_t *dest, size_t size)
+        {
+            for (;;)
+            {
+                const ssize_t received = ::read(source.descriptor, dest, size);
+                if (received >= 0)
+                    return static_cast<size_t>(received);
+                if (errno != EINTR)
+                    return 0u;
+            }
+        }
+#endif
+    }
+
+    /// @brief reads serial data from a C file stream (opened in binary mode)
+    inline byte_source file_source(std::FILE *file) noexcept
+    {
+        return {&detail::read_file, static_cast<void *>(file), -1};
+    }
+
+    /// @brief reads serial data from a C++ input stream (opened in binary mode)
+    inline byte_source stream_source(std::istream &stream) noexcept
+    {
+        return {&detail::read_stream, static_cast<void *>(&stream), -1};
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    /// @brief reads serial data from a POSIX file descriptor (interrupted reads are retried)
+    inline byte_source descriptor_source(int descriptor) noexcept
+    {
+        return {&detail::read_descriptor, nullptr, descriptor};
+    }
+#endif
+
+    /// @brief loads back-to-back records (each starting on a byte boundary) from a byte_source, like a large
+    /// capture file, without reading all of it into memory. The records are loaded from a window buffer, and when
+    /// the next one doesn't fit in the unread part of the window, that part is moved to the front of the window and
+    /// the rest is refilled from the source.
+    ///
+    /// With configCPP_SERDES_ENABLE_READ_AHEAD_THREAD defined (and -pthread on GCC and Clang), the reader can also
+    /// take a read-ahead buffer: a background thread reads the source into its two halves (blocks) in turn, while
+    /// records are loaded from the window, and refilling the window copies the blocks that were read into it (so
+    /// the window should be larger than a block). The thread is stopped by the destructor, after its current read
+    /// returns. It only pays off when reads from the source block for long enough to overlap with the loads on
+    /// another core, and otherwise adds a copy and a lock per block, so measure it before using it.
+    ///
+    /// next() returns status_e::END_OF_RECORDS once the source ends between records. A record larger than the
+    /// window, or cut short by the end of the source, fails with EXCEEDED_SERIAL_SIZE. Any failed record (like one
+    /// with an INVALID_FIELD) is left unread, since the reader can't find where the next record starts. A record
+    /// whose format uses no serial data (like an empty delimited array on its own) fails with EMPTY_RECORD, rather
+    /// than being loaded from the same bytes forever.
+    ///
+    /// Examples:\n
+    /// \code{.cpp}
+    ///     static uint8_t window[1 << 16];
+    ///     std::FILE *capture = std::fopen("capture.bin", "rb");
+    ///     serdes::record_reader reader(serdes::file_source(capture), window);
+    ///     my_record record;
+    ///     while (reader.next(record).status == serdes::status_e::NO_ERROR)
+    ///         process(record);
+    /// \endcode
+    struct record_reader
+    {
+        /// @brief Construct a new record reader, which reads the source on the calling thread
+        /// @param    source: where the serial data is read from
+        /// @param    window_buffer: holds the serial data being loaded, so it limits the size of a record
+        template <size_t N>
+        record_reader(byte_source source, uint8_t (&window_buffer)[N])
+            : record_reader(source, &window_buffer[0], N) {}
+
+        /// @brief Construct a new record reader, which reads the source on the calling thread
+        /// @param    source: where the serial data is read from
+        /// @param    window_buffer: holds the serial data being loaded, so it limits the size of a record
+        /// @param    window_size: size of the window buffer in bytes
+        record_reader(byte_source source, uint8_t *window_buffer, size_t window_size)
+            : input{source},
+              window{window_buffer},
+              window_capacity{window_size} {}
+
+#ifdef configCPP_SERDES_ENABLE_READ_AHEAD_THREAD
+        /// @brief Construct a new record reader, which reads the source ahead on a background thread
+        /// @param    source: where the serial data is read from (only by the background thread)
+        /// @param    window_buffer: holds the serial data being loaded, so it limits the size of a record
+        /// @param    read_ahead_buffer: holds the blocks read ahead by the background thread
+        template <size_t N, size_t N2>
+        record_reader(byte_source source, uint8_t (&window_buffer)[N], uint8_t (&read_ahead_buffer)[N2])
+            : record_reader(source, &window_buffer[0], N, &read_ahead_buffer[0], N2) {}
+
+        /// @brief Construct a new record reader, which reads the source ahead on a background thread
+        /// @param    source: where the serial data is read from (only by the background thread)
+        /// @param    window_buffer: holds the serial data being loaded, so it limits the size of a record
+        /// @param    window_size: size of the window buffer in bytes
+        /// @param    read_ahead_buffer: holds the blocks read ahead by the background thread
+        /// @param    read_ahead_size: size of the read-ahead buffer in bytes
+        record_reader(byte_source source, uint8_t *window_buffer, size_t window_size, uint8_t *read_ahead_buffer, size_t read_ahead_size)
+            : input{source},
+              window{window_buffer},
+              window_capacity{window_size},
+              blocks{read_ahead_buffer},
+              block_capacity{read_ahead_size / 2u}
+        {
+            if (block_capacity != 0u)
+                read_ahead_thread = std::thread(&record_reader::read_ahead, this);
+        }
+#endif
+
+        record_reader(const record_reader &) = delete;
+        record_reader &operator=(const record_reader &) = delete;
+
+        ~record_reader()
+        {
+#ifdef configCPP_SERDES_ENABLE_READ_AHEAD_THREAD
+            if (read_ahead_thread.joinable())
+            {
+                {
+                    std::lock_guard<std::mutex> lock(block_mutex);
+                    stopping = true;
+                }
+                block_changed.notify_all();
+                read_ahead_thread.join();
+            }
+#endif
+        }
+
+        /// @brief loads the next record, refilling the window from the source as needed
+        /// @tparam   T_object: the record type (anything a packet can load, usually derived from packet_base)
+        /// @param    object: the loaded record
+        /// @return   status_t: the status (END_OF_RECORDS after the last record) and the bits of the record
+        template <typename T_object>
+        status_t next(T_object &object)
+        {
+            for (;;)
+            {
+                if (start == end && source_ended)
+                    return {status_e::END_OF_RECORDS, 0u};
+                packet pkt(&window[start], end - start, 0u, mode_e::LOADING);
+                pkt.load(object);
+                if (pkt.status == status_e::NO_ERROR)
+                {
+                    // the next record would start at the same byte, so every following next() would load it again
+                    if (pkt.bit_offset == 0u)
+                        return {status_e::EMPTY_RECORD, 0u};
+                    const size_t record_bytes = (pkt.bit_offset + 7u) / 8u;
+                    start += record_bytes;
+                    consumed += record_bytes;
+                    return {status_e::NO_ERROR, pkt.bit_offset};
+                }
+                // only a record that ran past the unread serial data can be loaded after a refill
+                if (pkt.status != status_e::EXCEEDED_SERIAL_SIZE)
+                    return {pkt.status, pkt.bit_offset};
+                if (!refill())
+                    return start == end && source_ended ? status_t{status_e::END_OF_RECORDS, 0u} : status_t{pkt.status, pkt.bit_offset};
+            }
+        }
+
+        /// @brief the byte offset of the next record in the source's serial data (the bytes of the loaded records)
+        size_t position() const noexcept
+        {
+            return consumed;
+        }
+
+    private:
+        const byte_source input;
+        uint8_t *const window;
+        const size_t window_capacity;
+        size_t start = 0u;          ///< first unread byte of the window
+        size_t end = 0u;            ///< end of the serial data in the window
+        size_t consumed = 0u;       ///< bytes of the loaded records
+        bool source_ended = false;  ///< set once the source has no more serial data for the window
+
+#ifdef configCPP_SERDES_ENABLE_READ_AHEAD_THREAD
+        uint8_t *const blocks = nullptr;   ///< the read-ahead buffer, as two blocks
+        const size_t block_capacity = 0u;  ///< size of each block, 0 without a read-ahead thread
+        size_t block_sizes[2] = {};        ///< serial data read into each block
+        bool block_read[2] = {};           ///< set by the thread once a block is read, cleared once it's copied
+        size_t copied_block = 0u;          ///< the block that's copied into the window next
+        size_t copied_bytes = 0u;          ///< bytes of that block already copied
+        bool stopping = false;             ///< set by the destructor
+        std::mutex block_mutex = {};
+        std::condition_variable block_changed = {};
+        std::thread read_ahead_thread = {};
+
+        /// @brief the background thread: reads the source into each block in turn, once it was copied into the
+        /// window, until the source ends
+        void read_ahead()
+        {
+            std::unique_lock<std::mutex> lock(block_mutex);
+            for (size_t next = 0u;; next ^= 1u)
+            {
+                block_changed.wait(lock, [this, next]() { return stopping || !block_read[next]; });
+                if (stopping)
+                    return;
+                lock.unlock();
+                const size_t size = input.read(&blocks[next * block_capacity], block_capacity);
+                lock.lock();
+                block_sizes[next] = size;
+                block_read[next] = true;
+                block_changed.notify_all();
+                if (size == 0u)
+                    return;
+            }
+        }
+#endif
+
+        /// @brief moves the unread serial data to the front of the window, and reads more after it
+        /// @return   true if more serial data was read
+        bool refill()
+        {
+            if (start != 0u)
+            {
+                std::memmove(window, &window[start], end - start);
+                end -= start;
+                start = 0u;
+            }
+            if (end == window_capacity || source_ended)
+                return false;
+            const size_t size = read(&window[end], window_capacity - end);
+            end += size;
+            source_ended = size == 0u;
+            return size != 0u;
+        }
+
+        /// @brief reads serial data into the window, from the read-ahead block or the source
+        size_t read(uint8_t *dest, size_t size)
+        {
+#ifdef configCPP_SERDES_ENABLE_READ_AHEAD_THREAD
+            if (block_capacity != 0u)
+            {
+                std::unique_lock<std::mutex> lock(block_mutex);
+                block_changed.wait(lock, [this]() { return block_read[copied_block]; });
+                // (copies every block that's already read, without waiting for more, an empty block ends the source)
+                size_t copied = 0u;
+                while (copied < size && block_read[copied_block] && block_sizes[copied_block] != 0u)
+                {
+                    const size_t available = block_sizes[copied_block] - copied_bytes;
+                    const size_t chunk = available < size - copied ? available : size - copied;
+                    std::memcpy(&dest[copied], &blocks[copied_block * block_capacity + copied_bytes], chunk);
+                    copied += chunk;
+                    copied_bytes += chunk;
+                    if (copied_bytes == block_sizes[copied_block])
+                    {
+                        block_read[copied_block] = false;
+                        copied_block ^= 1u;
+                        copied_bytes = 0u;
+                        block_changed.notify_all();
+                    }
+                }
+                return copied;
+            }
+#endif
+            return input.read(dest, size);
+        }
+    };
+}
+
+#endif // _SERDES_RECORD_READER_H_
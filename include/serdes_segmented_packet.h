@@ -0,0 +1,208 @@
+/// @file serdes_segmented_packet.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines segmented_packet, a packet over serial data that's split across a list of buffers (like the
+/// chained buffers of a network stack, or an iovec list for readv/writev), without copying it into one buffer
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _SERDES_SEGMENTED_PACKET_H_
+#define _SERDES_SEGMENTED_PACKET_H_
+
+#include "serdes.h"
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    /// @brief a packet over serial data that's split across a list of byte segments, which behave like one
+    /// contiguous buffer: fields (and arrays) can straddle segment boundaries, for both loading and storing.
+    /// The packet has no buffer of its own, so every field goes through the packet backend path (see
+    /// packet::outside_buffer): the segment of the last access is the packet's outside_span, so fields inside it
+    /// are copied in place by the usual bitcpy without asking the backend, arrays are copied a segment at a time
+    /// (with the bulk array kernels), and only the first field in each segment, and fields straddling a boundary
+    /// (through a small bounce buffer), cost a virtual call. Fields still take the out of line backend path, so a
+    /// small message can load faster by gathering its segments into one buffer first: a segmented_packet mostly
+    /// saves that buffer and copy.
+    ///
+    /// A buffer_segment has the same layout as a POSIX iovec, so received segments can come straight from readv,
+    /// and stored ones can go straight to writev (see filled_segments).
+    ///
+    /// Examples:\n
+    /// \code{.cpp}
+    ///     serdes::buffer_segment segments[] = {{header_buffer, 6}, {payload_buffer, 1024}};
+    ///     serdes::segmented_packet pkt(segments);
+    ///     pkt << message;
+    ///
+    ///     serdes::buffer_segment filled[2];
+    ///     writev(fd, reinterpret_cast<const iovec *>(filled), pkt.filled_segments(filled));
+    /// \endcode
+    struct segmented_packet : public packet
+    {
+        /// @brief Construct a new segmented packet object from a segment list
+        /// @tparam   N: number of segments
+        /// @param    segment_list: the segments, in serial order (empty segments are skipped)
+        /// @param    max_segments: the maximum number of segments to use in the list (can be <= N)
+        /// @param    b_offset: bit offset to start serdes process at
+        /// @param    m: starting mode (LOADING/STORING/UNSPECIFIED)
+        template <size_t N>
+        segmented_packet(const buffer_segment (&segment_list)[N], size_t max_segments = ~size_t(0), size_t b_offset = 0, mode_e m = mode_e::UNSPECIFIED) noexcept
+            : segmented_packet(&segment_list[0], max_segments < N ? max_segments : N, b_offset, m) {}
+
+        /// @brief Construct a new segmented packet object from a segment list pointer
+        /// @param    segment_list: the segments, in serial order (empty segments are skipped)
+        /// @param    count: number of segments
+        /// @param    b_offset: bit offset to start serdes process at
+        /// @param    m: starting mode (LOADING/STORING/UNSPECIFIED)
+        segmented_packet(const buffer_segment *segment_list, size_t count, size_t b_offset = 0, mode_e m = mode_e::UNSPECIFIED) noexcept
+            : packet(static_cast<uint8_t *>(nullptr), 0u, b_offset, m),
+              segments{segment_list},
+              segment_count{count},
+              bytes{total_bytes(segment_list, count)},
+              index{0u},
+              first_byte{0u},
+              bounce{},
+              bounce_byte{0u},
+              bounce_size{0u},
+              span{nullptr, 0u, 0u}
+        {
+            outside_span = &span;
+        }
+
+        segmented_packet(const segmented_packet &) = delete;
+        segmented_packet &operator=(const segmented_packet &) = delete;
+
+        /// @brief lists the serial data up to the current bit offset (including a partially filled last byte) as
+        /// segments, which can be passed to writev: the leading non-empty segments, with the last one shortened
+        /// @param    filled: where the segments are listed
+        /// @param    max_count: size of the filled list
+        /// @return   size_t: number of listed segments (0 if they don't fit in the filled list)
+        size_t filled_segments(buffer_segment *filled, size_t max_count) const noexcept
+        {
+            size_t remaining = (bit_offset + 7u) / 8u;
+            if (remaining > bytes)
+                remaining = bytes;
+            size_t count = 0u;
+            for (size_t i = 0; i < segment_count && remaining != 0u; ++i)
+            {
+                const buffer_segment &segment = segments[i];
+                if (segment.size == 0u)
+                    continue;
+                if (count == max_count)
+                    return 0u;
+                const size_t size = segment.size < remaining ? segment.size : remaining;
+                filled[count++] = {segment.data, size};
+                remaining -= size;
+            }
+            return count;
+        }
+
+        /// @brief lists the serial data up to the current bit offset as segments (see above)
+        /// @tparam   N: size of the filled list
+        /// @param    filled: where the segments are listed
+        /// @return   size_t: number of listed segments (0 if they don't fit in the filled list)
+        template <size_t N>
+        size_t filled_segments(buffer_segment (&filled)[N]) const noexcept
+        {
+            return filled_segments(&filled[0], N);
+        }
+
+    protected:
+        /// @brief the serial bytes from a byte on: the rest of its segment in place, or the bytes of a field that
+        /// straddles segments gathered into the bounce buffer (scattered back by outside_buffer_stored)
+        detail::serial_window outside_buffer(const size_t byte, const size_t, const size_t needed, const void *const, const size_t) noexcept override
+        {
+            bounce_size = 0u;
+            if (byte >= bytes || needed > bytes - byte || needed > sizeof(bounce))
+                return {nullptr, 0u};
+            seek(byte);
+            const size_t in_segment = first_byte + segments[index].size - byte;
+            if (needed <= in_segment)
+            {
+                span_segment();
+                return {segment_bytes(byte), in_segment};
+            }
+            bounce_byte = byte;
+            bounce_size = needed;
+            transfer(bounce_byte, bounce_size, false);
+            // (the fields after a straddling field start in the segment holding its last byte)
+            span_segment();
+            return {bounce, needed};
+        }
+
+        void outside_buffer_stored() noexcept override
+        {
+            if (bounce_size != 0u)
+                transfer(bounce_byte, bounce_size, true);
+        }
+
+        size_t outside_bit_capacity() const noexcept override
+        {
+            return bytes * 8u;
+        }
+
+        detail::serial_segments outside_segments() const noexcept override
+        {
+            return {segments, 0u, bytes};
+        }
+
+    private:
+        const buffer_segment *const segments; ///< the segment list
+        const size_t segment_count;           ///< number of segments in the list
+        const size_t bytes;                   ///< total size of all the segments
+        size_t index;                         ///< the segment of the last access
+        size_t first_byte;                    ///< serial byte offset of the segment of the last access
+        uint8_t bounce[32];                   ///< the bytes of a field straddling segments (up to 31 bytes)
+        size_t bounce_byte;                   ///< serial byte offset of the bounce buffer
+        size_t bounce_size;                   ///< bytes in the bounce buffer, 0 if the last window was in place
+        detail::serial_span span;             ///< the segment of the last access (see packet::outside_span)
+
+        static size_t total_bytes(const buffer_segment *const segment_list, const size_t count) noexcept
+        {
+            size_t total = 0u;
+            for (size_t i = 0; i < count; ++i)
+                total += segment_list[i].size;
+            return total;
+        }
+
+        /// @brief moves to the segment holding a serial byte (which must be less than "bytes")
+        void seek(const size_t byte) noexcept
+        {
+            while (byte < first_byte)
+                first_byte -= segments[--index].size;
+            while (byte - first_byte >= segments[index].size && index + 1u < segment_count)
+                first_byte += segments[index++].size;
+        }
+
+        /// @brief makes the segment of the last access the packet's outside_span, so the fields inside it are
+        /// copied without a virtual call
+        void span_segment() noexcept
+        {
+            span = {segment_bytes(first_byte), first_byte, first_byte + segments[index].size};
+        }
+
+        uint8_t *segment_bytes(const size_t byte) const noexcept
+        {
+            return static_cast<uint8_t *>(segments[index].data) + (byte - first_byte);
+        }
+
+        /// @brief copies serial bytes that straddle segments to the bounce buffer, or back to the segments
+        void transfer(size_t byte, size_t size, const bool to_segments) noexcept
+        {
+            uint8_t *copied = bounce;
+            while (size != 0u)
+            {
+                seek(byte);
+                const size_t available = first_byte + segments[index].size - byte;
+                const size_t chunk = size < available ? size : available;
+                if (to_segments)
+                    std::memcpy(segment_bytes(byte), copied, chunk);
+                else
+                    std::memcpy(copied, segment_bytes(byte), chunk);
+                copied += chunk;
+                byte += chunk;
+                size -= chunk;
+            }
+        }
+    };
+}
+
+#endif // _SERDES_SEGMENTED_PACKET_H_
@@ -0,0 +1,457 @@
+/// @file serdes_static_format.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines static_format, a compile time schema of struct member fields with every bit offset
+/// and the total serialized size known at compile time, compiled into straight-line load/store code
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _SERDES_STATIC_FORMAT_H_
+#define _SERDES_STATIC_FORMAT_H_
+
+#include "serdes.h"
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    namespace detail
+    {
+        /// @brief splits a pointer to data member type into its class and member types
+        template <typename T_member_pointer>
+        struct member_pointer_traits;
+        template <typename T_object, typename T_value>
+        struct member_pointer_traits<T_value T_object::*>
+        {
+            using object_type = T_object;
+            using value_type = T_value;
+        };
+    }
+
+    /// @brief a single field of a static_format: a pointer to data member and the number of bits it occupies
+    /// For example: member_field<decltype(&header::id), &header::id, 12> (or field<&header::id, 12> in C++17)
+    /// @tparam   T_member_pointer: type of the pointer to data member
+    /// @tparam   Member: the pointer to data member
+    /// @tparam   Bits: number of serialized bits, defaults to the full size of the member
+    template <typename T_member_pointer,
+              T_member_pointer Member,
+              size_t Bits = detail::default_bitsize<typename detail::member_pointer_traits<T_member_pointer>::value_type>::value>
+    struct member_field
+    {
+        using object_type = typename detail::member_pointer_traits<T_member_pointer>::object_type;
+        using value_type = typename detail::member_pointer_traits<T_member_pointer>::value_type;
+        static constexpr size_t bits = Bits;
+
+        static_assert(detail::supported_by_wide_bitcpy<value_type>::value,
+                      "static_format fields must be arithmetic or enum members of up to 64 bits");
+        static_assert(Bits > 0u && Bits <= sizeof(value_type) * 8u,
+                      "static_format field bits must be between 1 and the bit size of the member");
+
+        static constexpr const value_type &get(const object_type &object) noexcept { return object.*Member; }
+        static CONSTEXPR_ABOVE_CPP11 value_type &get(object_type &object) noexcept { return object.*Member; }
+    };
+    template <typename T_member_pointer, T_member_pointer Member, size_t Bits>
+    constexpr size_t member_field<T_member_pointer, Member, Bits>::bits;
+
+#if defined(__cpp_nontype_template_parameter_auto) && __cpp_nontype_template_parameter_auto >= 201606L
+    /// @brief C++17 shorthand for member_field, deducing the member pointer type: field<&header::id, 12>
+    template <auto Member, size_t Bits = detail::default_bitsize<typename detail::member_pointer_traits<decltype(Member)>::value_type>::value>
+    using field = member_field<decltype(Member), Member, Bits>;
+#endif
+
+    namespace detail
+    {
+        /// @brief compile time layout of a list of fields, starting at bit Offset relative to the format start
+        template <size_t Offset, typename... Fields>
+        struct static_fields
+        {
+            static constexpr size_t bits = 0u;
+            static constexpr bool byte_copyable = true;
+
+            template <size_t Base, typename T_array, typename T_object>
+            static CONSTEXPR_ABOVE_CPP11 void store(T_array *const, const T_object &) noexcept {}
+            template <size_t Base, typename T_array, typename T_object>
+            static CONSTEXPR_ABOVE_CPP11 void load(T_object &, const T_array *const) noexcept {}
+            template <typename T_array, typename T_object>
+            static void store_at(T_array *const, const T_object &, const size_t) noexcept {}
+            template <typename T_array, typename T_object>
+            static void load_at(T_object &, const T_array *const, const size_t) noexcept {}
+            template <typename T_buffer, typename T_object>
+            static void store_ordered(const bit_order_e, const endian_e, T_buffer &, const T_object &, const size_t) noexcept {}
+            template <typename T_object, typename T_buffer>
+            static void load_ordered(const bit_order_e, const endian_e, T_object &, T_buffer &, const size_t) noexcept {}
+            template <typename T_packet, typename T_object>
+            static void store_fields(T_packet &, const T_object &) noexcept {}
+            template <typename T_packet, typename T_object>
+            static void load_fields(T_packet &, T_object &) noexcept {}
+            template <typename T_object>
+            static bool contiguous(const T_object &, const unsigned char *const) noexcept { return true; }
+            static void byte_swap_copy(unsigned char *const, const unsigned char *const) noexcept {}
+        };
+
+        template <size_t Offset, typename Field, typename... Rest>
+        struct static_fields<Offset, Field, Rest...>
+        {
+            using next = static_fields<Offset + Field::bits, Rest...>;
+            using value_type = typename Field::value_type;
+            static constexpr size_t bits = Field::bits + next::bits;
+
+            /// @brief every field is a full width (non bool) value, so the serial layout is the member bytes back
+            /// to back, in big endian byte order
+            static constexpr bool byte_copyable = Field::bits == sizeof(value_type) * 8u &&
+                                                  !std::is_same<value_type, bool>::value && next::byte_copyable;
+
+            /// @brief straight-line store, every field position is a compile time constant
+            template <size_t Base, typename T_array, typename T_object>
+            static CONSTEXPR_ABOVE_CPP11 void store(T_array *const dest, const T_object &object) noexcept
+            {
+                bitcpy<Base + Offset, Field::bits>(dest, Field::get(object));
+                next::template store<Base>(dest, object);
+            }
+
+            /// @brief straight-line load, every field position is a compile time constant
+            template <size_t Base, typename T_array, typename T_object>
+            static CONSTEXPR_ABOVE_CPP11 void load(T_object &object, const T_array *const source) noexcept
+            {
+                bitcpy<Base + Offset, Field::bits>(Field::get(object), source);
+                next::template load<Base>(object, source);
+            }
+
+            /// @brief unrolled store at a run time base bit offset
+            template <typename T_array, typename T_object>
+            static void store_at(T_array *const dest, const T_object &object, const size_t base) noexcept
+            {
+                bitcpy(dest, Field::get(object), base + Offset, Field::bits);
+                next::store_at(dest, object, base);
+            }
+
+            /// @brief unrolled load at a run time base bit offset
+            template <typename T_array, typename T_object>
+            static void load_at(T_object &object, const T_array *const source, const size_t base) noexcept
+            {
+                bitcpy(Field::get(object), source, base + Offset, Field::bits);
+                next::load_at(object, source, base);
+            }
+
+            /// @brief unrolled store in a non default bit/byte order (see packet::endian and packet::bit_order)
+            template <typename T_buffer, typename T_object>
+            static void store_ordered(const bit_order_e bit_order, const endian_e endian, T_buffer &dest, const T_object &object, const size_t base) noexcept
+            {
+                ordered_store(bit_order, endian, dest, Field::get(object), base + Offset, Field::bits);
+                next::store_ordered(bit_order, endian, dest, object, base);
+            }
+
+            /// @brief unrolled load in a non default bit/byte order (see packet::endian and packet::bit_order)
+            template <typename T_object, typename T_buffer>
+            static void load_ordered(const bit_order_e bit_order, const endian_e endian, T_object &object, T_buffer &source, const size_t base) noexcept
+            {
+                ordered_load(bit_order, endian, Field::get(object), source, base + Offset, Field::bits);
+                next::load_ordered(bit_order, endian, object, source, base);
+            }
+
+            /// @brief stores the fields one at a time with the packet's checks, for a packet backend without a buffer
+            /// (see packet::outside_buffer)
+            template <typename T_packet, typename T_object>
+            static void store_fields(T_packet &pkt, const T_object &object) noexcept
+            {
+                pkt.store(Field::get(object), Field::bits);
+                next::store_fields(pkt, object);
+            }
+
+            /// @brief loads the fields one at a time with the packet's checks (see store_fields)
+            template <typename T_packet, typename T_object>
+            static void load_fields(T_packet &pkt, T_object &object) noexcept
+            {
+                pkt.load(Field::get(object), Field::bits);
+                next::load_fields(pkt, object);
+            }
+
+            /// @brief checks if every member is at the same byte offset (from the first) as its serialized field, without
+            /// any padding between them. The member offsets are constants, so this is folded away by the optimizer.
+            template <typename T_object>
+            static bool contiguous(const T_object &object, const unsigned char *const first) noexcept
+            {
+                return reinterpret_cast<const unsigned char *>(&Field::get(object)) == first + Offset / 8u &&
+                       next::contiguous(object, first);
+            }
+
+            /// @brief copies a byte_copyable layout, reversing the byte order of every field on the way
+            static void byte_swap_copy(unsigned char *const dest, const unsigned char *const source) noexcept
+            {
+                using word_type = typename unsigned_type_sizeof<sizeof(value_type)>::type;
+                word_type word;
+                std::memcpy(&word, source + Offset / 8u, sizeof(word));
+                word = byteswap(word);
+                std::memcpy(dest + Offset / 8u, &word, sizeof(word));
+                next::byte_swap_copy(dest, source);
+            }
+        };
+
+        /// @brief compile time offset, width, and type of the I'th field in a list of fields
+        template <size_t I, typename... Fields>
+        struct static_field_at;
+        template <typename Field, typename... Rest>
+        struct static_field_at<0u, Field, Rest...>
+        {
+            using field = Field;
+            static constexpr size_t offset = 0u;
+            static constexpr size_t width = Field::bits;
+        };
+        template <size_t I, typename Field, typename... Rest>
+        struct static_field_at<I, Field, Rest...>
+        {
+            using field = typename static_field_at<I - 1u, Rest...>::field;
+            static constexpr size_t offset = Field::bits + static_field_at<I - 1u, Rest...>::offset;
+            static constexpr size_t width = static_field_at<I - 1u, Rest...>::width;
+        };
+    }
+
+    template <typename T_format, typename T_object>
+    struct static_format_binding;
+
+    /// @brief a compile time serdes schema made of member_field's, where every field's bit offset and the total
+    /// serialized size are computed at compile time, and load/store compile down to straight-line shift/mask code.
+    /// A static_format can be nested in any dynamic format with bind(): packet.add(my_format::bind(object))
+    /// @tparam   Fields: the member_field's, in serialized order
+    template <typename... Fields>
+    struct static_format
+    {
+        static_assert(sizeof...(Fields) > 0u, "a static_format needs at least one field");
+
+        using layout = detail::static_fields<0u, Fields...>;
+        using first_field = typename detail::static_field_at<0u, Fields...>::field;
+
+        static constexpr size_t field_count = sizeof...(Fields); ///< number of fields in the format
+        static constexpr size_t bits = layout::bits;             ///< total number of serialized bits
+        static constexpr size_t bytes = (bits + 7u) / 8u;        ///< total number of serialized bytes (rounded up)
+
+        /// @brief true if every field is a full width, non bool member, so that a host struct with the same member
+        /// layout (see matches_host_layout) serializes as a single memcpy plus a byte swap of each field
+        static constexpr bool byte_copyable = layout::byte_copyable;
+
+        /// @brief checks if an object's members hold the fields back to back in serial order, without padding, so
+        /// the format is a bulk copy of the object's bytes (a compile time constant for the optimizer)
+        /// @param    object: an object of the bound type
+        /// @return   true if a byte_copyable format's serial data is the object's bytes in big endian field order
+        template <typename T_object>
+        static bool matches_host_layout(const T_object &object) noexcept
+        {
+            return byte_copyable && layout::contiguous(object, reinterpret_cast<const unsigned char *>(&first_field::get(object)));
+        }
+
+        /// @brief bit offset of the I'th field, relative to the start of the format
+        template <size_t I>
+        static constexpr size_t offset() noexcept
+        {
+            static_assert(I < sizeof...(Fields), "static_format field index out of range");
+            return detail::static_field_at<I, Fields...>::offset;
+        }
+
+        /// @brief number of serialized bits of the I'th field
+        template <size_t I>
+        static constexpr size_t width() noexcept
+        {
+            static_assert(I < sizeof...(Fields), "static_format field index out of range");
+            return detail::static_field_at<I, Fields...>::width;
+        }
+
+        /// @brief [[serialize]] stores an object into a serial array at a compile time bit offset, the size is
+        /// checked at compile time, so this cannot fail
+        /// @tparam   BitOffset: bit offset to start storing at
+        /// @param    object: the object to serialize
+        /// @param    dest: the destination serial array
+        /// @return   size_t: number of bits stored
+        template <size_t BitOffset = 0u, typename T_object, typename T_array, size_t N>
+        static CONSTEXPR_ABOVE_CPP11 size_t store(const T_object &object, T_array (&dest)[N]) noexcept
+        {
+            static_assert(BitOffset + bits <= N * sizeof(T_array) * 8u, "the static_format does not fit in the destination array");
+            layout::template store<BitOffset>(dest, object);
+            return bits;
+        }
+
+        /// @brief [[deserialize]] loads an object from a serial array at a compile time bit offset, the size is
+        /// checked at compile time, so this cannot fail
+        /// @tparam   BitOffset: bit offset to start loading from
+        /// @param    object: the object to deserialize into
+        /// @param    source: the source serial array
+        /// @return   size_t: number of bits loaded
+        template <size_t BitOffset = 0u, typename T_object, typename T_array, size_t N>
+        static CONSTEXPR_ABOVE_CPP11 size_t load(T_object &object, const T_array (&source)[N]) noexcept
+        {
+            static_assert(BitOffset + bits <= N * sizeof(T_array) * 8u, "the static_format does not fit in the source array");
+            layout::template load<BitOffset>(object, source);
+            return bits;
+        }
+
+        /// @brief binds an object to this format, so it can be nested inside a packet: packet.add(format::bind(object))
+        /// @param    object: object to serialize or deserialize (const objects can only be stored)
+        /// @return   static_format_binding: a temporary with a format(packet&) method
+        template <typename T_object>
+        static constexpr static_format_binding<static_format, T_object> bind(T_object &object) noexcept
+        {
+            return static_format_binding<static_format, T_object>{object};
+        }
+    };
+    template <typename... Fields>
+    constexpr size_t static_format<Fields...>::field_count;
+    template <typename... Fields>
+    constexpr size_t static_format<Fields...>::bits;
+    template <typename... Fields>
+    constexpr size_t static_format<Fields...>::bytes;
+    template <typename... Fields>
+    constexpr bool static_format<Fields...>::byte_copyable;
+
+    /// @brief an object bound to a static_format, with a format method so it can be used with any packet operator.
+    /// Checks the capacity once for the whole format, then writes every field without further checks (a packet backend
+    /// without a buffer, such as a sizing_packet, gets the fields one at a time instead).
+    /// @tparam   T_format: the static_format type
+    /// @tparam   T_object: the bound object type (may be const for storing only)
+    template <typename T_format, typename T_object>
+    struct static_format_binding
+    {
+        T_object &object; ///< the bound object
+
+        /// @brief loads or stores the bound object, depending on the packet mode
+        /// @param    pkt: the packet to serialize into or deserialize from
+        template <typename T_packet>
+        void format(T_packet &pkt) const
+        {
+            if (pkt.status != status_e::NO_ERROR)
+                return;
+            if (pkt.bit_offset > pkt.bit_capacity || T_format::bits > pkt.bit_capacity - pkt.bit_offset)
+                return format_outside_buffer(pkt);
+            if (pkt.mode == mode_e::LOADING)
+                load(pkt, std::is_const<T_object>{});
+            else
+                store(pkt);
+            if (pkt.status == status_e::NO_ERROR)
+                pkt.bit_offset += T_format::bits;
+        }
+
+    private:
+        /// @brief a format that doesn't fit in the buffer: nothing is written if it doesn't fit in the serial data
+        /// either, and a packet backend's serial bytes outside of its buffer get the fields one at a time
+        template <typename T_packet>
+        void format_outside_buffer(T_packet &pkt) const
+        {
+            const size_t capacity = pkt.serial_bit_capacity();
+            if (pkt.bit_capacity != 0u || pkt.bit_offset > capacity || T_format::bits > capacity - pkt.bit_offset)
+                pkt.status = status_e::EXCEEDED_SERIAL_SIZE;
+            else if (pkt.mode == mode_e::LOADING)
+                load_fields(pkt, std::is_const<T_object>{});
+            else
+                T_format::layout::store_fields(pkt, object);
+        }
+
+        template <typename T_packet>
+        void load_fields(T_packet &pkt, std::true_type /* const object */) const noexcept
+        {
+            pkt.status = status_e::NO_LOAD_TO_RVALUE;
+        }
+
+        template <typename T_packet>
+        void load_fields(T_packet &pkt, std::false_type /* non-const object */) const noexcept
+        {
+            T_format::layout::load_fields(pkt, object);
+        }
+
+        /// @brief byte aligned fields in a byte array, whose bound object holds them in the same layout (see
+        /// static_format::matches_host_layout), are copied as one block of bytes
+        bool host_layout_passthrough(const packet &pkt) const noexcept
+        {
+            return T_format::byte_copyable && pkt.buffer.element_size == 1u && pkt.bit_offset % 8u == 0u &&
+                   T_format::matches_host_layout(object);
+        }
+
+        /// @brief a single memcpy on big endian hosts, otherwise one pass of word sized byte swapping copies
+        static void copy_host_layout(unsigned char *const dest, const unsigned char *const source) noexcept
+        {
+            if (detail::on_little_endian_platform())
+                T_format::layout::byte_swap_copy(dest, source);
+            else
+                std::memcpy(dest, source, T_format::bytes);
+        }
+
+        void store(packet &pkt) const noexcept
+        {
+            if (pkt.bit_order != bit_order_e::MSB_FIRST || pkt.endian != endian_e::BIG)
+                return T_format::layout::store_ordered(pkt.bit_order, pkt.endian, pkt.buffer, object, pkt.bit_offset);
+            if (host_layout_passthrough(pkt))
+            {
+                copy_host_layout(reinterpret_cast<unsigned char *>(pkt.buffer.value) + pkt.bit_offset / 8u,
+                                 reinterpret_cast<const unsigned char *>(&T_format::first_field::get(object)));
+                return;
+            }
+            switch (pkt.buffer.element_size)
+            {
+            case 1u:
+                return store(reinterpret_cast<uint8_t *>(pkt.buffer.value), pkt.bit_offset);
+            case 2u:
+                return store(reinterpret_cast<uint16_t *>(pkt.buffer.value), pkt.bit_offset);
+            case 4u:
+                return store(reinterpret_cast<uint32_t *>(pkt.buffer.value), pkt.bit_offset);
+            default:
+                return store(reinterpret_cast<uint64_t *>(pkt.buffer.value), pkt.bit_offset);
+            }
+        }
+
+        /// @brief element aligned starts use the straight-line compile time offsets, others an unrolled run time copy
+        template <typename T_array>
+        void store(T_array *const dest, const size_t base) const noexcept
+        {
+            constexpr size_t bits_per_T_array = sizeof(T_array) * 8u;
+            if (base % bits_per_T_array == 0u)
+                T_format::layout::template store<0u>(dest + base / bits_per_T_array, object);
+            else
+                T_format::layout::store_at(dest, object, base);
+        }
+
+        void load(packet &pkt, std::true_type /* const object */) const noexcept
+        {
+            pkt.status = status_e::NO_LOAD_TO_RVALUE;
+        }
+
+        void load(packet &pkt, std::false_type /* non-const object */) const noexcept
+        {
+            if (pkt.bit_order != bit_order_e::MSB_FIRST || pkt.endian != endian_e::BIG)
+                return T_format::layout::load_ordered(pkt.bit_order, pkt.endian, object, pkt.buffer, pkt.bit_offset);
+            if (host_layout_passthrough(pkt))
+            {
+                copy_host_layout(reinterpret_cast<unsigned char *>(&T_format::first_field::get(object)),
+                                 reinterpret_cast<const unsigned char *>(pkt.buffer.value) + pkt.bit_offset / 8u);
+                return;
+            }
+            switch (pkt.buffer.element_size)
+            {
+            case 1u:
+                return load(reinterpret_cast<const uint8_t *>(pkt.buffer.value), pkt.bit_offset);
+            case 2u:
+                return load(reinterpret_cast<const uint16_t *>(pkt.buffer.value), pkt.bit_offset);
+            case 4u:
+                return load(reinterpret_cast<const uint32_t *>(pkt.buffer.value), pkt.bit_offset);
+            default:
+                return load(reinterpret_cast<const uint64_t *>(pkt.buffer.value), pkt.bit_offset);
+            }
+        }
+
+        template <typename T_array>
+        void load(const T_array *const source, const size_t base) const noexcept
+        {
+            constexpr size_t bits_per_T_array = sizeof(T_array) * 8u;
+            if (base % bits_per_T_array == 0u)
+                T_format::layout::template load<0u>(object, source + base / bits_per_T_array);
+            else
+                T_format::layout::load_at(object, source, base);
+        }
+    };
+
+    // implementation details
+    namespace detail
+    {
+        /// @brief a static_format binding's size is known at compile time (see static_packet)
+        template <typename T_format, typename T_object>
+        struct static_serialized_bits<static_format_binding<T_format, T_object>, void> : std::integral_constant<size_t, T_format::bits>
+        {
+        };
+    }
+}
+
+#endif // _SERDES_STATIC_FORMAT_H_
@@ -0,0 +1,250 @@
+/// @file serdes_word_sink.h
+/// @author Darren V Levine (DarrenVLevine@gmail.com)
+/// @brief Defines word_sink_packet, a storing packet that hands each completed word of its serial data to a sink
+/// (like a DMA FIFO or a socket) instead of keeping the whole serial data in a buffer, so it stores messages of any
+/// size in a fixed amount of memory, and write_once_packet, which writes each completed word to an array once
+///
+/// @copyright (c) 2021 Darren V Levine. This code is licensed under MIT license (see LICENSE file for details).
+///
+#ifndef _SERDES_WORD_SINK_H_
+#define _SERDES_WORD_SINK_H_
+
+#include "serdes.h"
+
+/// @brief CppSerdes library namespace
+namespace serdes
+{
+    /// @brief a storing packet that hands the words of its serial data (uint8_t, uint16_t, uint32_t or uint64_t,
+    /// holding the serial data in the same layout as a packet over an array of them) to a sink, as they slide out
+    /// of a fixed size window, so it stores messages of any size without an output buffer.
+    ///
+    /// Bit offsets are offsets in the whole serial data, like any packet. The window holds the word at the bit
+    /// offset and the N_look_back_words words before it, and those can still be stored to again (like a length
+    /// or CRC field that's back-patched after its message), or read by previous_bytes(start) and calculate_crc. A
+    /// word is handed to the sink once the window has to slide past it, so a back-patched field must be at most
+    /// N_look_back_words words behind the bit offset. Storing to a word that was already handed to the sink fails
+    /// with EXCEEDED_SERIAL_SIZE, and byte iterators starting in one fail with OUTSIDE_LOOK_BACK_WINDOW.
+    ///
+    /// Words are handed to the sink in batches, as "sink(const T_word *words, size_t count)", and finish() hands
+    /// over the rest of them (which isn't done by the destructor). The packet has no buffer of its own, so every
+    /// field is stored into the window by the packet backend path: the window is the packet's outside_span (see
+    /// packet::outside_span), so fields inside it are stored in place without asking the backend, and only a field
+    /// past its end costs a virtual call, which slides it. Arrays are packed a window at a time, and loading isn't
+    /// supported.
+    ///
+    /// Examples:\n
+    /// \code{.cpp}
+    ///     auto to_fifo = [&](const uint32_t *words, size_t count) { dma_fifo_write(words, count); };
+    ///     serdes::word_sink_packet<uint32_t, 64, 8> pkt(to_fifo);
+    ///     pkt << header << serdes::array<uint16_t, size_t>(samples, sample_count) << crc_field;
+    ///     pkt.finish();
+    /// \endcode
+    /// @tparam   T_word: the word type handed to the sink
+    /// @tparam   N_window_words: size of the window in words
+    /// @tparam   N_look_back_words: number of words before the bit offset kept in the window
+    template <typename T_word, size_t N_window_words, size_t N_look_back_words = 0u>
+    struct word_sink_packet : public packet
+    {
+        static_assert(std::is_unsigned<T_word>::value && detail::supported_by_bulk_bitcpy<T_word>::value && !std::is_same<T_word, bool>::value,
+                      "serdes::word_sink_packet words must be uint8_t, uint16_t, uint32_t or uint64_t");
+        static_assert((N_window_words - N_look_back_words - 1u) * sizeof(T_word) >= 16u && N_window_words > N_look_back_words,
+                      "serdes::word_sink_packet window needs room for its look-back words, the current word and a field (16 bytes)");
+
+        /// @brief Construct a new word sink packet object, in STORING mode
+        /// @tparam   T_sink: any callable as "sink(const T_word *words, size_t count)", like a lambda
+        /// @param    sink: receives the words, and is referenced (not copied) so it must outlive the packet
+        /// @param    b_offset: bit offset to start storing at (the bits before it are zeros)
+        template <typename T_sink>
+        explicit word_sink_packet(T_sink &sink, size_t b_offset = 0) noexcept
+            : packet(static_cast<uint8_t *>(nullptr), 0u, b_offset, mode_e::STORING),
+              window{},
+              segment{window, sizeof(window)},
+              first_byte{0u},
+              end_byte{~size_t(0)},
+              sink_object{static_cast<void *>(&sink)},
+              sink_call{&call_sink<T_sink>},
+              span{}
+        {
+            outside_span = &span;
+            update_span();
+        }
+
+        word_sink_packet(const word_sink_packet &) = delete;
+        word_sink_packet &operator=(const word_sink_packet &) = delete;
+
+        /// @brief aligns the bit offset to the next word, and hands every word before it to the sink (the bits of
+        /// the last word after the stored ones are zeros), storing can continue after it as a new message
+        void finish() noexcept
+        {
+            const size_t end_word = (bit_offset + word_bits - 1u) / word_bits;
+            if (end_word * word_bits > bit_offset)
+                bit_offset = end_word * word_bits;
+            if (end_word > emitted_words())
+                emit_words(end_word - emitted_words());
+        }
+
+        /// @brief the number of words handed to the sink so far
+        size_t emitted_words() const noexcept
+        {
+            return first_byte / sizeof(T_word);
+        }
+
+    protected:
+        /// @brief the window bytes from a serial byte on, after handing the words before the look-back words to the
+        /// sink if the window has to slide to hold the "needed" bytes (bytes it slid past aren't available)
+        detail::serial_window outside_buffer(const size_t byte, const size_t, const size_t needed, const void *const, const size_t) noexcept override
+        {
+            if (byte < first_byte || byte > end_byte || needed > end_byte - byte)
+                return {nullptr, 0u};
+            const size_t word = byte / sizeof(T_word);
+            if (byte - first_byte + needed > sizeof(window) && word > emitted_words() + N_look_back_words)
+                emit_words(word - N_look_back_words - emitted_words());
+            if (byte - first_byte + needed > sizeof(window))
+                return {nullptr, 0u};
+            const size_t size = sizeof(window) - (byte - first_byte);
+            return {&window[byte - first_byte], size < end_byte - byte ? size : end_byte - byte};
+        }
+
+        /// @brief the serial data is unbounded (unless it's limited), the window slides over it
+        size_t outside_bit_capacity() const noexcept override
+        {
+            return end_byte == ~size_t(0) ? ~size_t(0) : end_byte * 8u;
+        }
+
+        /// @brief the window, as a segment from its first serial byte on
+        detail::serial_segments outside_segments() const noexcept override
+        {
+            return {&segment, first_byte, first_byte + sizeof(window)};
+        }
+
+        /// @brief ends the serial data at a byte offset, so fields past it fail with EXCEEDED_SERIAL_SIZE
+        void limit_serial_bytes(const size_t bytes) noexcept
+        {
+            end_byte = bytes;
+            update_span();
+        }
+
+    private:
+        static constexpr size_t word_bits = sizeof(T_word) * 8u;
+        alignas(T_word) uint8_t window[N_window_words * sizeof(T_word)]; ///< serial bytes from first_byte on
+        const buffer_segment segment;                                    ///< the window, for byte iterators
+        size_t first_byte;                                               ///< serial byte offset of the window
+        size_t end_byte;                                                 ///< serial byte offset the serial data ends at
+        void *const sink_object;
+        void (*const sink_call)(void *, const T_word *, size_t);
+        detail::serial_span span; ///< the window, up to the end of the serial data (see packet::outside_span)
+
+        template <typename T_sink>
+        static void call_sink(void *sink, const T_word *words, size_t count)
+        {
+            (*static_cast<T_sink *>(sink))(words, count);
+        }
+
+        /// @brief hands the first "count" words of the window to the sink, and slides it past them (words past the
+        /// end of the window were never stored to, so they're handed over as zeros)
+        void emit_words(size_t count) noexcept
+        {
+            uint8_t *const serial = window;
+            do
+            {
+                const size_t words = count < N_window_words ? count : N_window_words;
+                const size_t emitted_bytes = words * sizeof(T_word);
+                T_word *const emitted = reinterpret_cast<T_word *>(serial);
+                // (the window holds serial bytes, which are turned into words in place, all of them in one byte
+                // swapping copy that reads each word before writing it)
+                if (sizeof(T_word) > 1u && detail::on_little_endian_platform())
+                    detail::big_endian_unpack(emitted, serial, words);
+                sink_call(sink_object, emitted, words);
+                std::memmove(serial, &serial[emitted_bytes], sizeof(window) - emitted_bytes);
+                std::memset(&serial[sizeof(window) - emitted_bytes], 0, emitted_bytes);
+                first_byte += emitted_bytes;
+                count -= words;
+            } while (count != 0u);
+            update_span();
+        }
+
+        /// @brief makes the window (up to the end of the serial data) the outside_span
+        void update_span() noexcept
+        {
+            const size_t window_end = first_byte + sizeof(window);
+            span = {window, first_byte, window_end < end_byte ? window_end : (end_byte > first_byte ? end_byte : first_byte)};
+        }
+    };
+
+    // implementation details
+    namespace detail
+    {
+        /// @brief the sink of a write_once_packet, writes each word it's handed to the destination, in order
+        template <typename T_word, typename T_destination>
+        struct write_once_destination
+        {
+            T_destination words;        ///< written with "words[i] = word", never read
+            const size_t capacity;      ///< number of destination words
+            const bool pre_zeroed;      ///< set if the destination words are zeros, so zero words aren't written
+            size_t written;             ///< number of words handed over so far
+
+            void operator()(const T_word *const source, const size_t count) noexcept
+            {
+                for (size_t i = 0; i < count && written < capacity; i++, written++)
+                    if (!pre_zeroed || source[i] != 0u)
+                        words[written] = source[i];
+            }
+        };
+    }
+
+    /// @brief a storing packet over an array of words (like memory mapped device registers, or uncached memory),
+    /// which writes each destination word once, in order, when the bit offset moves past it, and never reads the
+    /// destination. The default packet stores read-modify-write every word a field touches, so a word holding
+    /// several fields is read and rewritten once per field.
+    ///
+    /// It's a word_sink_packet whose sink is the destination: fields are stored into its window, and the words
+    /// that slide out of it are written to the destination, so a back-patched field must be at most
+    /// N_look_back_words words behind the bit offset, and finish() writes the rest of the words (which isn't
+    /// done by the destructor). Fields past the end of the destination fail with EXCEEDED_SERIAL_SIZE, and
+    /// loading isn't supported.
+    ///
+    /// With "destination_pre_zeroed" set, words that are all zeros (like the words skipped by pads, or before the
+    /// starting bit offset) aren't written at all, so only the words holding set bits are written, each once.
+    ///
+    /// Every field is stored by the out of line packet backend path, which costs several times what an inline
+    /// store into an array does, so it's meant for destinations whose accesses are what's slow (or must not be
+    /// repeated), not as a faster way to store into ordinary memory.
+    ///
+    /// Examples:\n
+    /// \code{.cpp}
+    ///     volatile uint32_t *const tx_registers = reinterpret_cast<volatile uint32_t *>(0x40001000);
+    ///     serdes::write_once_packet<uint32_t> pkt(tx_registers, 16);
+    ///     pkt << header << payload;
+    ///     pkt.finish();
+    /// \endcode
+    /// @tparam   T_word: the destination word type
+    /// @tparam   N_window_words: size of the window in words
+    /// @tparam   N_look_back_words: number of words before the bit offset kept in the window
+    /// @tparam   T_destination: anything written to as "destination[i] = word", a volatile T_word pointer by default
+    template <typename T_word, size_t N_window_words = 64u / sizeof(T_word), size_t N_look_back_words = 0u, typename T_destination = volatile T_word *>
+    struct write_once_packet : private detail::write_once_destination<T_word, T_destination>,
+                               public word_sink_packet<T_word, N_window_words, N_look_back_words>
+    {
+        /// @brief Construct a new write once packet object, in STORING mode
+        /// @param    destination: the destination words
+        /// @param    destination_words: number of destination words
+        /// @param    destination_pre_zeroed: set if the destination words are zeros, so zero words aren't written
+        /// @param    b_offset: bit offset to start storing at (the bits before it are zeros)
+        write_once_packet(T_destination destination, size_t destination_words, bool destination_pre_zeroed = false, size_t b_offset = 0) noexcept
+            : detail::write_once_destination<T_word, T_destination>{destination, destination_words, destination_pre_zeroed, 0u},
+              word_sink_packet<T_word, N_window_words, N_look_back_words>(static_cast<detail::write_once_destination<T_word, T_destination> &>(*this), b_offset)
+        {
+            this->limit_serial_bytes(destination_words * sizeof(T_word));
+        }
+
+        /// @brief Construct a new write once packet object, in STORING mode
+        /// @param    destination: the destination words
+        /// @param    destination_pre_zeroed: set if the destination words are zeros, so zero words aren't written
+        /// @param    b_offset: bit offset to start storing at (the bits before it are zeros)
+        template <size_t N>
+        explicit write_once_packet(volatile T_word (&destination)[N], bool destination_pre_zeroed = false, size_t b_offset = 0) noexcept
+            : write_once_packet(&destination[0], N, destination_pre_zeroed, b_offset) {}
+    };
+}
+
+#endif // _SERDES_WORD_SINK_H_
@@ -0,0 +1,1251 @@
+// run using "make bench"
+//
+// micro benchmarks comparing optimized code paths against the reference code paths they replace,
+// each benchmark prints the time per operation for both, and the speedup of the optimized path
+#define configCPP_SERDES_ENABLE_CPU_DISPATCH
+#define configCPP_SERDES_ENABLE_READ_AHEAD_THREAD
+// compiled_format needs the packet's recording hooks (a check on the packet backend paths, aligns, and data dependent
+// constructs, none on the fields copied to/from a buffer)
+#define configCPP_SERDES_ENABLE_FORMAT_RECORDING
+#include "../include/serdes.h"
+#include "../include/serdes_record_reader.h"
+#include "../include/serdes_bit_stream.h"
+#include "../include/serdes_compiled_format.h"
+#include <chrono>
+#include <cstdio>
+#include <functional>
+
+// stops the optimizer from removing benchmarked work whose result is otherwise unused
+static volatile uint64_t benchmark_sink = 0;
+
+// best of several trials, to filter out noise from other processes
+template <typename T_func>
+static double nanoseconds_per_op(T_func &&func, const size_t ops_per_call)
+{
+    constexpr size_t trials = 15;
+    constexpr size_t repetitions = 200;
+    func(); // warm up
+    double best_ns = 0.0;
+    for (size_t trial = 0; trial < trials; trial++)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < repetitions; i++)
+            func();
+        const auto stop = std::chrono::steady_clock::now();
+        const double elapsed_ns = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start).count());
+        if (trial == 0 || elapsed_ns < best_ns)
+            best_ns = elapsed_ns;
+    }
+    return best_ns / static_cast<double>(repetitions * ops_per_call);
+}
+
+static void print_result(const char *name, const double reference_ns, const double optimized_ns)
+{
+    printf("%-44s reference: %7.3f ns/op   optimized: %7.3f ns/op   speedup: %5.2fx\n",
+           name, reference_ns, optimized_ns, reference_ns / optimized_ns);
+}
+
+// reads fields of the given width at every bit offset of a byte buffer, comparing the element-by-element
+// bitcpy (raw pointer) to the word-at-a-time bitcpy (sized_pointer loads)
+template <typename T_val>
+static void benchmark_wide_byte_bitcpy(const char *name, const size_t bits)
+{
+    static uint8_t buffer[4096];
+    const size_t fields = (sizeof(buffer) * 8u - bits) / 7u;
+    for (size_t i = 0; i < sizeof(buffer); i++)
+        buffer[i] = static_cast<uint8_t>(i * 37u);
+
+    char full_name[64];
+    snprintf(full_name, sizeof(full_name), "%s load (%zu bits)", name, bits);
+    print_result(
+        full_name,
+        nanoseconds_per_op([&]()
+                           {
+                               uint64_t sum = 0;
+                               for (size_t i = 0; i < fields; i++)
+                               {
+                                   T_val x{};
+                                   serdes::bitcpy(x, &buffer[0], i * 7u, bits);
+                                   sum += static_cast<uint64_t>(x);
+                               }
+                               benchmark_sink = sum; },
+                           fields),
+        nanoseconds_per_op([&]()
+                           {
+                               uint64_t sum = 0;
+                               const serdes::sized_pointer<uint8_t> source(buffer);
+                               for (size_t i = 0; i < fields; i++)
+                               {
+                                   T_val x{};
+                                   serdes::bitcpy(x, source, i * 7u, bits);
+                                   sum += static_cast<uint64_t>(x);
+                               }
+                               benchmark_sink = sum; },
+                           fields));
+}
+
+// packs and unpacks 12 bit samples (like the readings of a 12 bit ADC) held in a uint16_t array, element by element
+// with bitcpy (reference), and as a whole bitpacked array with the bulk kernels (optimized). The bit width is only
+// known at runtime, like a bitpack's, so neither side is specialized for 12 bits
+template <typename T_array>
+static void benchmark_bitpacked_array(const char *name)
+{
+    constexpr size_t count = 1024;
+    static volatile size_t runtime_bits = 12;
+    const size_t bits = runtime_bits;
+    static uint16_t samples[count];
+    // sized for full width elements, since the element width is only known at runtime
+    static T_array serial_data[count * sizeof(uint16_t) / sizeof(T_array)];
+    for (size_t i = 0; i < count; i++)
+        samples[i] = static_cast<uint16_t>((i * 2731u) & 0xFFFu);
+
+    char full_name[64];
+    snprintf(full_name, sizeof(full_name), "%s store", name);
+    print_result(
+        full_name,
+        nanoseconds_per_op([&]()
+                           {
+                               for (size_t i = 0; i < count; i++)
+                                   serdes::bitcpy(&serial_data[0], samples[i], i * bits, bits);
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet(serial_data).store(samples, bits);
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count));
+
+    snprintf(full_name, sizeof(full_name), "%s load", name);
+    print_result(
+        full_name,
+        nanoseconds_per_op([&]()
+                           {
+                               for (size_t i = 0; i < count; i++)
+                                   serdes::bitcpy(samples[i], &serial_data[0], i * bits, bits);
+                               benchmark_sink = samples[benchmark_sink & 1023u]; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet(serial_data).load(samples, bits);
+                               benchmark_sink = samples[benchmark_sink & 1023u]; },
+                           count));
+}
+
+// a mix of bitpacked fields, written as a template so a typed_packet keeps its buffer type when nested
+struct benchmark_frame
+{
+    uint8_t id = 0x5A;
+    uint16_t counter = 0x123;
+    int32_t position = -12345;
+    uint32_t flags = 0x2AAAA;
+    uint64_t timestamp = 0x123456789AB;
+
+    template <typename T_packet>
+    void format(T_packet &p)
+    {
+        p + id + serdes::bitpack<uint16_t, int>(counter, 12) + serdes::bitpack<int32_t, int>(position, 21) +
+            serdes::bitpack<uint32_t, int>(flags, 19) + serdes::bitpack<uint64_t, int>(timestamp, 45);
+    }
+};
+
+// kept out of line, like a format reached through packet_base's virtual format method, so the compiler can't
+// hoist the packet's element size switch out of the benchmark loop
+template <typename T_packet>
+__attribute__((noinline)) static void format_frame(T_packet &p, benchmark_frame &frame)
+{
+    frame.format(p);
+}
+
+// serializes and deserializes frames with a packet (runtime element size switch per field) and with a
+// typed_packet (element size known at compile time) over the same buffer width
+template <typename T_array>
+static void benchmark_typed_packet(const char *name)
+{
+    constexpr size_t frames = 64;
+    static T_array buffer[frames * 16u / sizeof(T_array)];
+    static benchmark_frame objects[frames];
+
+    char full_name[64];
+    snprintf(full_name, sizeof(full_name), "%s store", name);
+    print_result(
+        full_name,
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   { p.mode = serdes::mode_e::STORING; format_frame(p, objects[i]); }
+                               benchmark_sink = p.bit_offset; },
+                           frames),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::typed_packet<T_array> p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   { p.mode = serdes::mode_e::STORING; format_frame(p, objects[i]); }
+                               benchmark_sink = p.bit_offset; },
+                           frames));
+
+    snprintf(full_name, sizeof(full_name), "%s load", name);
+    print_result(
+        full_name,
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   { p.mode = serdes::mode_e::LOADING; format_frame(p, objects[i]); }
+                               benchmark_sink = p.bit_offset + objects[frames - 1].counter; },
+                           frames),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::typed_packet<T_array> p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   { p.mode = serdes::mode_e::LOADING; format_frame(p, objects[i]); }
+                               benchmark_sink = p.bit_offset + objects[frames - 1].counter; },
+                           frames));
+}
+
+// serializes and deserializes frames with a checked typed_packet and with an unchecked_packet, whose capacity
+// was validated once up front for all of the frames
+template <typename T_array>
+static void benchmark_unchecked_packet(const char *name)
+{
+    constexpr size_t frames = 64;
+    static T_array buffer[frames * 16u / sizeof(T_array)];
+    static benchmark_frame objects[frames];
+
+    char full_name[64];
+    snprintf(full_name, sizeof(full_name), "%s store", name);
+    print_result(
+        full_name,
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::typed_packet<T_array> p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   { p.mode = serdes::mode_e::STORING; format_frame(p, objects[i]); }
+                               benchmark_sink = p.bit_offset; },
+                           frames),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::unchecked_packet<T_array> p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   { p.mode = serdes::mode_e::STORING; format_frame(p, objects[i]); }
+                               benchmark_sink = p.bit_offset; },
+                           frames));
+
+    snprintf(full_name, sizeof(full_name), "%s load", name);
+    print_result(
+        full_name,
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::typed_packet<T_array> p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   { p.mode = serdes::mode_e::LOADING; format_frame(p, objects[i]); }
+                               benchmark_sink = p.bit_offset + objects[frames - 1].counter; },
+                           frames),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::unchecked_packet<T_array> p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   { p.mode = serdes::mode_e::LOADING; format_frame(p, objects[i]); }
+                               benchmark_sink = p.bit_offset + objects[frames - 1].counter; },
+                           frames));
+}
+
+// loads 12 bit samples one field at a time, kept out of line like format_frame
+template <typename T_packet>
+__attribute__((noinline)) static void load_samples(T_packet &p, int16_t *samples, const size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        p >> serdes::bitpack<int16_t, int>(samples[i], 12);
+}
+
+// deserializes frames, and a dense stream of 12 bit samples, with a typed_packet (each field located and masked
+// from scratch) and with a bit_stream_packet (fields shifted off a 64 bit accumulator). The accumulator pays off
+// most for long runs of narrow fields (about 2x for byte buffers), a frame's few wide fields gain about 1.3x
+template <typename T_array>
+static void benchmark_bit_stream_packet(const char *name)
+{
+    constexpr size_t frames = 64;
+    constexpr size_t samples = 512;
+    static T_array buffer[frames * 16u / sizeof(T_array)];
+    static benchmark_frame objects[frames];
+    static int16_t sample_values[samples];
+    for (size_t i = 0; i < sizeof(buffer) / sizeof(buffer[0]); i++)
+        buffer[i] = static_cast<T_array>(i * 0x9E3779B97F4A7C15u);
+
+    char full_name[64];
+    snprintf(full_name, sizeof(full_name), "%s frame load", name);
+    print_result(
+        full_name,
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::typed_packet<T_array> p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   { p.mode = serdes::mode_e::LOADING; format_frame(p, objects[i]); }
+                               benchmark_sink = p.bit_offset + objects[frames - 1].counter; },
+                           frames),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::bit_stream_packet<T_array> p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   format_frame(p, objects[i]);
+                               benchmark_sink = p.bit_offset + objects[frames - 1].counter; },
+                           frames));
+
+    snprintf(full_name, sizeof(full_name), "%s 12 bit samples", name);
+    print_result(
+        full_name,
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::typed_packet<T_array> p(buffer, ~size_t(0), 0u, serdes::mode_e::LOADING);
+                               load_samples(p, sample_values, samples);
+                               benchmark_sink = p.bit_offset + static_cast<uint64_t>(sample_values[samples - 1]); },
+                           samples),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::bit_stream_packet<T_array> p(buffer);
+                               load_samples(p, sample_values, samples);
+                               benchmark_sink = p.bit_offset + static_cast<uint64_t>(sample_values[samples - 1]); },
+                           samples));
+}
+
+// serializes frames with a typed_packet (runtime capacity) and with a static_packet (compile time capacity). A
+// static_packet's benefit is rejecting values that can never fit at compile time, not speed: the constant capacity
+// saves a load per bounds check at most, and measures the same as a typed_packet within noise
+static void benchmark_static_packet()
+{
+    constexpr size_t frames = 64;
+    static uint8_t buffer[frames * 16u];
+    static benchmark_frame objects[frames];
+
+    print_result(
+        "uint8_t[] static_packet frame store",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::typed_packet<uint8_t> p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   { p.mode = serdes::mode_e::STORING; format_frame(p, objects[i]); }
+                               benchmark_sink = p.bit_offset; },
+                           frames),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::static_packet<uint8_t, frames * 16u> p(buffer);
+                               for (size_t i = 0; i < frames; i++)
+                                   { p.mode = serdes::mode_e::STORING; format_frame(p, objects[i]); }
+                               benchmark_sink = p.bit_offset; },
+                           frames));
+}
+
+struct benchmark_virtual_point : serdes::packet_base
+{
+    uint8_t x = 1, y = 2, z = 3, q = 4;
+    void format(serdes::packet &p) override { p + x + y + z + q; }
+};
+
+struct benchmark_static_point : serdes::static_packet_base<benchmark_static_point>
+{
+    uint8_t x = 1, y = 2, z = 3, q = 4;
+    void format(serdes::packet &p) { p + x + y + z + q; }
+};
+
+// serializes and deserializes an array of small nested messages, dispatched through packet_base's virtual
+// format method and statically through static_packet_base
+static void benchmark_static_packet_base()
+{
+    constexpr size_t count = 64;
+    static benchmark_virtual_point virtual_points[count];
+    static benchmark_static_point static_points[count];
+    static uint8_t serial_data[count * 4u];
+    size_t size = count;
+
+    print_result(
+        "static_packet_base array store",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet(serial_data) << serdes::array<benchmark_virtual_point, size_t>(virtual_points, size);
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet(serial_data) << serdes::array<benchmark_static_point, size_t>(static_points, size);
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count));
+
+    print_result(
+        "static_packet_base array load",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet(serial_data) >> serdes::array<benchmark_virtual_point, size_t>(virtual_points, size);
+                               benchmark_sink = virtual_points[benchmark_sink & 63u].z; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet(serial_data) >> serdes::array<benchmark_static_point, size_t>(static_points, size);
+                               benchmark_sink = static_points[benchmark_sink & 63u].z; },
+                           count));
+    printf("    sizeof: packet_base point %zu bytes, static_packet_base point %zu bytes\n", sizeof(benchmark_virtual_point), sizeof(benchmark_static_point));
+}
+
+// decodes little endian fields and arrays, by loading them big endian and byte swapping them by hand, and
+// with the little endian mode (plain memcpy on little endian platforms)
+static void benchmark_little_endian()
+{
+    constexpr size_t count = 256;
+    static uint8_t serial_data[count * 4u];
+    static uint32_t values[count];
+    for (size_t i = 0; i < sizeof(serial_data); i++)
+        serial_data[i] = static_cast<uint8_t>(i * 37u);
+
+    print_result(
+        "uint8_t[] little endian uint32_t fields",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                               {
+                                   p >> values[i];
+                                   values[i] = serdes::detail::byteswap(values[i]);
+                               }
+                               benchmark_sink = values[count - 1]; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               p.endian = serdes::endian_e::LITTLE;
+                               for (size_t i = 0; i < count; i++)
+                                   p >> values[i];
+                               benchmark_sink = values[count - 1]; },
+                           count));
+
+    print_result(
+        "uint8_t[] little endian uint32_t array",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet(serial_data) >> values;
+                               for (size_t i = 0; i < count; i++)
+                                   values[i] = serdes::detail::byteswap(values[i]);
+                               benchmark_sink = values[count - 1]; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet(serial_data) >> serdes::little_endian(values);
+                               benchmark_sink = values[count - 1]; },
+                           count));
+}
+
+// packs and unpacks CAN style frames of sub-byte and multi-byte signals with MSB first bit numbering
+// (reference) and LSB first bit numbering (optimized), which should cost no more than MSB first
+static void benchmark_lsb_first()
+{
+    constexpr size_t frames = 64;
+    constexpr size_t signal_bits[8] = {1, 3, 4, 6, 2, 12, 10, 26};
+    static uint8_t serial_data[frames * 8u];
+    for (size_t i = 0; i < sizeof(serial_data); i++)
+        serial_data[i] = static_cast<uint8_t>(i * 37u);
+
+    print_result(
+        "uint8_t[] LSB first signal pack",
+        nanoseconds_per_op([&]()
+                           {
+                               for (size_t frame = 0; frame < frames; frame++)
+                               {
+                                   size_t bit_offset = frame * 64u;
+                                   for (size_t signal = 0; signal < 8; signal++)
+                                   {
+                                       serdes::bitcpy(&serial_data[0], static_cast<uint32_t>(frame + signal), bit_offset, signal_bits[signal]);
+                                       bit_offset += signal_bits[signal];
+                                   }
+                               }
+                               benchmark_sink = serial_data[benchmark_sink & 255u]; },
+                           frames * 8u),
+        nanoseconds_per_op([&]()
+                           {
+                               for (size_t frame = 0; frame < frames; frame++)
+                               {
+                                   size_t bit_offset = frame * 64u;
+                                   for (size_t signal = 0; signal < 8; signal++)
+                                   {
+                                       serdes::lsb_first_bitcpy(&serial_data[0], static_cast<uint32_t>(frame + signal), bit_offset, signal_bits[signal]);
+                                       bit_offset += signal_bits[signal];
+                                   }
+                               }
+                               benchmark_sink = serial_data[benchmark_sink & 255u]; },
+                           frames * 8u));
+
+    print_result(
+        "uint8_t[] LSB first signal unpack",
+        nanoseconds_per_op([&]()
+                           {
+                               const serdes::sized_pointer<const uint8_t> source(serial_data);
+                               uint64_t sum = 0;
+                               for (size_t frame = 0; frame < frames; frame++)
+                               {
+                                   size_t bit_offset = frame * 64u;
+                                   for (size_t signal = 0; signal < 8; signal++)
+                                   {
+                                       uint32_t x = 0;
+                                       serdes::bitcpy(x, source, bit_offset, signal_bits[signal]);
+                                       sum += x;
+                                       bit_offset += signal_bits[signal];
+                                   }
+                               }
+                               benchmark_sink = sum; },
+                           frames * 8u),
+        nanoseconds_per_op([&]()
+                           {
+                               const serdes::sized_pointer<const uint8_t> source(serial_data);
+                               uint64_t sum = 0;
+                               for (size_t frame = 0; frame < frames; frame++)
+                               {
+                                   size_t bit_offset = frame * 64u;
+                                   for (size_t signal = 0; signal < 8; signal++)
+                                   {
+                                       uint32_t x = 0;
+                                       serdes::lsb_first_bitcpy(x, source, bit_offset, signal_bits[signal]);
+                                       sum += x;
+                                       bit_offset += signal_bits[signal];
+                                   }
+                               }
+                               benchmark_sink = sum; },
+                           frames * 8u));
+}
+
+// moves a long run of bits between byte buffers at mismatched and matching bit alignments, 64 bits at a time
+// with bitcpy (reference), and with bitmove's funnel shift and memmove kernels (optimized)
+static void benchmark_bitmove()
+{
+    constexpr size_t bytes = 4096;
+    constexpr size_t bits = (bytes - 8u) * 8u;
+    static uint8_t source[bytes], dest[bytes];
+    for (size_t i = 0; i < bytes; i++)
+        source[i] = static_cast<uint8_t>(i * 37u);
+
+    const size_t dest_bit_offsets[2] = {5, 3};
+    const char *names[2] = {"uint8_t[] bitmove (mismatched alignment)", "uint8_t[] bitmove (matching alignment)"};
+    for (size_t test = 0; test < 2; test++)
+    {
+        const size_t dest_bit_offset = dest_bit_offsets[test];
+        print_result(
+            names[test],
+            nanoseconds_per_op([&]()
+                               {
+                                   size_t moved = 0;
+                                   for (; moved + 64u <= bits; moved += 64u)
+                                   {
+                                       uint64_t chunk = 0;
+                                       serdes::bitcpy(chunk, &source[0], 3u + moved, 64u);
+                                       serdes::bitcpy(&dest[0], chunk, dest_bit_offset + moved, 64u);
+                                   }
+                                   benchmark_sink = dest[benchmark_sink & 1023u] + moved; },
+                               bits / 64u),
+            nanoseconds_per_op([&]()
+                               {
+                                   benchmark_sink = serdes::bitmove(serdes::sized_pointer<uint8_t>(dest), dest_bit_offset, serdes::sized_pointer<const uint8_t>(source), 3u, bits / 64u * 64u);
+                                   benchmark_sink = dest[benchmark_sink & 1023u]; },
+                               bits / 64u));
+    }
+}
+
+// packs and unpacks a status word of bool flags one bool at a time (reference) and with the bulk bool
+// kernel, 64 bools per serial access (optimized), packed by the dispatched kernel (a vpmovmskb of 32 bools on
+// CPUs with AVX2) and unpacked 8 bools per multiply
+static void benchmark_bool_arrays()
+{
+    constexpr size_t count = 512;
+    static bool flags[count];
+    static uint8_t serial_data[count / 8u + 1u];
+    for (size_t i = 0; i < count; i++)
+        flags[i] = ((i * 0x9E3779B9u) >> 7) & 1u;
+
+    print_result(
+        "uint8_t[] bool array pack",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data, ~size_t(0), 3u);
+                               for (size_t i = 0; i < count; i++)
+                                   p << flags[i];
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet(serial_data, ~size_t(0), 3u) << flags;
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count));
+
+    print_result(
+        "uint8_t[] bool array unpack",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data, ~size_t(0), 3u);
+                               for (size_t i = 0; i < count; i++)
+                                   p >> flags[i];
+                               benchmark_sink = flags[benchmark_sink & 511u]; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet(serial_data, ~size_t(0), 3u) >> flags;
+                               benchmark_sink = flags[benchmark_sink & 511u]; },
+                           count));
+}
+
+// runs the dispatched kernels with each instruction set level the CPU supports, against the scalar kernels
+static void benchmark_cpu_dispatch()
+{
+    constexpr size_t count = 1024;
+    static uint32_t words[count];
+    static uint8_t serial_data[count * 4u];
+    for (size_t i = 0; i < count; i++)
+        words[i] = static_cast<uint32_t>(i * 0x9E3779B9u);
+
+    const auto byteswap_store = [&]()
+    {
+        serdes::packet(serial_data) << words;
+        benchmark_sink = serial_data[benchmark_sink & 1023u];
+    };
+    const auto crc = [&]()
+    { benchmark_sink = serdes::cpu_dispatch::crc32c(serial_data, sizeof(serial_data)); };
+
+    serdes::cpu_dispatch::force(serdes::isa_e::SCALAR);
+    const double scalar_byteswap_ns = nanoseconds_per_op(byteswap_store, count);
+    const double scalar_crc_ns = nanoseconds_per_op(crc, sizeof(serial_data));
+    for (const serdes::isa_e level : {serdes::isa_e::SSE4_2, serdes::isa_e::AVX2})
+    {
+        if (!serdes::cpu_dispatch::force(level))
+            continue;
+        char full_name[64];
+        snprintf(full_name, sizeof(full_name), "uint32_t[] byte swapped store (%s)", serdes::cpu_dispatch::name(level));
+        print_result(full_name, scalar_byteswap_ns, nanoseconds_per_op(byteswap_store, count));
+        snprintf(full_name, sizeof(full_name), "crc32c per byte (%s)", serdes::cpu_dispatch::name(level));
+        print_result(full_name, scalar_crc_ns, nanoseconds_per_op(crc, sizeof(serial_data)));
+    }
+    serdes::cpu_dispatch::reset();
+}
+
+// a telemetry record stored field by field through the packet, against the static_format schema of the same layout
+struct benchmark_record
+{
+    uint16_t id;
+    uint8_t flags;
+    int8_t delta;
+    bool urgent;
+    uint32_t timestamp;
+    float gain;
+};
+
+using benchmark_record_format = serdes::static_format<
+    serdes::member_field<decltype(&benchmark_record::id), &benchmark_record::id, 12>,
+    serdes::member_field<decltype(&benchmark_record::flags), &benchmark_record::flags, 4>,
+    serdes::member_field<decltype(&benchmark_record::delta), &benchmark_record::delta, 6>,
+    serdes::member_field<decltype(&benchmark_record::urgent), &benchmark_record::urgent>,
+    serdes::member_field<decltype(&benchmark_record::timestamp), &benchmark_record::timestamp, 25>,
+    serdes::member_field<decltype(&benchmark_record::gain), &benchmark_record::gain>>;
+
+static void benchmark_static_format()
+{
+    constexpr size_t count = 64;
+    static benchmark_record records[count];
+    static uint8_t serial_data[count * benchmark_record_format::bytes];
+    for (size_t i = 0; i < count; i++)
+        records[i] = {static_cast<uint16_t>(i * 37u), static_cast<uint8_t>(i & 15u), static_cast<int8_t>(i % 31u), (i & 1u) != 0u, static_cast<uint32_t>(i * 977u), static_cast<float>(i)};
+
+    print_result(
+        "uint8_t[] static_format store",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                               {
+                                   p.store(records[i].id, 12);
+                                   p.store(records[i].flags, 4);
+                                   p.store(records[i].delta, 6);
+                                   p.store(records[i].urgent);
+                                   p.store(records[i].timestamp, 25);
+                                   p.store(records[i].gain);
+                                   p.align(8);
+                               }
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                               {
+                                   p << benchmark_record_format::bind(records[i]);
+                                   p.align(8);
+                               }
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count));
+
+    print_result(
+        "uint8_t[] static_format load",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                               {
+                                   p.load(records[i].id, 12);
+                                   p.load(records[i].flags, 4);
+                                   p.load(records[i].delta, 6);
+                                   p.load(records[i].urgent);
+                                   p.load(records[i].timestamp, 25);
+                                   p.load(records[i].gain);
+                                   p.align(8);
+                               }
+                               benchmark_sink = records[benchmark_sink & 63u].id; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                               {
+                                   p >> benchmark_record_format::bind(records[i]);
+                                   p.align(8);
+                               }
+                               benchmark_sink = records[benchmark_sink & 63u].id; },
+                           count));
+}
+
+// full width fields in the host struct layout, stored field by field through a packet, against a static_format
+// of the same fields which is a bulk copy and an in place byte swap of the whole struct
+struct benchmark_wire_sample
+{
+    uint32_t timestamp;
+    int16_t x, y, z;
+    uint16_t status;
+    float temperature;
+    uint64_t counter;
+};
+
+using benchmark_wire_sample_format = serdes::static_format<
+    serdes::member_field<decltype(&benchmark_wire_sample::timestamp), &benchmark_wire_sample::timestamp>,
+    serdes::member_field<decltype(&benchmark_wire_sample::x), &benchmark_wire_sample::x>,
+    serdes::member_field<decltype(&benchmark_wire_sample::y), &benchmark_wire_sample::y>,
+    serdes::member_field<decltype(&benchmark_wire_sample::z), &benchmark_wire_sample::z>,
+    serdes::member_field<decltype(&benchmark_wire_sample::status), &benchmark_wire_sample::status>,
+    serdes::member_field<decltype(&benchmark_wire_sample::temperature), &benchmark_wire_sample::temperature>,
+    serdes::member_field<decltype(&benchmark_wire_sample::counter), &benchmark_wire_sample::counter>>;
+
+static void benchmark_host_layout_passthrough()
+{
+    constexpr size_t count = 64;
+    static benchmark_wire_sample samples[count];
+    static uint8_t serial_data[count * benchmark_wire_sample_format::bytes];
+    for (size_t i = 0; i < count; i++)
+        samples[i] = {static_cast<uint32_t>(i * 977u), static_cast<int16_t>(i), static_cast<int16_t>(-i), static_cast<int16_t>(i * 3u),
+                      static_cast<uint16_t>(i & 7u), static_cast<float>(i), i * 0x0101010101ull};
+
+    print_result(
+        "host layout static_format store",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                                   p << samples[i].timestamp << samples[i].x << samples[i].y << samples[i].z << samples[i].status << samples[i].temperature << samples[i].counter;
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                                   p << benchmark_wire_sample_format::bind(samples[i]);
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count));
+
+    print_result(
+        "host layout static_format load",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                                   p >> samples[i].timestamp >> samples[i].x >> samples[i].y >> samples[i].z >> samples[i].status >> samples[i].temperature >> samples[i].counter;
+                               benchmark_sink = samples[benchmark_sink & 63u].timestamp; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                                   p >> benchmark_wire_sample_format::bind(samples[i]);
+                               benchmark_sink = samples[benchmark_sink & 63u].timestamp; },
+                           count));
+}
+
+// the bitpacked record as a packet_base format, the fixed header of the variable message below
+struct benchmark_record_packet : serdes::packet_base
+{
+    static constexpr bool fixed_layout = true;
+
+    benchmark_record record = {};
+
+    void format(serdes::packet &p) override
+    {
+        p + serdes::bitpack<uint16_t, int>(record.id, 12) + serdes::bitpack<uint8_t, int>(record.flags, 4) + serdes::bitpack<int8_t, int>(record.delta, 6);
+        p + record.urgent + serdes::bitpack<uint32_t, int>(record.timestamp, 25) + record.gain;
+        p.align(8);
+    }
+};
+
+struct benchmark_variable_packet : serdes::packet_base
+{
+    uint8_t count = 48;
+    uint16_t samples[64] = {};
+    benchmark_record_packet header{};
+
+    void format(serdes::packet &p) override
+    {
+        p + header + count;
+        p.store(serdes::array<uint16_t, uint8_t>(samples, count), 12);
+        p.align(8);
+    }
+};
+
+static void benchmark_serialized_bits()
+{
+    static benchmark_variable_packet message;
+    static uint8_t scratch[256];
+    for (size_t i = 0; i < 64; i++)
+        message.samples[i] = static_cast<uint16_t>(i * 53u);
+
+    print_result(
+        "serialized_bits variable format",
+        nanoseconds_per_op([&]()
+                           {
+                               benchmark_sink += message.store(scratch).bits;
+                               benchmark_sink += scratch[benchmark_sink & 63u]; },
+                           1),
+        nanoseconds_per_op([&]()
+                           { benchmark_sink += message.serialized_bits().bits; },
+                           1));
+
+    print_result(
+        "serialized_bits fixed format",
+        nanoseconds_per_op([&]()
+                           {
+                               benchmark_sink += message.header.store(scratch).bits;
+                               benchmark_sink += scratch[benchmark_sink & 63u]; },
+                           1),
+        nanoseconds_per_op([&]()
+                           { benchmark_sink += message.header.serialized_bits().bits; },
+                           1));
+
+    print_result(
+        "fixed_serialized_bits fixed format",
+        nanoseconds_per_op([&]()
+                           {
+                               benchmark_sink += message.header.store(scratch).bits;
+                               benchmark_sink += scratch[benchmark_sink & 63u]; },
+                           1),
+        nanoseconds_per_op([&]()
+                           { benchmark_sink += serdes::fixed_serialized_bits(message.header).bits; },
+                           1));
+}
+
+// serializes and deserializes the bitpacked records by walking their packet_base format, and by replaying their
+// compiled_format (a flat list of the fields, appended to a bit writer, or each read from its own 64 bit window). On
+// the reference machine the replayed store was about 1.2-1.3x the format's speed, and the replayed load was within
+// noise of it (0.99-1.13x)
+static void benchmark_compiled_format()
+{
+    constexpr size_t count = 64;
+    static benchmark_record_packet records[count];
+    static uint8_t serial_data[count * 11u];
+    for (size_t i = 0; i < count; i++)
+    {
+        records[i].record.id = static_cast<uint16_t>(i * 37u & 0xFFFu);
+        records[i].record.delta = static_cast<int8_t>(static_cast<int>(i % 31u) - 15);
+        records[i].record.timestamp = static_cast<uint32_t>(i * 977u);
+    }
+    benchmark_record_packet prototype;
+    const serdes::compiled_format<benchmark_record_packet> compiled(prototype);
+
+    print_result(
+        "compiled_format record store",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                                   p << records[i];
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                                   p << compiled.bind(records[i]);
+                               benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                           count));
+
+    print_result(
+        "compiled_format record load",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                                   p >> records[i];
+                               benchmark_sink = records[benchmark_sink & 63u].record.timestamp; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet p(serial_data);
+                               for (size_t i = 0; i < count; i++)
+                                   p >> compiled.bind(records[i]);
+                               benchmark_sink = records[benchmark_sink & 63u].record.timestamp; },
+                           count));
+}
+
+// runtime edittable format fields (example 09): the std::function formatter storage this replaces
+// against serdes::formatter's inline storage, both for running the format and for copying it. Both run their
+// callables directly (a packet's << adds the same status and empty checks around either one)
+static void benchmark_formatter()
+{
+    constexpr size_t count = 8;
+    static uint16_t fields[count] = {1, 2, 3, 4, 5, 6, 7, 8};
+    static uint8_t serial_data[count * 3u];
+    const uint8_t bits = 12;
+    std::function<void(serdes::packet &)> function_formats[count] = {};
+    serdes::formatter inline_formats[count] = {};
+    for (size_t i = 0; i < count; i++)
+    {
+        uint16_t *field = &fields[i];
+        function_formats[i] = [field, bits](serdes::packet &p)
+        { p.add(serdes::bitpack<uint16_t, uint8_t>(*field, bits)); };
+        inline_formats[i] = {[field, bits](serdes::packet &p)
+                             { p.add(serdes::bitpack<uint16_t, uint8_t>(*field, bits)); }};
+    }
+
+    print_result(
+        "formatter array store",
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet packet(serial_data, sizeof(serial_data), 0, serdes::mode_e::STORING);
+                               for (size_t i = 0; i < count; i++)
+                                   function_formats[i](packet);
+                               benchmark_sink = serial_data[benchmark_sink & 7u]; },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::packet packet(serial_data, sizeof(serial_data), 0, serdes::mode_e::STORING);
+                               for (size_t i = 0; i < count; i++)
+                                   inline_formats[i].formatter_lambda(packet);
+                               benchmark_sink = serial_data[benchmark_sink & 7u]; },
+                           count));
+
+    // std::function copies each element through its type erased manager (and allocates once the captures outgrow
+    // its small local buffer), trivially copyable inline captures are copied with a memcpy
+    print_result(
+        "formatter array copy",
+        nanoseconds_per_op([&]()
+                           {
+                               std::function<void(serdes::packet &)> copies[count] = {};
+                               for (size_t i = 0; i < count; i++)
+                                   copies[i] = function_formats[i];
+                               benchmark_sink = static_cast<bool>(copies[benchmark_sink & 7u]); },
+                           count),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::formatter copies[count] = {};
+                               for (size_t i = 0; i < count; i++)
+                                   copies[i] = inline_formats[i];
+                               benchmark_sink = static_cast<bool>(copies[benchmark_sink & 7u].formatter_lambda); },
+                           count));
+}
+
+// a header of adjacent fields, one field at a time (p << id << flags << seq << len), against the same
+// fields fused into a single word with serdes::group
+static void benchmark_field_group()
+{
+    constexpr size_t count = 64;
+    static uint8_t ids[count], flags[count];
+    static uint16_t seqs[count], lens[count];
+    static uint8_t serial_data[count * 6u + 1u];
+    for (size_t i = 0; i < count; i++)
+    {
+        ids[i] = static_cast<uint8_t>(i);
+        flags[i] = static_cast<uint8_t>(i * 3u);
+        seqs[i] = static_cast<uint16_t>(i * 257u);
+        lens[i] = static_cast<uint16_t>(i * 5u);
+    }
+
+    for (const size_t leading_bits : {0u, 4u})
+    {
+        printf("  header bit offset %zu:\n", leading_bits);
+        print_result(
+            "field chain vs serdes::group store",
+            nanoseconds_per_op([&]()
+                               {
+                                   serdes::packet packet(serial_data, sizeof(serial_data), leading_bits);
+                                   for (size_t i = 0; i < count; i++)
+                                       packet << ids[i] << flags[i] << seqs[i] << lens[i];
+                                   benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                               count),
+            nanoseconds_per_op([&]()
+                               {
+                                   serdes::packet packet(serial_data, sizeof(serial_data), leading_bits);
+                                   for (size_t i = 0; i < count; i++)
+                                       packet << serdes::group(ids[i], flags[i], seqs[i], lens[i]);
+                                   benchmark_sink = serial_data[benchmark_sink & 63u]; },
+                               count));
+
+        print_result(
+            "field chain vs serdes::group load",
+            nanoseconds_per_op([&]()
+                               {
+                                   serdes::packet packet(serial_data, sizeof(serial_data), leading_bits);
+                                   for (size_t i = 0; i < count; i++)
+                                       packet >> ids[i] >> flags[i] >> seqs[i] >> lens[i];
+                                   benchmark_sink = lens[benchmark_sink & 63u]; },
+                               count),
+            nanoseconds_per_op([&]()
+                               {
+                                   serdes::packet packet(serial_data, sizeof(serial_data), leading_bits);
+                                   for (size_t i = 0; i < count; i++)
+                                       packet >> serdes::group(ids[i], flags[i], seqs[i], lens[i]);
+                                   benchmark_sink = lens[benchmark_sink & 63u]; },
+                               count));
+    }
+}
+
+struct benchmark_stream_message : serdes::packet_base
+{
+    uint8_t type = 0;
+    uint16_t length = 0;
+    uint16_t samples[1024] = {};
+    uint32_t crc = 0;
+
+    void format(serdes::packet &p) override
+    {
+        p + type + length + serdes::array<uint16_t, uint16_t>(samples, length, 1024u) + crc;
+    }
+};
+
+static void benchmark_incremental_loads()
+{
+    constexpr size_t chunk_size = 64u;
+    static benchmark_stream_message sent, loaded;
+    static uint8_t serial_data[4096], staging[4096];
+    sent.type = 7;
+    sent.length = 1024;
+    for (size_t i = 0; i < 1024u; i++)
+        sent.samples[i] = static_cast<uint16_t>(0x9E37u * (i + 1u));
+    const size_t size = (sent.store(serial_data).bits + 7u) / 8u;
+
+    // a 2 KiB message received in 64 byte chunks: loading it again from the start after every chunk, vs continuing
+    printf("  2 KiB message in %zu byte chunks:\n", chunk_size);
+    print_result(
+        "retry from start vs incremental_loader",
+        nanoseconds_per_op([&]()
+                           {
+                               for (size_t received = 0; received < size; received += chunk_size)
+                               {
+                                   const size_t received_size = size - received < chunk_size ? size - received : chunk_size;
+                                   std::memcpy(&staging[received], &serial_data[received], received_size);
+                                   if (loaded.load(&staging[0], received + received_size).status != serdes::status_e::EXCEEDED_SERIAL_SIZE)
+                                       break;
+                               }
+                               benchmark_sink = loaded.samples[benchmark_sink & 1023u]; },
+                           1u),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::incremental_loader<benchmark_stream_message> loader(loaded, staging);
+                               for (size_t received = 0; loader.status() == serdes::status_e::NEED_MORE_DATA; received += chunk_size)
+                                   loader.feed(&serial_data[received], size - received < chunk_size ? size - received : chunk_size);
+                               benchmark_sink = loaded.samples[benchmark_sink & 1023u]; },
+                           1u));
+}
+
+struct benchmark_segmented_message : serdes::packet_base
+{
+    uint8_t type = 0;
+    uint16_t length = 0;
+    uint32_t sequence = 0;
+    uint16_t samples[512] = {};
+    uint32_t crc = 0;
+
+    void format(serdes::packet &p) override
+    {
+        p + type + length + serdes::bitpack<uint32_t, int>(sequence, 24) + serdes::array<uint16_t, uint16_t>(samples, length, 512u) + crc;
+    }
+};
+
+static void benchmark_segmented_packet()
+{
+    static benchmark_segmented_message sent, loaded;
+    static uint8_t serial_data[1040], staging[1040];
+    sent.length = 512;
+    for (size_t i = 0; i < 512u; i++)
+        sent.samples[i] = static_cast<uint16_t>(0x9E37u * (i + 1u));
+    sent.store(serial_data);
+
+    // a 1 KiB message in 4 chained buffers (with odd sizes, so fields straddle them): copying them into one buffer
+    // to load it, vs loading the segments in place. Fields inside a segment are copied in place, but still out of
+    // line, and each segment and straddling field costs a virtual call, so for a message this small the segments
+    // save the staging buffer rather than time (the copy is cheap)
+    const serdes::buffer_segment segments[] = {{&serial_data[0], 7u}, {&serial_data[7], 301u}, {&serial_data[308], 499u}, {&serial_data[807], 233u}};
+    printf("  1 KiB message in 4 segments:\n");
+    print_result(
+        "gather copy + load vs segmented_packet load",
+        nanoseconds_per_op([&]()
+                           {
+                               size_t gathered = 0u;
+                               for (const auto &segment : segments)
+                               {
+                                   std::memcpy(&staging[gathered], segment.data, segment.size);
+                                   gathered += segment.size;
+                               }
+                               loaded.load(&staging[0], gathered);
+                               benchmark_sink = loaded.samples[benchmark_sink & 511u]; },
+                           1u),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::segmented_packet(segments) >> loaded;
+                               benchmark_sink = loaded.samples[benchmark_sink & 511u]; },
+                           1u));
+}
+
+static void benchmark_word_sink()
+{
+    static benchmark_segmented_message sent;
+    static uint32_t serial_words[260];
+    sent.length = 512;
+    for (size_t i = 0; i < 512u; i++)
+        sent.samples[i] = static_cast<uint16_t>(0x9E37u * (i + 1u));
+
+    // a FIFO that takes 32 bit words (folded into the benchmark sink, so they're all read)
+    auto fifo = [&](const uint32_t *words, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i)
+            benchmark_sink ^= words[i];
+    };
+
+    // storing a 1 KiB message into a buffer of words and then writing them to the FIFO, vs handing the words to it
+    // from a 256 byte window while storing
+    printf("  1 KiB message to a 32 bit word FIFO:\n");
+    print_result(
+        "store + write out vs word_sink_packet",
+        nanoseconds_per_op([&]()
+                           {
+                               const auto stored = sent.store(serial_words);
+                               fifo(serial_words, (stored.bits + 31u) / 32u); },
+                           1u),
+        nanoseconds_per_op([&]()
+                           {
+                               serdes::word_sink_packet<uint32_t, 64, 8> pkt(fifo);
+                               pkt << sent;
+                               pkt.finish(); },
+                           1u));
+}
+
+// a storage device that reads at ~1 GB/s (1 microsecond per KiB, spent waiting like a real read), over a capture
+// in memory
+struct benchmark_slow_device
+{
+    const uint8_t *data;
+    size_t size;
+    size_t position;
+
+    static size_t read(const serdes::byte_source &source, uint8_t *dest, size_t size)
+    {
+        benchmark_slow_device &device = *static_cast<benchmark_slow_device *>(source.object);
+        std::this_thread::sleep_for(std::chrono::microseconds(size / 1024u));
+        const size_t copied = size < device.size - device.position ? size : device.size - device.position;
+        std::memcpy(dest, &device.data[device.position], copied);
+        device.position += copied;
+        return copied;
+    }
+};
+
+static void benchmark_record_reader()
+{
+    constexpr size_t records = 1024u;
+    static benchmark_segmented_message sent, loaded;
+    static uint8_t whole_file[records * 1040u], window[1u << 18], read_ahead[1u << 18];
+    sent.length = 512;
+    for (size_t i = 0; i < 512u; i++)
+        sent.samples[i] = static_cast<uint16_t>(0x9E37u * (i + 1u));
+    const size_t record_bytes = (sent.store(whole_file).bits + 7u) / 8u;
+    for (size_t i = 1; i < records; i++)
+        std::memcpy(&whole_file[i * record_bytes], whole_file, record_bytes);
+    std::FILE *file = std::tmpfile();
+    if (file == nullptr)
+        return;
+    std::fwrite(whole_file, 1u, records * record_bytes, file);
+
+    // a ~1 MiB capture file of back-to-back records: reading all of it into memory and then loading the records,
+    // vs loading them through a 64 KiB window
+    printf("  1 KiB records from a file:\n");
+    print_result(
+        "read whole file + load vs record_reader",
+        nanoseconds_per_op([&]()
+                           {
+                               std::rewind(file);
+                               const size_t size = std::fread(whole_file, 1u, sizeof(whole_file), file);
+                               for (size_t offset = 0; offset < size; offset += record_bytes)
+                                   loaded.load(&whole_file[offset], size - offset);
+                               benchmark_sink = loaded.samples[benchmark_sink & 511u]; },
+                           records),
+        nanoseconds_per_op([&]()
+                           {
+                               std::rewind(file);
+                               serdes::record_reader reader(serdes::file_source(file), &window[0], 1u << 16);
+                               while (reader.next(loaded).status == serdes::status_e::NO_ERROR)
+                                   benchmark_sink = loaded.samples[benchmark_sink & 511u]; },
+                           records));
+    std::fclose(file);
+
+    // the same records from a device that waits for its reads: refilling a 256 KiB window on the calling thread,
+    // vs reading ahead into two 128 KiB blocks while the records are loaded (the opt-in thread only overlaps the
+    // waits with the loads when another core is free, on a single core it's expected to be slower)
+    printf("  1 KiB records from a ~1 GB/s device:\n");
+    print_result(
+        "record_reader vs read-ahead thread",
+        nanoseconds_per_op([&]()
+                           {
+                               benchmark_slow_device device{whole_file, records * record_bytes, 0u};
+                               serdes::record_reader reader(serdes::byte_source{&benchmark_slow_device::read, &device, -1}, window);
+                               while (reader.next(loaded).status == serdes::status_e::NO_ERROR)
+                                   benchmark_sink = loaded.samples[benchmark_sink & 511u]; },
+                           records),
+        nanoseconds_per_op([&]()
+                           {
+                               benchmark_slow_device device{whole_file, records * record_bytes, 0u};
+                               serdes::record_reader reader(serdes::byte_source{&benchmark_slow_device::read, &device, -1}, window, read_ahead);
+                               while (reader.next(loaded).status == serdes::status_e::NO_ERROR)
+                                   benchmark_sink = loaded.samples[benchmark_sink & 511u]; },
+                           records));
+}
+
+int main()
+{
+    benchmark_wide_byte_bitcpy<uint16_t>("uint8_t[] bitcpy uint16_t", 12);
+    benchmark_wide_byte_bitcpy<uint32_t>("uint8_t[] bitcpy uint32_t", 20);
+    benchmark_wide_byte_bitcpy<uint32_t>("uint8_t[] bitcpy uint32_t", 31);
+    benchmark_wide_byte_bitcpy<uint64_t>("uint8_t[] bitcpy uint64_t", 45);
+    benchmark_wide_byte_bitcpy<uint64_t>("uint8_t[] bitcpy uint64_t", 57);
+    benchmark_bitpacked_array<uint8_t>("uint8_t[] 12 bit uint16_t array");
+    benchmark_bitpacked_array<uint16_t>("uint16_t[] 12 bit uint16_t array");
+    benchmark_bitpacked_array<uint32_t>("uint32_t[] 12 bit uint16_t array");
+    benchmark_typed_packet<uint8_t>("uint8_t[] typed_packet frame");
+    benchmark_typed_packet<uint16_t>("uint16_t[] typed_packet frame");
+    benchmark_typed_packet<uint32_t>("uint32_t[] typed_packet frame");
+    benchmark_typed_packet<uint64_t>("uint64_t[] typed_packet frame");
+    benchmark_unchecked_packet<uint8_t>("uint8_t[] unchecked_packet frame");
+    benchmark_unchecked_packet<uint32_t>("uint32_t[] unchecked_packet frame");
+    benchmark_bit_stream_packet<uint8_t>("uint8_t[] bit_stream_packet");
+    benchmark_bit_stream_packet<uint32_t>("uint32_t[] bit_stream_packet");
+    benchmark_static_packet();
+    benchmark_static_packet_base();
+    benchmark_little_endian();
+    benchmark_lsb_first();
+    benchmark_bitmove();
+    benchmark_bool_arrays();
+    benchmark_cpu_dispatch();
+    benchmark_static_format();
+    benchmark_host_layout_passthrough();
+    benchmark_serialized_bits();
+    benchmark_compiled_format();
+    benchmark_formatter();
+    benchmark_field_group();
+    benchmark_incremental_loads();
+    benchmark_segmented_packet();
+    benchmark_word_sink();
+    benchmark_record_reader();
+    return 0;
+}
@@ -400,6 +400,224 @@ static void test_from_array_sized_pointers()
     }
 }
 
+static void test_from_array_wide_byte_kernel()
+{
+    // the size safe uint8_t path reads multi byte fields with one 64 bit load, it must match the
+    // reference element-by-element path everywhere, including windows shifted back from the buffer end
+    const uint8_t pattern[12] = {0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54, 0x32, 0x10, 0x8F, 0x1E, 0x2D, 0x3C};
+    size_t mismatches = 0;
+    for (size_t size = 1; size <= sizeof(pattern); size++)
+    {
+        for (size_t bits = 1; bits <= 64; bits++)
+        {
+            for (size_t bit_offset = 0; bit_offset + bits <= size * 8u; bit_offset++)
+            {
+                uint64_t expected = 0, actual = 0;
+                int32_t expected_signed = 0, actual_signed = 0;
+                serdes::bitcpy(expected, pattern, bit_offset, bits);
+                serdes::bitcpy(actual, serdes::sized_pointer<const uint8_t>(pattern, size), bit_offset, bits);
+                serdes::bitcpy(expected_signed, pattern, bit_offset, bits);
+                serdes::bitcpy(actual_signed, serdes::sized_pointer<void>(pattern, size), bit_offset, bits);
+                mismatches += (expected != actual) + (expected_signed != actual_signed);
+            }
+        }
+    }
+    ASSERT_EQUALS(mismatches, size_t(0));
+}
+
+static void test_from_array_little_endian()
+{
+    // whole bytes are read least significant byte first, followed by any remaining high bits
+    const uint8_t aligned[4] = {0x44, 0x33, 0x22, 0x11};
+    const uint8_t unaligned[5] = {0x04, 0x43, 0x32, 0x21, 0x10};
+    const uint8_t partial[2] = {0xBC, 0xA0};
+    uint32_t u32 = 0;
+    ASSERT_EQUALS(serdes::little_endian_bitcpy(u32, aligned), 32_zu);
+    ASSERT_EQUALS(u32, 0x11223344_u32);
+    u32 = 0;
+    serdes::little_endian_bitcpy(u32, unaligned, 4);
+    ASSERT_EQUALS(u32, 0x11223344_u32);
+    uint16_t u16 = 0;
+    serdes::little_endian_bitcpy(u16, partial, 0, 12);
+    ASSERT_EQUALS(u16, 0xABC_u16);
+    int16_t i16 = 0;
+    serdes::little_endian_bitcpy(i16, partial, 0, 12);
+    ASSERT_EQUALS(i16, static_cast<int16_t>(-1348));
+
+    // wider arrays, and sized arrays
+    const uint16_t words[2] = {0x0000, 0x803F};
+    float f = 0.0f;
+    serdes::little_endian_bitcpy(f, words);
+    ASSERT_EQUALS(f, 1.0f);
+    ASSERT_EQUALS(serdes::little_endian_bitcpy(u16, serdes::sized_pointer<const uint16_t>(words), 24, 16), 0_zu);
+    const uint16_t word[1] = {0xFEFF};
+    const serdes::sized_pointer<void> punned(word);
+    ASSERT_EQUALS(serdes::little_endian_bitcpy(i16, punned), 16_zu);
+    ASSERT_EQUALS(i16, static_cast<int16_t>(-2));
+
+    // every width and offset matches reading the bytes one at a time with a regular bitcpy
+    size_t mismatches = 0;
+    for (size_t bits = 1; bits <= 64; bits++)
+    {
+        for (size_t bit_offset = 0; bit_offset < 16; bit_offset++)
+        {
+            uint8_t serial[10];
+            for (size_t i = 0; i < sizeof(serial); i++)
+                serial[i] = static_cast<uint8_t>(0x9E3779B97F4A7C15_u64 >> ((i + bit_offset + bits) % 57u));
+            uint64_t expected = 0;
+            size_t i = 0;
+            for (; i + 8u <= bits; i += 8u)
+            {
+                uint8_t byte = 0;
+                serdes::bitcpy(byte, serial, bit_offset + i, 8);
+                expected |= static_cast<uint64_t>(byte) << i;
+            }
+            if (i < bits)
+            {
+                uint8_t tail = 0;
+                serdes::bitcpy(tail, serial, bit_offset + i, bits - i);
+                expected |= static_cast<uint64_t>(tail) << i;
+            }
+            uint64_t actual = 0xA5A5A5A5A5A5A5A5_u64;
+            mismatches += serdes::little_endian_bitcpy(actual, serial, bit_offset, bits) != bits;
+            mismatches += actual != expected;
+
+            // signed values are sign extended from the top bit of the field
+            int64_t actual_signed = 0;
+            serdes::little_endian_bitcpy(actual_signed, serial, bit_offset, bits);
+            const uint64_t sign_extension = (bits < 64u && ((expected >> (bits - 1u)) & 1u)) ? ~0_u64 << bits : 0u;
+            mismatches += static_cast<uint64_t>(actual_signed) != (expected | sign_extension);
+        }
+    }
+    ASSERT_EQUALS(mismatches, 0_zu);
+}
+
+template <typename T_array>
+static size_t lsb_first_from_array_mismatches()
+{
+    constexpr size_t element_bits = sizeof(T_array) * 8u;
+    constexpr size_t serial_size = 24 / sizeof(T_array);
+    T_array serial[serial_size];
+    for (size_t i = 0; i < serial_size; i++)
+        serial[i] = static_cast<T_array>(0x9E3779B97F4A7C15_u64 * (i + 1u));
+    size_t mismatches = 0;
+    for (size_t bits = 1; bits <= 64; bits++)
+    {
+        for (size_t bit_offset = 0; bit_offset + bits <= serial_size * element_bits; bit_offset++)
+        {
+            uint64_t expected = 0;
+            for (size_t i = 0; i < bits; i++)
+            {
+                const size_t bit = bit_offset + i;
+                expected |= static_cast<uint64_t>((serial[bit / element_bits] >> (bit % element_bits)) & 1u) << i;
+            }
+            uint64_t raw = 0xA5A5A5A5A5A5A5A5_u64, sized = 0xA5A5A5A5A5A5A5A5_u64;
+            mismatches += serdes::lsb_first_bitcpy(raw, &serial[0], bit_offset, bits) != bits;
+            mismatches += serdes::lsb_first_bitcpy(sized, serdes::sized_pointer<const T_array>(serial), bit_offset, bits) != bits;
+            mismatches += raw != expected;
+            mismatches += sized != expected;
+        }
+    }
+    return mismatches;
+}
+
+static void test_from_array_lsb_first()
+{
+    // a 10 bit CAN "Intel" signal starting at bit 12
+    const uint8_t frame[8] = {0x00, 0xB0, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00};
+    uint16_t signal = 0;
+    ASSERT_EQUALS(serdes::lsb_first_bitcpy(signal, frame, 12, 10), 10_zu);
+    ASSERT_EQUALS(signal, 0x2AB_u16);
+
+    // sub-byte signals are unpacked from the least significant bit up
+    const uint8_t report[2] = {0xFB, 0x03};
+    bool pressed = false;
+    uint8_t buttons = 0;
+    int8_t delta = 0;
+    serdes::lsb_first_bitcpy(pressed, report, 0, 1);
+    serdes::lsb_first_bitcpy(buttons, report, 1, 3);
+    serdes::lsb_first_bitcpy(delta, report, 4, 6);
+    ASSERT_EQUALS(pressed, true);
+    ASSERT_EQUALS(buttons, 0x5_u8);
+    ASSERT_EQUALS(delta, static_cast<int8_t>(-1));
+
+    // wider arrays, and sized arrays
+    const uint16_t words[2] = {0x4500, 0xF123};
+    uint32_t u32 = 0;
+    serdes::lsb_first_bitcpy(u32, words, 8, 20);
+    ASSERT_EQUALS(u32, 0x12345_u32);
+    ASSERT_EQUALS(serdes::lsb_first_bitcpy(u32, serdes::sized_pointer<const uint16_t>(words), 24, 16), 0_zu);
+    const serdes::sized_pointer<void> punned(words);
+    uint8_t nibble = 0;
+    ASSERT_EQUALS(serdes::lsb_first_bitcpy(nibble, punned, 28, 4), 4_zu);
+    ASSERT_EQUALS(nibble, 0xF_u8);
+
+    // every width and offset matches reading the bits one at a time
+    ASSERT_EQUALS(lsb_first_from_array_mismatches<uint8_t>(), 0_zu);
+    ASSERT_EQUALS(lsb_first_from_array_mismatches<uint16_t>(), 0_zu);
+    ASSERT_EQUALS(lsb_first_from_array_mismatches<uint32_t>(), 0_zu);
+    ASSERT_EQUALS(lsb_first_from_array_mismatches<uint64_t>(), 0_zu);
+}
+
+template <size_t BitOffset, size_t Bits, typename T_val, typename T_array>
+static size_t static_from_array_mismatches(const T_array *const source)
+{
+    T_val expected{}, actual{};
+    serdes::bitcpy(expected, source, BitOffset, Bits);
+    const size_t bits_copied = serdes::bitcpy<BitOffset, Bits>(actual, source);
+    return static_cast<size_t>(std::memcmp(&expected, &actual, sizeof(T_val)) != 0) + static_cast<size_t>(bits_copied != Bits);
+}
+
+template <typename T_array>
+static size_t static_from_array_mismatches()
+{
+    const uint8_t pattern[32] = {0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54, 0x32, 0x10, 0x8F, 0x1E, 0x2D, 0x3C, 0x4B, 0x5A, 0x69, 0x78,
+                                 0x87, 0x96, 0xA5, 0xB4, 0xC3, 0xD2, 0xE1, 0xF0, 0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF};
+    T_array source[32 / sizeof(T_array)] = {};
+    serdes::bitcpy(serdes::sized_pointer<T_array>(source), serdes::sized_pointer<const uint8_t>(pattern));
+    return static_from_array_mismatches<0, 1, bool>(source) +
+           static_from_array_mismatches<13, 1, bool>(source) +
+           static_from_array_mismatches<0, 8, uint8_t>(source) +
+           static_from_array_mismatches<5, 7, uint8_t>(source) +
+           static_from_array_mismatches<6, 12, uint16_t>(source) +
+           static_from_array_mismatches<20, 12, int16_t>(source) +
+           static_from_array_mismatches<17, 32, uint32_t>(source) +
+           static_from_array_mismatches<63, 3, int32_t>(source) +
+           static_from_array_mismatches<40, 24, int32_t>(source) +
+           static_from_array_mismatches<3, 32, float>(source) +
+           static_from_array_mismatches<64, 64, uint64_t>(source) +
+           static_from_array_mismatches<71, 64, uint64_t>(source) +
+           static_from_array_mismatches<127, 57, int64_t>(source) +
+           static_from_array_mismatches<131, 64, double>(source);
+}
+
+#if BITCPY_CONSTEXPR_SUPPORTED
+constexpr uint16_t constexpr_static_from_array()
+{
+    const uint8_t hardware_register[] = {0x12, 0x34, 0x56};
+    uint16_t x = 0;
+    serdes::bitcpy<4, 12>(x, hardware_register);
+    int8_t y = 0;
+    serdes::bitcpy<12, 5>(y, hardware_register);
+    return static_cast<uint16_t>(x + y);
+}
+static_assert(constexpr_static_from_array() == 0x234 + 0x8, "compile time bitcpy must be usable in constant expressions");
+#endif
+
+static void test_from_array_static_positions()
+{
+    ASSERT_EQUALS(static_from_array_mismatches<uint8_t>(), size_t(0));
+    ASSERT_EQUALS(static_from_array_mismatches<uint16_t>(), size_t(0));
+    ASSERT_EQUALS(static_from_array_mismatches<uint32_t>(), size_t(0));
+    ASSERT_EQUALS(static_from_array_mismatches<uint64_t>(), size_t(0));
+    {
+        const uint16_t hardware_register[] = {0xABCD, 0xEF01};
+        uint32_t x = 0;
+        ASSERT_EQUALS(serdes::bitcpy<12, 12>(x, hardware_register), size_t(12));
+        ASSERT_EQUALS(x, 0xDEF_u32);
+    }
+}
+
 static void test_from_array_zero_bits()
 {
     uint16_t x = 123;
@@ -422,6 +640,10 @@ static void testset_from_array()
     test_from_array_signed();
     test_from_array_pointers();
     test_from_array_sized_pointers();
+    test_from_array_wide_byte_kernel();
+    test_from_array_static_positions();
+    test_from_array_little_endian();
+    test_from_array_lsb_first();
     test_from_array_zero_bits();
 }
 
@@ -335,6 +335,270 @@ static void test_to_array_sized_pointers()
     }
 }
 
+static void test_to_array_little_endian()
+{
+    // whole bytes are written least significant byte first
+    uint8_t buffer[5] = {};
+    ASSERT_EQUALS(serdes::little_endian_bitcpy(buffer, 0x11223344_u32), 32_zu);
+    ASSERT_EQUALS(buffer, {0x44, 0x33, 0x22, 0x11, 0x00});
+    std::fill(buffer, buffer + 5, 0);
+    serdes::little_endian_bitcpy(buffer, 0x11223344_u32, 4);
+    ASSERT_EQUALS(buffer, {0x04, 0x43, 0x32, 0x21, 0x10});
+
+    // followed by any remaining high bits
+    uint8_t partial[2] = {};
+    serdes::little_endian_bitcpy(partial, 0xABC_u16, 0, 12);
+    ASSERT_EQUALS(partial, {0xBC, 0xA0});
+
+    // wider arrays, and sized arrays
+    uint16_t words[2] = {};
+    serdes::little_endian_bitcpy(words, 1.0f);
+    ASSERT_EQUALS(words, {0x0000, 0x803F});
+    ASSERT_EQUALS(serdes::little_endian_bitcpy(serdes::sized_pointer<uint16_t>(words), 0x1234_u16, 24, 16), 0_zu);
+    serdes::sized_pointer<void> punned(words);
+    ASSERT_EQUALS(serdes::little_endian_bitcpy(punned, static_cast<int16_t>(-2)), 16_zu);
+    ASSERT_EQUALS(words, {0xFEFF, 0x803F});
+
+    // every width and offset matches writing the bytes one at a time with a regular bitcpy
+    size_t mismatches = 0;
+    for (size_t bits = 1; bits <= 64; bits++)
+    {
+        for (size_t bit_offset = 0; bit_offset < 16; bit_offset++)
+        {
+            uint8_t expected[10], actual[10];
+            std::fill(expected, expected + sizeof(expected), 0xA5);
+            std::fill(actual, actual + sizeof(actual), 0xA5);
+            const uint64_t value = 0x0123456789ABCDEF_u64 ^ (bit_offset * 0x9E3779B97F4A7C15_u64);
+            size_t i = 0;
+            for (; i + 8u <= bits; i += 8u)
+                serdes::bitcpy(expected, static_cast<uint8_t>(value >> i), bit_offset + i, 8);
+            if (i < bits)
+                serdes::bitcpy(expected, value >> i, bit_offset + i, bits - i);
+            mismatches += serdes::little_endian_bitcpy(actual, value, bit_offset, bits) != bits;
+            mismatches += !std::equal(expected, expected + sizeof(expected), actual);
+        }
+    }
+    ASSERT_EQUALS(mismatches, 0_zu);
+}
+
+template <typename T_array>
+static size_t lsb_first_to_array_mismatches()
+{
+    constexpr size_t element_bits = sizeof(T_array) * 8u;
+    constexpr size_t serial_size = 24 / sizeof(T_array);
+    size_t mismatches = 0;
+    for (size_t bits = 1; bits <= 64; bits++)
+    {
+        for (size_t bit_offset = 0; bit_offset < 2u * element_bits && bit_offset + bits <= serial_size * element_bits; bit_offset++)
+        {
+            T_array expected[serial_size], actual[serial_size];
+            std::fill(expected, expected + serial_size, static_cast<T_array>(0xA5A5A5A5A5A5A5A5_u64));
+            std::fill(actual, actual + serial_size, static_cast<T_array>(0xA5A5A5A5A5A5A5A5_u64));
+            const uint64_t value = 0x0123456789ABCDEF_u64 ^ (bit_offset * 0x9E3779B97F4A7C15_u64);
+            for (size_t i = 0; i < bits; i++)
+            {
+                const size_t bit = bit_offset + i;
+                const T_array mask = static_cast<T_array>(T_array(1u) << (bit % element_bits));
+                expected[bit / element_bits] = static_cast<T_array>(((value >> i) & 1u) ? (expected[bit / element_bits] | mask) : (expected[bit / element_bits] & ~mask));
+            }
+            mismatches += serdes::lsb_first_bitcpy(actual, value, bit_offset, bits) != bits;
+            mismatches += !std::equal(expected, expected + serial_size, actual);
+        }
+    }
+    return mismatches;
+}
+
+static void test_to_array_lsb_first()
+{
+    // a 10 bit CAN "Intel" signal starting at bit 12
+    uint8_t frame[8] = {};
+    ASSERT_EQUALS(serdes::lsb_first_bitcpy(frame, 0x2AB_u16, 12, 10), 10_zu);
+    ASSERT_EQUALS(frame, {0x00, 0xB0, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00});
+
+    // sub-byte signals are packed from the least significant bit up
+    uint8_t report[2] = {};
+    serdes::lsb_first_bitcpy(report, true, 0, 1);
+    serdes::lsb_first_bitcpy(report, 0x5_u8, 1, 3);
+    serdes::lsb_first_bitcpy(report, static_cast<int8_t>(-1), 4, 6);
+    ASSERT_EQUALS(report, {0xFB, 0x03});
+
+    // wider arrays, and sized arrays
+    uint16_t words[2] = {};
+    serdes::lsb_first_bitcpy(words, 0x12345_u32, 8, 20);
+    ASSERT_EQUALS(words, {0x4500, 0x0123});
+    ASSERT_EQUALS(serdes::lsb_first_bitcpy(serdes::sized_pointer<uint16_t>(words), 0x1234_u16, 24, 16), 0_zu);
+    serdes::sized_pointer<void> punned(words);
+    ASSERT_EQUALS(serdes::lsb_first_bitcpy(punned, 0xF_u8, 28, 4), 4_zu);
+    ASSERT_EQUALS(words, {0x4500, 0xF123});
+
+    // every width and offset matches setting the bits one at a time
+    ASSERT_EQUALS(lsb_first_to_array_mismatches<uint8_t>(), 0_zu);
+    ASSERT_EQUALS(lsb_first_to_array_mismatches<uint16_t>(), 0_zu);
+    ASSERT_EQUALS(lsb_first_to_array_mismatches<uint32_t>(), 0_zu);
+    ASSERT_EQUALS(lsb_first_to_array_mismatches<uint64_t>(), 0_zu);
+}
+
+// MSB first bit "n" of a serial array, for checking bitmove one bit at a time
+template <typename T_array>
+static bool serial_bit(const T_array *const array, const size_t n)
+{
+    constexpr size_t element_bits = sizeof(T_array) * 8u;
+    return ((array[n / element_bits] >> (element_bits - 1u - n % element_bits)) & 1u) != 0u;
+}
+
+template <typename T_dest, typename T_source>
+static size_t bitmove_mismatches()
+{
+    constexpr size_t dest_size = 64 / sizeof(T_dest);
+    constexpr size_t source_size = 64 / sizeof(T_source);
+    constexpr size_t bit_counts[] = {1, 5, 8, 13, 63, 64, 65, 130, 300};
+    size_t mismatches = 0;
+    for (const size_t bits : bit_counts)
+    {
+        for (size_t dest_bit_offset = 0; dest_bit_offset < 70u; dest_bit_offset += 3u)
+        {
+            for (size_t source_bit_offset = 0; source_bit_offset < 70u; source_bit_offset++)
+            {
+                T_dest dest[dest_size];
+                T_source source[source_size];
+                for (size_t i = 0; i < dest_size; i++)
+                    dest[i] = static_cast<T_dest>(0xA5A5A5A5A5A5A5A5_u64);
+                for (size_t i = 0; i < source_size; i++)
+                    source[i] = static_cast<T_source>((i + 1u) * 0x9E3779B97F4A7C15_u64);
+                T_dest before[dest_size];
+                std::copy(dest, dest + dest_size, before);
+                mismatches += serdes::bitmove(serdes::sized_pointer<T_dest>(dest), dest_bit_offset, serdes::sized_pointer<const T_source>(source), source_bit_offset, bits) != bits;
+                for (size_t n = 0; n < dest_size * sizeof(T_dest) * 8u; n++)
+                {
+                    const bool moved = n >= dest_bit_offset && n < dest_bit_offset + bits;
+                    mismatches += serial_bit(dest, n) != (moved ? serial_bit(source, n - dest_bit_offset + source_bit_offset) : serial_bit(before, n));
+                }
+            }
+        }
+    }
+    return mismatches;
+}
+
+template <typename T_array>
+static size_t overlapping_bitmove_mismatches()
+{
+    constexpr size_t serial_size = 64 / sizeof(T_array);
+    constexpr size_t bit_counts[] = {1, 9, 64, 77, 200};
+    size_t mismatches = 0;
+    for (const size_t bits : bit_counts)
+    {
+        for (size_t dest_bit_offset = 0; dest_bit_offset < 140u; dest_bit_offset += 5u)
+        {
+            for (size_t source_bit_offset = 0; source_bit_offset < 140u; source_bit_offset++)
+            {
+                T_array array[serial_size], before[serial_size];
+                for (size_t i = 0; i < serial_size; i++)
+                    array[i] = before[i] = static_cast<T_array>((i + 1u) * 0x9E3779B97F4A7C15_u64);
+                mismatches += serdes::bitmove(serdes::sized_pointer<T_array>(array), dest_bit_offset, serdes::sized_pointer<T_array>(array), source_bit_offset, bits) != bits;
+                for (size_t n = 0; n < serial_size * sizeof(T_array) * 8u; n++)
+                {
+                    const bool moved = n >= dest_bit_offset && n < dest_bit_offset + bits;
+                    mismatches += serial_bit(array, n) != serial_bit(before, moved ? n - dest_bit_offset + source_bit_offset : n);
+                }
+            }
+        }
+    }
+    return mismatches;
+}
+
+static void test_to_array_bitmove()
+{
+    // unaligned, and same alignment (the middle byte is a memmove)
+    uint8_t source[4] = {0x12, 0x34, 0x56, 0x78};
+    uint8_t dest[4] = {};
+    ASSERT_EQUALS(serdes::bitmove(serdes::sized_pointer<uint8_t>(dest), 4, serdes::sized_pointer<uint8_t>(source), 0, 16), 16_zu);
+    ASSERT_EQUALS(dest, {0x01, 0x23, 0x40, 0x00});
+    ASSERT_EQUALS(serdes::bitmove(serdes::sized_pointer<uint8_t>(dest), 12, serdes::sized_pointer<uint8_t>(source), 4, 20), 20_zu);
+    ASSERT_EQUALS(dest, {0x01, 0x22, 0x34, 0x56});
+
+    // different widths, type punned arrays, and in place shifts in both directions
+    uint16_t words[2] = {};
+    serdes::sized_pointer<void> punned_words(words);
+    ASSERT_EQUALS(serdes::bitmove(punned_words, 8, serdes::sized_pointer<uint8_t>(source), 0, 24), 24_zu);
+    ASSERT_EQUALS(words, {0x0012, 0x3456});
+    ASSERT_EQUALS(serdes::bitmove(serdes::sized_pointer<uint16_t>(words), 4, serdes::sized_pointer<uint16_t>(words), 8, 24), 24_zu);
+    ASSERT_EQUALS(words, {0x0123, 0x4566});
+    ASSERT_EQUALS(serdes::bitmove(serdes::sized_pointer<uint16_t>(words), 8, serdes::sized_pointer<uint16_t>(words), 4, 24), 24_zu);
+    ASSERT_EQUALS(words, {0x0112, 0x3456});
+
+    // ranges that don't fit, and overlapping arrays of different types, aren't moved
+    ASSERT_EQUALS(serdes::bitmove(serdes::sized_pointer<uint8_t>(dest), 17, serdes::sized_pointer<uint8_t>(source), 0, 16), 0_zu);
+    ASSERT_EQUALS(serdes::bitmove(serdes::sized_pointer<uint8_t>(dest), 0, serdes::sized_pointer<uint8_t>(source), 24, 9), 0_zu);
+    ASSERT_EQUALS(serdes::bitmove(serdes::sized_pointer<uint8_t>(reinterpret_cast<uint8_t *>(words), 4), 0, serdes::sized_pointer<uint16_t>(words), 4, 8), 0_zu);
+    ASSERT_EQUALS(dest, {0x01, 0x22, 0x34, 0x56});
+
+    // every combination matches moving the bits one at a time
+    ASSERT_EQUALS((bitmove_mismatches<uint8_t, uint8_t>()), 0_zu);
+    ASSERT_EQUALS((bitmove_mismatches<uint16_t, uint16_t>()), 0_zu);
+    ASSERT_EQUALS((bitmove_mismatches<uint64_t, uint64_t>()), 0_zu);
+    ASSERT_EQUALS((bitmove_mismatches<uint8_t, uint32_t>()), 0_zu);
+    ASSERT_EQUALS((bitmove_mismatches<uint64_t, uint8_t>()), 0_zu);
+    ASSERT_EQUALS((bitmove_mismatches<uint32_t, uint16_t>()), 0_zu);
+    ASSERT_EQUALS(overlapping_bitmove_mismatches<uint8_t>(), 0_zu);
+    ASSERT_EQUALS(overlapping_bitmove_mismatches<uint16_t>(), 0_zu);
+    ASSERT_EQUALS(overlapping_bitmove_mismatches<uint32_t>(), 0_zu);
+    ASSERT_EQUALS(overlapping_bitmove_mismatches<uint64_t>(), 0_zu);
+}
+
+template <size_t BitOffset, size_t Bits, typename T_array, typename T_val>
+static size_t static_to_array_mismatches(const T_val value)
+{
+    T_array expected[32 / sizeof(T_array)], actual[32 / sizeof(T_array)];
+    std::fill(expected, expected + 32 / sizeof(T_array), static_cast<T_array>(0xA5A5A5A5A5A5A5A5_u64));
+    std::fill(actual, actual + 32 / sizeof(T_array), static_cast<T_array>(0xA5A5A5A5A5A5A5A5_u64));
+    serdes::bitcpy(expected, value, BitOffset, Bits);
+    const size_t bits_copied = serdes::bitcpy<BitOffset, Bits>(actual, value);
+    return static_cast<size_t>(!std::equal(expected, expected + 32 / sizeof(T_array), actual)) + static_cast<size_t>(bits_copied != Bits);
+}
+
+template <typename T_array>
+static size_t static_to_array_mismatches()
+{
+    return static_to_array_mismatches<0, 1, T_array>(true) +
+           static_to_array_mismatches<13, 1, T_array>(false) +
+           static_to_array_mismatches<0, 8, T_array>(0x5A_u8) +
+           static_to_array_mismatches<5, 7, T_array>(0xFF_u8) +
+           static_to_array_mismatches<6, 12, T_array>(0x1234_u16) +
+           static_to_array_mismatches<20, 12, T_array>(int16_t(-3)) +
+           static_to_array_mismatches<17, 32, T_array>(0x89ABCDEF_u32) +
+           static_to_array_mismatches<63, 3, T_array>(int32_t(-1)) +
+           static_to_array_mismatches<40, 24, T_array>(int32_t(-123456)) +
+           static_to_array_mismatches<3, 32, T_array>(-1.5f) +
+           static_to_array_mismatches<64, 64, T_array>(0x0123456789ABCDEF_u64) +
+           static_to_array_mismatches<71, 64, T_array>(0xFEDCBA9876543210_u64) +
+           static_to_array_mismatches<127, 57, T_array>(int64_t(-99)) +
+           static_to_array_mismatches<131, 64, T_array>(3.25);
+}
+
+#if BITCPY_CONSTEXPR_SUPPORTED
+constexpr uint32_t constexpr_static_to_array()
+{
+    uint8_t hardware_register[3] = {0xFF, 0x00, 0xFF};
+    serdes::bitcpy<4, 12>(hardware_register, 0xABC_u16);
+    serdes::bitcpy<20, 2>(hardware_register, int8_t(-2));
+    return (static_cast<uint32_t>(hardware_register[0]) << 16) | (static_cast<uint32_t>(hardware_register[1]) << 8) | hardware_register[2];
+}
+static_assert(constexpr_static_to_array() == 0xFABCFB, "compile time bitcpy must be usable in constant expressions");
+#endif
+
+static void test_to_array_static_positions()
+{
+    ASSERT_EQUALS(static_to_array_mismatches<uint8_t>(), size_t(0));
+    ASSERT_EQUALS(static_to_array_mismatches<uint16_t>(), size_t(0));
+    ASSERT_EQUALS(static_to_array_mismatches<uint32_t>(), size_t(0));
+    ASSERT_EQUALS(static_to_array_mismatches<uint64_t>(), size_t(0));
+    {
+        uint16_t hardware_register[] = {0xFFFF, 0xFFFF};
+        ASSERT_EQUALS(serdes::bitcpy<12, 12>(hardware_register, 0x123_u16), size_t(12));
+        test_cmp_arrays<uint16_t, false>(hardware_register, {0xFFF1_u16, 0x23FF_u16});
+    }
+}
+
 static void test_to_array_pointers()
 {
     uintptr_t buffer[3] = {};
@@ -400,6 +664,10 @@ static void testset_to_array()
     test_to_array_signed();
     test_to_array_pointers();
     test_to_array_sized_pointers();
+    test_to_array_static_positions();
+    test_to_array_little_endian();
+    test_to_array_lsb_first();
+    test_to_array_bitmove();
     test_array_to_array();
     test_to_array_zero_bits();
 }
@@ -0,0 +1,318 @@
+// tests compiled_format, which requires configCPP_SERDES_ENABLE_FORMAT_RECORDING (so the rest of the serdes tests
+// run with the packet's recording hooks too), run using make
+#define DISBALE_TESTS_MAIN
+#define configCPP_SERDES_ENABLE_FORMAT_RECORDING
+#include "test_serdes.cpp"
+#include "../include/serdes_compiled_format.h"
+
+enum class compiled_color : uint8_t
+{
+    RED = 1,
+    GREEN = 5,
+    BLUE = 9
+};
+
+// every field kind a compiled_format replays: bitpacked unsigned and signed fields, bools (and a bool array right
+// after one), a float and a double, an enum, a bitpacked fixed size array, a nested format, pads, and aligns (one that
+// doesn't move the bit offset when recorded)
+struct compiled_record : serdes::packet_base
+{
+    static constexpr bool fixed_layout = true;
+
+    uint16_t id = 0;
+    int8_t delta = 0;
+    bool urgent = false;
+    bool flags[3] = {};
+    uint32_t timestamp = 0;
+    float gain = 0.0f;
+    compiled_color color = compiled_color::RED;
+    int32_t samples[5] = {};
+    mixed_inner inner{};
+    uint64_t tail = 0;
+    double scale = 0.0;
+    int64_t wide = 0;
+
+    void format(serdes::packet &p) override
+    {
+        p + serdes::bitpack<uint16_t, int>(id, 12) + serdes::bitpack<int8_t, int>(delta, 6) + urgent + flags;
+        p + serdes::pad<int>(3) + serdes::bitpack<uint32_t, int>(timestamp, 25) + gain;
+        p + serdes::bitpack<compiled_color, int>(color, 4);
+        p + serdes::bitpack<int32_t[5], int>(samples, 13);
+        p + inner + serdes::align<int>(8) + serdes::align<int>(8) + tail + scale;
+        p + serdes::bitpack<int64_t, int>(wide, 61) + serdes::align<int>(16) + serdes::pad<int>(3);
+    }
+};
+
+static compiled_record modified_compiled_record(const size_t seed)
+{
+    compiled_record record;
+    record.id = static_cast<uint16_t>(0xABC + seed * 37u);
+    record.delta = static_cast<int8_t>(static_cast<int>(seed % 64u) - 32);
+    record.urgent = (seed & 1u) != 0u;
+    record.flags[1] = true;
+    record.flags[2] = (seed & 2u) != 0u;
+    record.timestamp = static_cast<uint32_t>(0x1ABCDEF ^ (seed * 977u));
+    record.gain = -0.75f * static_cast<float>(seed);
+    record.color = (seed & 1u) != 0u ? compiled_color::BLUE : compiled_color::GREEN;
+    for (size_t i = 0; i < 5u; i++)
+        record.samples[i] = static_cast<int32_t>(i * 1000u + seed) - 4096;
+    record.inner.offset = static_cast<int16_t>(-2000 + static_cast<int>(seed));
+    record.inner.enabled = (seed & 4u) != 0u;
+    record.tail = 0xFEDCBA9876543210_u64 ^ seed;
+    record.scale = 1.0 / static_cast<double>(seed + 3u);
+    record.wide = -0x0123456789ABCDE_i64 * static_cast<int64_t>(seed + 1u);
+    return record;
+}
+
+// two records with a 3 bit field between them, so the second one starts at an unaligned bit offset too
+struct compiled_record_pair
+{
+    compiled_record first{}, second{};
+    uint8_t three = 3;
+
+    void format(serdes::packet &p)
+    {
+        p + first + serdes::bitpack<uint8_t, int>(three, 3) + second;
+    }
+};
+
+template <typename T_array>
+static void test_compiled_format_matches_packet()
+{
+    constexpr size_t buffer_size = 128u / sizeof(T_array);
+    compiled_record prototype;
+    const serdes::compiled_format<compiled_record> compiled(prototype);
+    ASSERT_EQUALS(compiled.replayable(), true);
+
+    for (size_t offset : {0u, 1u, 7u, 13u, 60u})
+    {
+        compiled_record_pair records;
+        records.first = modified_compiled_record(offset);
+        records.second = modified_compiled_record(offset + 11u);
+        T_array expected[buffer_size];
+        const packet_result stored = assert_stores_match(
+            expected, static_cast<T_array>(0xA5A5A5A5A5A5A5A5_u64),
+            [&](T_array(&serial_data)[buffer_size]) { return store_through(serdes::packet(serial_data, buffer_size, offset), records); },
+            [&](T_array(&serial_data)[buffer_size]) {
+                serdes::packet pkt(serial_data, buffer_size, offset);
+                pkt << compiled.bind(records.first) << serdes::bitpack<uint8_t, int>(records.three, 3) << compiled.bind(records.second);
+                return result_of(pkt);
+            });
+        ASSERT_EQUALS(static_cast<int>(stored.status), static_cast<int>(serdes::status_e::NO_ERROR));
+
+        compiled_record_pair expected_loaded, loaded;
+        expected_loaded.three = loaded.three = 0;
+        const packet_result load_result = assert_loads_match(
+            expected_loaded, loaded,
+            [&](compiled_record_pair &loaded_records) { return load_through(serdes::packet(expected, buffer_size, offset), loaded_records); },
+            [&](compiled_record_pair &loaded_records) {
+                serdes::packet pkt(expected, buffer_size, offset);
+                pkt >> compiled.bind(loaded_records.first) >> serdes::bitpack<uint8_t, int>(loaded_records.three, 3) >> compiled.bind(loaded_records.second);
+                return result_of(pkt);
+            });
+        ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(loaded.three, 3_u8);
+        ASSERT_EQUALS(loaded.second.samples, records.second.samples);
+        ASSERT_EQUALS(loaded.second.wide, records.second.wide);
+    }
+
+    // a buffer cut anywhere fails exactly like the format does (the replay only runs when the whole format fits)
+    compiled_record record = modified_compiled_record(5u);
+    for (size_t elements = 0; elements <= buffer_size; elements++)
+    {
+        T_array expected[buffer_size];
+        assert_stores_match(
+            expected, static_cast<T_array>(0x5A5A5A5A5A5A5A5A_u64),
+            [&](T_array(&serial_data)[buffer_size]) { return store_through(serdes::packet(serial_data, elements, 9u), record); },
+            [&](T_array(&serial_data)[buffer_size]) { return store_through(serdes::packet(serial_data, elements, 9u), compiled.bind(record)); });
+
+        compiled_record expected_loaded, loaded;
+        const serdes::sized_pointer<const T_array> cut(expected, elements);
+        assert_loads_match(
+            expected_loaded, loaded,
+            [&](compiled_record &loaded_record) { return load_through(serdes::packet(cut, 9u), loaded_record); },
+            [&](compiled_record &loaded_record) { return load_through(serdes::packet(cut, 9u), compiled.bind(loaded_record)); });
+    }
+}
+
+static uint16_t compiled_global_field = 0x1234;
+
+// a type that claims a fixed layout, for formats that don't have one
+template <typename T_object>
+struct fixed_layout_claim : T_object
+{
+    static constexpr bool fixed_layout = true;
+
+    fixed_layout_claim() = default;
+    explicit fixed_layout_claim(const T_object &object) : T_object(object) {}
+};
+
+// a format that isn't replayable is still compiled, and behaves exactly like the format (even though the type claims
+// a fixed layout)
+template <typename T_object>
+static void test_compiled_fallback_matches(const T_object &object, const T_object &prototype = T_object{})
+{
+    using claimed = fixed_layout_claim<T_object>;
+    const serdes::compiled_format<claimed> compiled{claimed(prototype)};
+    ASSERT_EQUALS(compiled.replayable(), false);
+    uint8_t expected[64];
+    assert_stores_match(
+        expected, uint8_t(0x96),
+        [&](uint8_t(&serial_data)[64]) {
+            T_object stored(object);
+            serdes::packet pkt(serial_data, 64u, 3u);
+            pkt << stored;
+            return result_of(pkt);
+        },
+        [&](uint8_t(&serial_data)[64]) {
+            const serdes::status_t status = compiled.store(claimed(object), serial_data, 3u);
+            return packet_result{status.status, status.bits};
+        });
+
+    claimed expected_loaded, loaded;
+    assert_loads_match(
+        expected_loaded, loaded,
+        [&](claimed &loaded_object) { return load_through(serdes::packet(expected, 64u, 3u), static_cast<T_object &>(loaded_object)); },
+        [&](claimed &loaded_object) {
+            const serdes::status_t status = compiled.load(loaded_object, expected, 3u);
+            return packet_result{status.status, status.bits};
+        });
+}
+
+struct validated_record : serdes::packet_base
+{
+    uint8_t version = 2;
+    void format(serdes::packet &p) override
+    {
+        p.add(version, [this]() { return version == 2; });
+    }
+};
+
+struct formatted_record : serdes::packet_base
+{
+    uint16_t value = 0xBEEF;
+    void format(serdes::packet &p) override
+    {
+        p + serdes::formatter{[this](serdes::packet &inner) { inner + value; }};
+    }
+};
+
+struct global_field_record : serdes::packet_base
+{
+    uint8_t value = 7;
+    void format(serdes::packet &p) override
+    {
+        p + value + compiled_global_field;
+    }
+};
+
+struct rewinding_record : serdes::packet_base
+{
+    uint8_t first = 0x12, second = 0x34;
+    void format(serdes::packet &p) override
+    {
+        p + first;
+        p.bit_offset -= 4u;
+        p + second;
+    }
+};
+
+// a format whose layout depends on a field, and one that takes a field's bits from one
+struct branching_record : serdes::packet_base
+{
+    uint8_t kind = 0;
+    uint16_t extra = 0xBEEF;
+    uint32_t value = 0x5A5;
+    void format(serdes::packet &p) override
+    {
+        p + kind;
+        if (kind != 0u)
+            p + extra;
+        p + value;
+    }
+};
+
+struct runtime_bits_record : serdes::packet_base
+{
+    uint8_t width = 11;
+    uint32_t value = 0x5A5;
+    void format(serdes::packet &p) override
+    {
+        p + serdes::bitpack<uint8_t, int>(width, 5);
+        p + serdes::bitpack<uint32_t, int>(value, width + 1);
+    }
+};
+
+static void test_compiled_formats()
+{
+    test_compiled_format_matches_packet<uint8_t>();
+    test_compiled_format_matches_packet<uint16_t>();
+    test_compiled_format_matches_packet<uint32_t>();
+    test_compiled_format_matches_packet<uint64_t>();
+
+    // data dependent formats (a referenced array size, a delimited array, containers, a validator, and a CRC) and
+    // little endian fields are detected, and fall back to the format
+    variable_count_message empty_count;
+    empty_count.size = 0;
+    test_compiled_fallback_matches(variable_count_message{});
+    test_compiled_fallback_matches(empty_count);
+    test_compiled_fallback_matches(sized_message{});
+    test_compiled_fallback_matches(modified_mixed_message());
+    validated_record invalid;
+    invalid.version = 3;
+    test_compiled_fallback_matches(validated_record{});
+    test_compiled_fallback_matches(invalid);
+
+    // formatters, fields outside of the object, and moving the bit offset back
+    test_compiled_fallback_matches(formatted_record{});
+    test_compiled_fallback_matches(global_field_record{});
+    test_compiled_fallback_matches(rewinding_record{});
+
+    // a branch on a field, or bits taken from one, records a different format when loading zeros and ones, so an
+    // object that takes the other branch (or has other bits) than the prototype isn't replayed wrong
+    branching_record other_kind;
+    other_kind.kind = 1;
+    test_compiled_fallback_matches(other_kind);
+    test_compiled_fallback_matches(branching_record{}, other_kind);
+    runtime_bits_record other_width;
+    other_width.width = 20;
+    other_width.value = 0xABCDE;
+    test_compiled_fallback_matches(other_width);
+
+    // a format with more operations than MaxOps isn't replayed
+    {
+        compiled_record prototype;
+        const serdes::compiled_format<compiled_record, 4> small(prototype);
+        ASSERT_EQUALS(small.replayable(), false);
+        const serdes::compiled_format<compiled_record> compiled(prototype);
+        ASSERT_EQUALS(compiled.size() > 4u, true);
+    }
+
+    // packet backends, other bit orders, and const bindings use the format (or its errors)
+    {
+        compiled_record prototype;
+        const serdes::compiled_format<compiled_record> compiled(prototype);
+        const compiled_record record = modified_compiled_record(3u);
+        ASSERT_EQUALS(serdes::serialized_bits(compiled.bind(record)).bits, serdes::serialized_bits(record).bits);
+        uint8_t expected[64] = {}, actual[64] = {};
+        serdes::packet expected_pkt(expected);
+        expected_pkt.bit_order = serdes::bit_order_e::LSB_FIRST;
+        expected_pkt << record;
+        serdes::packet pkt(actual);
+        pkt.bit_order = serdes::bit_order_e::LSB_FIRST;
+        pkt << compiled.bind(record);
+        ASSERT_EQUALS(pkt.bit_offset, expected_pkt.bit_offset);
+        ASSERT_EQUALS(actual, expected);
+        serdes::packet const_load_pkt(actual);
+        const_load_pkt >> compiled.bind(record);
+        ASSERT_EQUALS(static_cast<int>(const_load_pkt.status), static_cast<int>(serdes::status_e::NO_LOAD_TO_RVALUE));
+        ASSERT_EQUALS(const_load_pkt.bit_offset, 0_zu);
+    }
+}
+
+int main()
+{
+    test_compiled_formats();
+    testset_serdes();
+    PRINT_SUMMARY_AND_RETURN_EXIT_CODE();
+}
@@ -0,0 +1,154 @@
+// tests the runtime CPU dispatch with configCPP_SERDES_ENABLE_CPU_DISPATCH defined (so the bulk arrays, bool arrays,
+// and CRC-32C checks of serdes.h use the bound kernels), and every kernel set the CPU supports against the scalar kernels,
+// run using make
+#define DISBALE_TESTS_MAIN
+#define configCPP_SERDES_ENABLE_CPU_DISPATCH
+#include "test_serdes.cpp"
+
+static const serdes::isa_e dispatch_levels[] = {serdes::isa_e::SCALAR, serdes::isa_e::SSE4_2, serdes::isa_e::AVX2};
+
+static bool supported(const serdes::isa_e level)
+{
+    return static_cast<int>(level) <= static_cast<int>(serdes::cpu_dispatch::detected());
+}
+
+#if !defined(configCPP_SERDES_FIXED_ISA) && !defined(_WIN32)
+// must run before anything else uses a dispatched kernel, since the first use binds the default kernel set
+static void test_environment_caps_first_binding()
+{
+    setenv("CPP_SERDES_ISA", "sse4.2", 1);
+    const serdes::isa_e capped = supported(serdes::isa_e::SSE4_2) ? serdes::isa_e::SSE4_2 : serdes::isa_e::SCALAR;
+    ASSERT_EQUALS(static_cast<int>(serdes::cpu_dispatch::active()), static_cast<int>(capped));
+
+    // reset() reads the environment again, an unrecognized value (or none) doesn't cap the level
+    setenv("CPP_SERDES_ISA", "scalar", 1);
+    serdes::cpu_dispatch::reset();
+    ASSERT_EQUALS(static_cast<int>(serdes::cpu_dispatch::active()), static_cast<int>(serdes::isa_e::SCALAR));
+    setenv("CPP_SERDES_ISA", "avx512", 1);
+    serdes::cpu_dispatch::reset();
+    ASSERT_EQUALS(static_cast<int>(serdes::cpu_dispatch::active()), static_cast<int>(serdes::cpu_dispatch::detected()));
+    setenv("CPP_SERDES_ISA", "scalar", 1);
+    serdes::cpu_dispatch::reset();
+    unsetenv("CPP_SERDES_ISA");
+    serdes::cpu_dispatch::reset();
+    ASSERT_EQUALS(static_cast<int>(serdes::cpu_dispatch::active()), static_cast<int>(serdes::cpu_dispatch::detected()));
+}
+#endif
+
+static void test_force_and_reset()
+{
+    for (const serdes::isa_e level : dispatch_levels)
+    {
+        const serdes::isa_e before = serdes::cpu_dispatch::active();
+        ASSERT_EQUALS(serdes::cpu_dispatch::force(level), supported(level));
+        // a level the CPU doesn't support leaves the bound kernels alone
+        ASSERT_EQUALS(static_cast<int>(serdes::cpu_dispatch::active()), static_cast<int>(supported(level) ? level : before));
+    }
+    serdes::cpu_dispatch::reset();
+    ASSERT_EQUALS(static_cast<int>(serdes::cpu_dispatch::active()), static_cast<int>(serdes::cpu_dispatch::detected()));
+}
+
+// every kernel of every supported set matches the scalar kernel, for unaligned arrays of any length (so the vector
+// loops, and their remainders, are all used)
+static void test_kernel_sets_match_scalar()
+{
+    uint8_t source[260], expected[260], actual[260];
+    for (size_t i = 0; i < sizeof(source); i++)
+        source[i] = static_cast<uint8_t>(i * 73u + 5u);
+    const serdes::detail::cpu_kernels &scalar = serdes::detail::kernels_for(serdes::isa_e::SCALAR);
+
+    for (const serdes::isa_e level : dispatch_levels)
+    {
+        if (!supported(level))
+            continue;
+        const serdes::detail::cpu_kernels &kernels = serdes::detail::kernels_for(level);
+        ASSERT_EQUALS(static_cast<int>(kernels.isa), static_cast<int>(level));
+        for (const size_t offset : {0u, 1u, 3u})
+        {
+            for (size_t count = 0; count * 8u + offset <= 256u; count++)
+            {
+                std::fill(expected, expected + sizeof(expected), 0xA5u);
+                std::fill(actual, actual + sizeof(actual), 0xA5u);
+                scalar.byteswap_copy_16(&expected[offset], &source[3u - offset], count * 4u);
+                kernels.byteswap_copy_16(&actual[offset], &source[3u - offset], count * 4u);
+                ASSERT_EQUALS(actual, expected);
+                scalar.byteswap_copy_32(&expected[offset], &source[offset], count * 2u);
+                kernels.byteswap_copy_32(&actual[offset], &source[offset], count * 2u);
+                ASSERT_EQUALS(actual, expected);
+                scalar.byteswap_copy_64(&expected[offset], &source[1u], count);
+                kernels.byteswap_copy_64(&actual[offset], &source[1u], count);
+                ASSERT_EQUALS(actual, expected);
+            }
+        }
+        for (size_t offset = 0; offset < 8u; offset++)
+            for (size_t bytes = 0; offset + bytes <= sizeof(source); bytes += 7u)
+                ASSERT_EQUALS(kernels.crc32c(0x12345678u, &source[offset], bytes), serdes::detail::crc32c_scalar(0x12345678u, &source[offset], bytes));
+
+        bool flags[256];
+        for (size_t i = 0; i < 256u; i++)
+            flags[i] = ((i * 0x9E3779B9u) >> 7) & 1u;
+        for (size_t count = 0; count <= 4u; count++)
+        {
+            uint64_t expected_words[4] = {}, actual_words[4] = {};
+            scalar.pack_bools(expected_words, flags, count);
+            kernels.pack_bools(actual_words, flags, count);
+            ASSERT_EQUALS(actual_words, expected_words);
+        }
+    }
+}
+
+// the CRC-32C results of the bound kernels, against the iSCSI test vectors (RFC 3720, B.4), and through packets
+static void test_dispatched_crc32c()
+{
+    uint8_t zeros[32] = {}, ones[32], increasing[32], decreasing[32];
+    for (size_t i = 0; i < 32u; i++)
+    {
+        ones[i] = 0xFFu;
+        increasing[i] = static_cast<uint8_t>(i);
+        decreasing[i] = static_cast<uint8_t>(31u - i);
+    }
+    for (const serdes::isa_e level : dispatch_levels)
+    {
+        if (!serdes::cpu_dispatch::force(level))
+            continue;
+        ASSERT_EQUALS(serdes::cpu_dispatch::crc32c(zeros, 32u), 0x8A9136AA_u32);
+        ASSERT_EQUALS(serdes::cpu_dispatch::crc32c(ones, 32u), 0x62A8AB43_u32);
+        ASSERT_EQUALS(serdes::cpu_dispatch::crc32c(increasing, 32u), 0x46DD794E_u32);
+        ASSERT_EQUALS(serdes::cpu_dispatch::crc32c(decreasing, 32u), 0x113FDB5C_u32);
+        ASSERT_EQUALS(serdes::cpu_dispatch::crc32c(&increasing[13], 19u, serdes::cpu_dispatch::crc32c(increasing, 13u)), 0x46DD794E_u32);
+#if !defined(configCPP_SERDES_LIB_EXCLUDE_CPP_CRC) && BITCPY_CONSTEXPR_SUPPORTED
+        // packets calculate CRC-32C with the bound kernel
+        uint8_t serial_data[33] = {};
+        auto pkt = serdes::packet(serial_data) << increasing;
+        ASSERT_EQUALS(pkt.calculate_crc<CRC32::C>(), 0x46DD794E_u32);
+        ASSERT_EQUALS(pkt.calculate_crc<CRC32::C>(), CRC32::C::calc(increasing, 32u));
+#endif
+    }
+    serdes::cpu_dispatch::reset();
+}
+
+int main()
+{
+#if !defined(configCPP_SERDES_FIXED_ISA) && !defined(_WIN32)
+    test_environment_caps_first_binding();
+#endif
+    test_force_and_reset();
+    test_kernel_sets_match_scalar();
+    test_dispatched_crc32c();
+
+    // the byte swapped, bulk, and bool arrays, with each supported kernel set bound
+    for (const serdes::isa_e level : dispatch_levels)
+    {
+        if (!serdes::cpu_dispatch::force(level))
+            continue;
+        test_bulk_array_kernels();
+        test_byte_swapped_bulk_arrays();
+        test_bool_arrays_and_bitsets();
+        test_little_endian_fields();
+        test_word_sink_packets();
+    }
+    serdes::cpu_dispatch::reset();
+
+    testset_serdes();
+    PRINT_SUMMARY_AND_RETURN_EXIT_CODE();
+}
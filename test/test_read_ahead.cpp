@@ -0,0 +1,76 @@
+// tests the record_reader's read-ahead thread, which allocates (so it's built without the allocation check of
+// test_all.cpp, and linked with -pthread), run using make
+#define DISBALE_TESTS_MAIN
+#define configCPP_SERDES_ENABLE_READ_AHEAD_THREAD
+#include "test_serdes.cpp"
+
+static void test_read_ahead_record_readers()
+{
+    uint8_t capture[1024] = {};
+    const size_t capture_size = store_capture(capture, 40);
+    uint8_t window[64];
+
+    // blocks smaller than a record, blocks that hold a few records, and blocks larger than the window
+    for (const size_t read_ahead_size : {16u, 32u, 64u, 1024u})
+    {
+        array_streambuf buffer(capture, capture_size);
+        std::istream stream(&buffer);
+        uint8_t read_ahead[1024];
+        serdes::record_reader reader(serdes::stream_source(stream), window, sizeof(window), read_ahead, read_ahead_size);
+        ASSERT_EQUALS(read_capture(reader, 40), 40_zu);
+        ASSERT_EQUALS(reader.position(), capture_size);
+        capture_record record;
+        ASSERT_EQUALS(static_cast<int>(reader.next(record).status), static_cast<int>(serdes::status_e::END_OF_RECORDS));
+    }
+
+    // a read-ahead buffer too small for two blocks reads the source on the calling thread
+    {
+        array_streambuf buffer(capture, capture_size);
+        std::istream stream(&buffer);
+        uint8_t read_ahead[1];
+        serdes::record_reader reader(serdes::stream_source(stream), window, read_ahead);
+        ASSERT_EQUALS(read_capture(reader, 40), 40_zu);
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    // a file descriptor (a pipe, which has its serial data in pieces)
+    {
+        int descriptors[2];
+        ASSERT_EQUALS(pipe(descriptors), 0);
+        ASSERT_EQUALS(write(descriptors[1], capture, 100u), 100);
+        ASSERT_EQUALS(write(descriptors[1], &capture[100], capture_size - 100u), static_cast<ssize_t>(capture_size - 100u));
+        close(descriptors[1]);
+        uint8_t read_ahead[48];
+        serdes::record_reader reader(serdes::descriptor_source(descriptors[0]), window, read_ahead);
+        ASSERT_EQUALS(read_capture(reader, 40), 40_zu);
+        close(descriptors[0]);
+    }
+#endif
+
+    // a record cut short by the end of the source ran past the serial data
+    {
+        array_streambuf buffer(capture, capture_size - 1u);
+        std::istream stream(&buffer);
+        uint8_t read_ahead[32];
+        serdes::record_reader reader(serdes::stream_source(stream), window, read_ahead);
+        ASSERT_EQUALS(read_numbered_records(reader, 39), 39_zu);
+        capture_record record;
+        ASSERT_EQUALS(static_cast<int>(reader.next(record).status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+    }
+
+    // the destructor stops the thread, before anything was read, or while both blocks wait to be copied
+    for (size_t records = 0; records < 3; ++records)
+    {
+        array_streambuf buffer(capture, capture_size);
+        std::istream stream(&buffer);
+        uint8_t read_ahead[32];
+        serdes::record_reader reader(serdes::stream_source(stream), window, read_ahead);
+        ASSERT_EQUALS(read_numbered_records(reader, records), records);
+    }
+}
+
+int main()
+{
+    test_read_ahead_record_readers();
+    PRINT_SUMMARY_AND_RETURN_EXIT_CODE();
+}
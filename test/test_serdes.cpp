@@ -1,4 +1,10 @@
 #include "../test/test_utilities.h"
+#include <atomic>
+#include <array>
+#include "../include/serdes_bitset.h"
+#include "../include/bitcpy_cpu_dispatch.h"
+#include "../include/serdes_record_reader.h"
+#include "../include/serdes_bit_stream.h"
 
 static void test_variable_arrays()
 {
@@ -103,6 +109,61 @@ static void test_variable_packet_base_arrays()
         }
     }
 }
+struct static_coordinates : serdes::static_packet_base<static_coordinates>
+{
+    uint8_t x = 0xAB, y = 0xCD, z = 0xEF, q = 0x12;
+    void format(serdes::packet &p)
+    {
+        p + x + y + z + q;
+    }
+};
+
+struct static_coordinates_list : serdes::static_packet_base<static_coordinates_list>
+{
+    int16_t length = 3;
+    static_coordinates data[5] = {};
+
+    void format(serdes::packet &p)
+    {
+        p + length + serdes::array<static_coordinates, int16_t>(data, length);
+    }
+};
+
+static_assert(!std::is_polymorphic<static_coordinates>::value, "static_packet_base has no virtual table");
+static_assert(sizeof(static_coordinates) == 4u, "static_packet_base adds no storage");
+
+static void test_static_packet_base()
+{
+    // the same serial data and API as the packet_base version in test_variable_packet_base_arrays
+    static_coordinates_list m;
+    uint32_t serial_data[5] = {};
+    auto store_result = m.store(serial_data);
+    ASSERT_EQUALS(static_cast<int>(store_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(store_result.bits, 112_zu);
+    ASSERT_EQUALS(serial_data, {0x0003ABCD_u32, 0xEF12ABCD_u32, 0xEF12ABCD_u32, 0xEF120000_u32, 0x00000000_u32});
+    ASSERT_EQUALS(m.serialized_bits().bits, 112_zu);
+
+    static_coordinates_list loaded;
+    loaded.length = 0;
+    loaded.data[2].x = 0;
+    auto load_result = loaded << serial_data;
+    ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(loaded.length, 3);
+    ASSERT_EQUALS(loaded.data[2].x, 0xAB_u8);
+    ASSERT_EQUALS(loaded.data[3].x, 0xAB_u8); // untouched default
+
+    // const objects, nesting in a packet, and pointers/sized_pointers
+    const static_coordinates point;
+    uint8_t bytes[8] = {};
+    serdes::packet(bytes) << point << static_coordinates{};
+    ASSERT_EQUALS(bytes, {0xAB, 0xCD, 0xEF, 0x12, 0xAB, 0xCD, 0xEF, 0x12});
+    static_coordinates read_back;
+    read_back.q = 0;
+    ASSERT_EQUALS(read_back.load(serdes::sized_pointer<const uint8_t>(bytes, 4)).bits, 32_zu);
+    ASSERT_EQUALS(read_back.q, 0x12_u8);
+    ASSERT_EQUALS(static_cast<int>(read_back.store(&bytes[0], 3).status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+}
+
 static void test_fixed_sized_arrays()
 {
     {
@@ -519,6 +580,64 @@ static void test_formatter_lambdas()
     ASSERT_EQUALS(load_status.bit_offset, 16);
 }
 
+// counts live copies, so formatter copies/reassignments of non-trivial captures can be checked for leaks
+struct counted_capture
+{
+    static int live;
+    uint16_t value;
+    explicit counted_capture(uint16_t v) : value(v) { ++live; }
+    counted_capture(const counted_capture &other) : value(other.value) { ++live; }
+    counted_capture &operator=(const counted_capture &) = delete;
+    ~counted_capture() { --live; }
+};
+int counted_capture::live = 0;
+
+static void test_inline_formatter_storage()
+{
+    // captures larger than std::function's small buffer must still never allocate (test_all.cpp fails on new)
+    struct wide_capture
+    {
+        uint32_t a, b, c;
+    };
+    wide_capture wide = {0x01020304u, 0x05060708u, 0x090A0B0Cu};
+    uint8_t tail = 0xEE;
+    serdes::formatter wide_format{[wide, &tail](serdes::packet &p) mutable
+                                  { p + wide.a + wide.b + wide.c + tail; }};
+    uint8_t serial_data[16] = {};
+    auto result = (serdes::packet(serial_data) << wide_format);
+    ASSERT_EQUALS(serial_data, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0xEE, 0x00});
+    ASSERT_EQUALS(result.bit_offset, 104);
+
+    // copying and reassigning formatters within arrays
+    {
+        counted_capture first(0x1234);
+        serdes::formatter formats[3] = {
+            {[first](serdes::packet &p) mutable
+             { p.add(first.value); }},
+            {serdes::virtual_formatter},
+            {serdes::pure_virtual_formatter}};
+        ASSERT_EQUALS(counted_capture::live, 2);
+        ASSERT_EQUALS(formats[0].formatter_lambda != nullptr, true);
+        ASSERT_EQUALS(formats[2].formatter_lambda == nullptr, true);
+
+        serdes::formatter copies[3] = {formats[0], formats[1], formats[2]};
+        ASSERT_EQUALS(counted_capture::live, 3);
+        formats[2] = formats[0];
+        formats[0] = serdes::init_formatter(0xABCD_u16);
+        ASSERT_EQUALS(counted_capture::live, 3);
+        copies[1] = copies[1];
+
+        uint8_t array_data[8] = {};
+        auto array_result = (serdes::packet(array_data) << formats[0] << formats[1] << formats[2] << copies[0] << copies[1]);
+        ASSERT_EQUALS(array_data, {0xAB, 0xCD, 0x12, 0x34, 0x12, 0x34, 0x00});
+        ASSERT_EQUALS(static_cast<int>(array_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+
+        auto unset_result = (serdes::packet(array_data) << copies[2]);
+        ASSERT_EQUALS(static_cast<int>(unset_result.status), static_cast<int>(serdes::status_e::FORMATTER_NOT_SET));
+    }
+    ASSERT_EQUALS(counted_capture::live, 0);
+}
+
 static void test_delimited_arrays()
 {
     struct my_delimited_data : serdes::packet_base
@@ -698,6 +817,129 @@ static void test_bitpacked_delimited_arrays()
     ASSERT_EQUALS(static_cast<int>(store_result4.status), static_cast<int>(serdes::status_e::DELIMITER_NOT_FOUND));
 }
 
+template <typename B, typename E>
+static void test_bulk_array_kernel_matches_bitcpy()
+{
+    constexpr size_t count = 9;
+    constexpr size_t buffer_size = 96 / sizeof(B);
+    for (size_t bits = 1; bits <= sizeof(E) * 8u; bits++)
+    {
+        for (size_t offset : {0u, 1u, 5u, 8u, 13u, 31u})
+        {
+            E values[count] = {};
+            for (size_t i = 0; i < count; i++)
+            {
+                const uint64_t pattern = 0x9E3779B97F4A7C15_u64 * (i + 1u) ^ (0xC3A5C85C97CB3127_u64 >> ((i + bits) & 63u));
+                std::memcpy(&values[i], &pattern, sizeof(E));
+            }
+
+            // storing
+            B expected[buffer_size], actual[buffer_size];
+            std::fill(expected, expected + buffer_size, static_cast<B>(0xA5A5A5A5A5A5A5A5_u64));
+            std::fill(actual, actual + buffer_size, static_cast<B>(0xA5A5A5A5A5A5A5A5_u64));
+            for (size_t i = 0; i < count; i++)
+                serdes::bitcpy(expected, values[i], offset + i * bits, bits);
+            serdes::packet store_pkt(actual, buffer_size, offset);
+            store_pkt << serdes::bitpack<serdes::array<E, size_t>, size_t>(serdes::array<E, size_t>(values, count), bits);
+            ASSERT_EQUALS(store_pkt.bit_offset, offset + count * bits);
+            ASSERT_EQUALS(actual, expected);
+
+            // loading
+            E expected_values[count] = {}, actual_values[count] = {};
+            for (size_t i = 0; i < count; i++)
+                serdes::bitcpy(expected_values[i], actual, offset + i * bits, bits);
+            serdes::packet load_pkt(actual, buffer_size, offset);
+            load_pkt >> serdes::bitpack<serdes::array<E, size_t>, size_t>(serdes::array<E, size_t>(actual_values, count), bits);
+            ASSERT_EQUALS(load_pkt.bit_offset, offset + count * bits);
+            ASSERT_EQUALS(actual_values, expected_values);
+        }
+    }
+}
+
+static void test_bulk_array_kernels()
+{
+    test_bulk_array_kernel_matches_bitcpy<uint8_t, uint64_t>();
+    test_bulk_array_kernel_matches_bitcpy<uint16_t, int64_t>();
+    test_bulk_array_kernel_matches_bitcpy<uint32_t, uint16_t>();
+    test_bulk_array_kernel_matches_bitcpy<uint64_t, int16_t>();
+    test_bulk_array_kernel_matches_bitcpy<uint8_t, int8_t>();
+    test_bulk_array_kernel_matches_bitcpy<uint64_t, uint64_t>();
+
+    // 12 bit samples, which don't fit in the buffer, are still partially stored one element at a time
+    uint16_t samples[4] = {0xABC, 0x123, 0x456, 0x789};
+    uint8_t serial_data[5] = {};
+    auto pkt = serdes::packet(serial_data) << serdes::bitpack<uint16_t[4], int>(samples, 12);
+    ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+    ASSERT_EQUALS(pkt.bit_offset, 36_zu);
+    ASSERT_EQUALS(serial_data, {0xAB, 0xC1, 0x23, 0x45, 0x60});
+}
+
+static void test_byte_swapped_bulk_arrays()
+{
+    struct telemetry : serdes::packet_base
+    {
+        uint8_t id = 0x7E;
+        uint16_t counts[3] = {0x0102, 0x0304, 0x0506};
+        uint32_t words[2] = {0x0708090A, 0x0B0C0D0E};
+        float gains[2] = {1.0f, -2.5f};
+        double scale[1] = {0.5};
+
+        void format(serdes::packet &p) override
+        {
+            p + id + counts + words + gains + scale;
+        }
+    };
+    telemetry obj;
+    uint8_t serial_data[32] = {};
+    auto store_result = obj.store(serial_data);
+    ASSERT_EQUALS(static_cast<int>(store_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(store_result.bits, 248_zu);
+    ASSERT_EQUALS(serial_data, {0x7E, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+                                0x3F, 0x80, 0x00, 0x00, 0xC0, 0x20, 0x00, 0x00, 0x3F, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+
+    telemetry loaded;
+    std::fill(loaded.counts, loaded.counts + 3, 0);
+    std::fill(loaded.words, loaded.words + 2, 0);
+    loaded.gains[0] = loaded.gains[1] = 0.0f;
+    loaded.scale[0] = 0.0;
+    auto load_result = loaded.load(serial_data);
+    ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(loaded.counts, {0x0102, 0x0304, 0x0506});
+    ASSERT_EQUALS(loaded.words, {0x0708090A_u32, 0x0B0C0D0E_u32});
+    ASSERT_EQUALS(loaded.gains, {1.0f, -2.5f});
+    ASSERT_EQUALS(loaded.scale, {0.5});
+
+    // matching buffer and element widths are copied as is
+    uint16_t words16[4] = {};
+    int16_t values[3] = {-2, 0x1234, 3};
+    serdes::packet(words16) << 0xAB_u16 << values;
+    ASSERT_EQUALS(words16, {0x00AB, 0xFFFE, 0x1234, 0x0003});
+}
+
+static void test_atomics_in_byte_packets()
+{
+    // wrapped types with load()/store() methods (like std::atomic) go through the same byte buffer paths
+    std::atomic<uint8_t> flags{0xAB};
+    std::atomic<uint32_t> counter{0x12345678u};
+    uint8_t serial_data[6] = {};
+    serdes::packet store_pkt(serial_data);
+    store_pkt << flags << counter;
+    ASSERT_EQUALS(static_cast<int>(store_pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(serial_data, {0xAB, 0x12, 0x34, 0x56, 0x78, 0x00});
+
+    flags = 0u;
+    counter = 0u;
+    serdes::packet load_pkt(serial_data);
+    load_pkt >> flags >> counter;
+    ASSERT_EQUALS(static_cast<int>(load_pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(flags.load(), uint8_t(0xAB));
+    ASSERT_EQUALS(counter.load(), 0x12345678_u32);
+
+    std::atomic<uint16_t> unaligned{0};
+    ASSERT_EQUALS(serdes::bitcpy(unaligned, serdes::sized_pointer<void>(serial_data, sizeof(serial_data)), 4u, 12u), 12_zu);
+    ASSERT_EQUALS(unaligned.load(), uint16_t(0xB12));
+}
+
 static void test_virtual_formatters()
 {
     struct optional_and_mandatory_data_test : serdes::packet_base
@@ -786,10 +1028,2180 @@ static void test_object_oriented_virtual_formatters()
     ASSERT_EQUALS(obj2.checksum, 0xCDEF_u16);
 }
 
+// formats written as a template are handed the typed_packet itself, so nested fields skip the width switch
+struct typed_sensor_reading
+{
+    uint8_t channel = 0;
+    int16_t value = 0;
+    bool formatted_by_typed_packet = false;
+
+    template <typename T_packet>
+    void format(T_packet &p)
+    {
+        formatted_by_typed_packet = !std::is_same<T_packet, serdes::packet>::value;
+        p + serdes::bitpack<uint8_t, int>(channel, 3) + serdes::bitpack<int16_t, int>(value, 13);
+    }
+};
+
+struct typed_sensor_frame
+{
+    bool valid = false;
+    uint32_t timestamp = 0;
+    typed_sensor_reading readings[2] = {};
+    double scale = 0.0;
+    uint64_t tail = 0;
+
+    template <typename T_packet>
+    void format(T_packet &p)
+    {
+        p + valid + serdes::bitpack<uint32_t, int>(timestamp, 27) + readings[0] + readings[1] + scale + serdes::bitpack<uint64_t, int>(tail, 61);
+    }
+};
+
+template <typename T_array>
+static void test_typed_packet_matches_packet()
+{
+    constexpr size_t buffer_size = 32 / sizeof(T_array);
+    typed_sensor_frame obj;
+    obj.valid = true;
+    obj.timestamp = 0x5ABCDEF;
+    obj.readings[0].channel = 5;
+    obj.readings[0].value = -1234;
+    obj.readings[1].channel = 2;
+    obj.readings[1].value = 4095;
+    obj.scale = -0.125;
+    obj.tail = 0x1234567890ABCDE_u64;
+
+    for (size_t offset : {0u, 3u, 11u})
+    {
+        T_array expected[buffer_size];
+        const packet_result stored = assert_stores_match(
+            expected, T_array(0),
+            [&](T_array(&serial_data)[buffer_size]) { return store_through(serdes::packet(serial_data, buffer_size, offset), obj); },
+            [&](T_array(&serial_data)[buffer_size]) { return store_through(serdes::typed_packet<T_array>(serial_data, buffer_size, offset), obj); });
+        ASSERT_EQUALS(static_cast<int>(stored.status), static_cast<int>(serdes::status_e::NO_ERROR));
+
+        typed_sensor_frame expected_loaded, loaded;
+        bool formatted_by_typed_packet = false;
+        const serdes::sized_pointer<const T_array> serial_data(expected, buffer_size);
+        const packet_result load_result = assert_loads_match(
+            expected_loaded, loaded,
+            [&](typed_sensor_frame &frame) { return load_through(serdes::packet(serial_data, offset), frame); },
+            [&](typed_sensor_frame &frame) {
+                serdes::typed_packet<T_array> pkt(serial_data, offset);
+                pkt >> frame;
+                formatted_by_typed_packet = frame.readings[1].formatted_by_typed_packet;
+                return result_of(pkt);
+            });
+        ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        // the nested templated format is formatted with the typed_packet itself
+        ASSERT_EQUALS(formatted_by_typed_packet, true);
+        ASSERT_EQUALS(loaded.tail, 0x1234567890ABCDE_u64);
+    }
+}
+
+static void test_typed_packets()
+{
+    test_typed_packet_matches_packet<uint8_t>();
+    test_typed_packet_matches_packet<uint16_t>();
+    test_typed_packet_matches_packet<uint32_t>();
+    test_typed_packet_matches_packet<uint64_t>();
+
+    // existing "void format(serdes::packet&)" formats, arrays, and validators use the generic packet path
+    struct legacy_format : serdes::packet_base
+    {
+        uint8_t id = 0x7E;
+        uint16_t counts[2] = {0x0102, 0x0304};
+        uint8_t version = 2;
+
+        void format(serdes::packet &p) override
+        {
+            p + id + counts;
+            p.add(version, [this]() { return version == 2; });
+        }
+    };
+    legacy_format legacy;
+    uint32_t words[2] = {};
+    serdes::typed_packet<uint32_t> store_pkt(words);
+    store_pkt << legacy;
+    store_pkt.store(0x5_u8, 4);
+    ASSERT_EQUALS(static_cast<int>(store_pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(store_pkt.bit_offset, 52_zu);
+    ASSERT_EQUALS(words, {0x7E010203_u32, 0x04025000_u32});
+
+    legacy_format loaded;
+    loaded.id = 0;
+    loaded.counts[0] = loaded.counts[1] = 0;
+    uint8_t nibble = 0;
+    serdes::typed_packet<uint32_t> load_pkt(words);
+    load_pkt >> loaded >> serdes::bitpack<uint8_t, int>(nibble, 4);
+    ASSERT_EQUALS(static_cast<int>(load_pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(loaded.id, 0x7E_u8);
+    ASSERT_EQUALS(loaded.counts, {0x0102, 0x0304});
+    ASSERT_EQUALS(nibble, 0x5_u8);
+
+    // errors are reported the same way as with packet
+    words[1] = 0x04035000;
+    legacy_format invalid;
+    serdes::typed_packet<uint32_t> invalid_pkt(words);
+    invalid_pkt >> invalid;
+    ASSERT_EQUALS(static_cast<int>(invalid_pkt.status), static_cast<int>(serdes::status_e::INVALID_FIELD));
+
+    uint16_t too_small[1] = {};
+    serdes::typed_packet<uint16_t> small_pkt(too_small);
+    small_pkt << 0xAB_u8 << 0xCDEF_u16;
+    ASSERT_EQUALS(static_cast<int>(small_pkt.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+    ASSERT_EQUALS(small_pkt.bit_offset, 8_zu);
+    ASSERT_EQUALS(too_small, {0xAB00});
+}
+
+struct unchecked_variable_frame
+{
+    uint8_t count = 2;
+    uint16_t values[4] = {0x111, 0x222, 0x333, 0x444};
+    uint8_t version = 1;
+    typed_sensor_reading reading{};
+
+    template <typename T_packet>
+    void format(T_packet &p)
+    {
+        p + count + serdes::array<uint16_t, uint8_t>(values, count) + reading;
+        p.add(version, [this]() { return version == 1; });
+        p + reading;
+    }
+};
+
+template <typename T_array>
+static void test_unchecked_packet_matches_packet()
+{
+    constexpr size_t buffer_size = 32 / sizeof(T_array);
+    typed_sensor_frame obj;
+    obj.valid = true;
+    obj.timestamp = 0x1234567;
+    obj.readings[0].channel = 3;
+    obj.readings[0].value = -77;
+    obj.scale = 3.5;
+    obj.tail = 0xFEDCBA987654321_u64;
+
+    for (size_t offset : {0u, 5u, 16u})
+    {
+        T_array expected[buffer_size];
+        const packet_result stored = assert_stores_match(
+            expected, T_array(0),
+            [&](T_array(&serial_data)[buffer_size]) { return store_through(serdes::packet(serial_data, buffer_size, offset), obj); },
+            [&](T_array(&serial_data)[buffer_size]) { return store_through(serdes::unchecked_packet<T_array>(serial_data, buffer_size, offset), obj); });
+        ASSERT_EQUALS(static_cast<int>(stored.status), static_cast<int>(serdes::status_e::NO_ERROR));
+
+        typed_sensor_frame expected_loaded, loaded;
+        bool formatted_by_typed_packet = false;
+        const serdes::sized_pointer<const T_array> serial_data(expected, buffer_size);
+        const packet_result load_result = assert_loads_match(
+            expected_loaded, loaded,
+            [&](typed_sensor_frame &frame) { return load_through(serdes::packet(serial_data, offset), frame); },
+            [&](typed_sensor_frame &frame) {
+                serdes::unchecked_packet<T_array> pkt(serial_data, offset);
+                pkt >> frame;
+                formatted_by_typed_packet = frame.readings[0].formatted_by_typed_packet;
+                return result_of(pkt);
+            });
+        ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        // nested templated formats are formatted with the unchecked_packet itself
+        ASSERT_EQUALS(formatted_by_typed_packet, true);
+        ASSERT_EQUALS(loaded.tail, 0xFEDCBA987654321_u64);
+    }
+}
+
+static void test_unchecked_packets()
+{
+    test_unchecked_packet_matches_packet<uint8_t>();
+    test_unchecked_packet_matches_packet<uint16_t>();
+    test_unchecked_packet_matches_packet<uint32_t>();
+    test_unchecked_packet_matches_packet<uint64_t>();
+
+    // other bit and byte orders still work (through the ordered path)
+    {
+        uint8_t serial_data[4] = {};
+        serdes::unchecked_packet<uint8_t> pkt(serial_data);
+        pkt.endian = serdes::endian_e::LITTLE;
+        pkt << 0x1234_u16 << serdes::bitpack<uint16_t, int>(0x0ABC_u16, 12);
+        ASSERT_EQUALS(pkt.bit_offset, 28_zu);
+        ASSERT_EQUALS(serial_data, {0x34, 0x12, 0xBC, 0xA0});
+    }
+
+    // array size and validator errors are still reported, and the status keeps the first one, but the plain fields
+    // after an error are still stored (right after the last field that was stored)
+    {
+        unchecked_variable_frame frame;
+        frame.reading.channel = 5;
+        frame.reading.value = 0x123;
+        uint8_t serial_data[16] = {};
+        serdes::unchecked_packet<uint8_t> pkt(serial_data);
+        pkt << frame;
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(pkt.bit_offset, 8_zu + 2u * 16u + 16u + 8u + 16u);
+
+        frame.count = 5;
+        uint8_t oversized_data[16] = {};
+        serdes::unchecked_packet<uint8_t> oversized_pkt(oversized_data);
+        oversized_pkt << frame;
+        ASSERT_EQUALS(static_cast<int>(oversized_pkt.status), static_cast<int>(serdes::status_e::ARRAY_SIZE_OVER_MAX));
+
+        frame.count = 2;
+        frame.version = 2;
+        uint8_t invalid_data[16] = {};
+        serdes::unchecked_packet<uint8_t> invalid_pkt(invalid_data);
+        invalid_pkt << frame;
+        ASSERT_EQUALS(static_cast<int>(invalid_pkt.status), static_cast<int>(serdes::status_e::INVALID_FIELD));
+        ASSERT_EQUALS(invalid_data, {0x02, 0x01, 0x11, 0x02, 0x22, 0xA1, 0x23, 0xA1, 0x23, 0x00});
+
+        unchecked_variable_frame loaded;
+        serial_data[7] = 2; // the version
+        serdes::unchecked_packet<uint8_t> load_pkt(serdes::sized_pointer<const uint8_t>(serial_data, sizeof(serial_data)));
+        load_pkt >> loaded;
+        ASSERT_EQUALS(static_cast<int>(load_pkt.status), static_cast<int>(serdes::status_e::INVALID_FIELD));
+        ASSERT_EQUALS(loaded.values[1], 0x222_u16);
+        ASSERT_EQUALS(loaded.reading.value, static_cast<int16_t>(0x123));
+    }
+
+    // a value with a compile time size is stored and loaded with one capacity check
+    {
+        const uint16_t values[3] = {0x1234, 0x5678, 0x9ABC};
+        uint8_t expected[8] = {}, actual[8] = {};
+        serdes::packet(expected, 8u, 4u) << values;
+        const auto stored = serdes::unchecked_store(values, actual, 4u);
+        ASSERT_EQUALS(static_cast<int>(stored.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(stored.bits, 52_zu);
+        ASSERT_EQUALS(actual, expected);
+
+        uint16_t loaded[3] = {};
+        const auto load_result = serdes::unchecked_load(loaded, static_cast<const uint8_t(&)[8]>(actual), 4u);
+        ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(load_result.bits, 52_zu);
+        ASSERT_EQUALS(loaded, values);
+    }
+
+    // a value that doesn't fit at the bit offset uses the normal checked path, with the same partial store and error
+    {
+        const uint32_t values[3] = {0x11223344, 0x55667788, 0x99AABBCC};
+        uint8_t expected[16] = {}, actual[16] = {};
+        const auto checked = serdes::packet(expected, 16u, 40u) << values;
+        const auto unchecked = serdes::unchecked_store(values, actual, 40u);
+        ASSERT_EQUALS(static_cast<int>(unchecked.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+        ASSERT_EQUALS(unchecked.bits, checked.bit_offset);
+        ASSERT_EQUALS(actual, expected);
+    }
+}
+
+static void test_little_endian_fields()
+{
+    // a packet wide little endian default, with a big endian field
+    struct little_endian_frame : serdes::packet_base
+    {
+        uint16_t length = 0x0102;
+        uint32_t samples[3] = {0x03040506, 0x0708090A, 0x0B0C0D0E};
+        uint16_t id = 0xABC;
+        uint8_t flags = 0x5;
+        uint16_t crc = 0x1122;
+
+        void format(serdes::packet &p) override
+        {
+            p.endian = serdes::endian_e::LITTLE;
+            p + length + samples + serdes::bitpack<uint16_t, int>(id, 12) + serdes::bitpack<uint8_t, int>(flags, 4) + serdes::big_endian(crc);
+        }
+    };
+    little_endian_frame frame;
+    uint8_t serial_data[18] = {};
+    auto store_result = frame.store(serial_data);
+    ASSERT_EQUALS(static_cast<int>(store_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(store_result.bits, 144_zu);
+    ASSERT_EQUALS(serial_data, {0x02, 0x01, 0x06, 0x05, 0x04, 0x03, 0x0A, 0x09, 0x08, 0x07, 0x0E, 0x0D, 0x0C, 0x0B, 0xBC, 0xA5, 0x11, 0x22});
+
+    little_endian_frame loaded;
+    loaded.length = loaded.id = loaded.crc = 0;
+    loaded.flags = 0;
+    std::fill(loaded.samples, loaded.samples + 3, 0u);
+    auto load_result = loaded.load(serial_data);
+    ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(loaded.length, 0x0102_u16);
+    ASSERT_EQUALS(loaded.samples, {0x03040506_u32, 0x0708090A_u32, 0x0B0C0D0E_u32});
+    ASSERT_EQUALS(loaded.id, 0xABC_u16);
+    ASSERT_EQUALS(loaded.flags, 0x5_u8);
+    ASSERT_EQUALS(loaded.crc, 0x1122_u16);
+
+    // little endian fields in a big endian packet, including bitpacked array elements and nested formats
+    uint16_t counts[2] = {0xABC, 0x123};
+    uint8_t serial_data2[24] = {};
+    auto pkt = serdes::packet(serial_data2);
+    pkt << 0x0102_u16 << serdes::little_endian(0x0304_u16) << serdes::little_endian(serdes::bitpack<uint16_t[2], int>(counts, 12));
+    ASSERT_EQUALS(pkt.bit_offset, 56_zu);
+    ASSERT_EQUALS(static_cast<int>(pkt.endian), static_cast<int>(serdes::endian_e::BIG));
+    ASSERT_EQUALS(serial_data2, {0x01, 0x02, 0x04, 0x03, 0xBC, 0xA2, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00});
+
+    uint16_t x = 0, y = 0, loaded_counts[2] = {};
+    auto load_pkt = serdes::packet(serial_data2);
+    load_pkt >> x >> serdes::little_endian(y) >> serdes::little_endian(serdes::bitpack<uint16_t[2], int>(loaded_counts, 12));
+    ASSERT_EQUALS(x, 0x0102_u16);
+    ASSERT_EQUALS(y, 0x0304_u16);
+    ASSERT_EQUALS(loaded_counts, {0xABC, 0x123});
+    load_pkt >> serdes::little_endian(0x0304_u16);
+    ASSERT_EQUALS(static_cast<int>(load_pkt.status), static_cast<int>(serdes::status_e::NO_LOAD_TO_RVALUE));
+
+    // typed packets follow the packet's byte order too
+    uint32_t words[2] = {};
+    serdes::typed_packet<uint32_t> typed_pkt(words);
+    typed_pkt.endian = serdes::endian_e::LITTLE;
+    typed_pkt << 0x11223344_u32 << serdes::big_endian(0x5566_u16);
+    ASSERT_EQUALS(words, {0x44332211_u32, 0x55660000_u32});
+}
+
+static void test_lsb_first_packets()
+{
+    // a USB HID style report, with bits numbered from the least significant bit of each byte
+    struct mouse_report : serdes::packet_base
+    {
+        bool left = true, right = false, middle = true;
+        int8_t x = -3, y = 5;
+        int16_t wheel = -2;
+        uint16_t pan = 0x123;
+        uint16_t counts[2] = {0x0102, 0x0304};
+
+        void format(serdes::packet &p) override
+        {
+            p.bit_order = serdes::bit_order_e::LSB_FIRST;
+            p + left + right + middle + serdes::pad<int>(5) + x + y;
+            p + serdes::bitpack<int16_t, int>(wheel, 12) + serdes::bitpack<uint16_t, int>(pan, 12) + counts;
+        }
+    };
+    mouse_report report;
+    uint8_t serial_data[10] = {};
+    auto store_result = report.store(serial_data);
+    ASSERT_EQUALS(static_cast<int>(store_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(store_result.bits, 80_zu);
+    ASSERT_EQUALS(serial_data, {0x05, 0xFD, 0x05, 0xFE, 0x3F, 0x12, 0x02, 0x01, 0x04, 0x03});
+
+    mouse_report loaded;
+    loaded.left = loaded.middle = false;
+    loaded.x = loaded.y = 0;
+    loaded.wheel = 0;
+    loaded.pan = 0;
+    loaded.counts[0] = loaded.counts[1] = 0;
+    auto load_result = loaded.load(serial_data);
+    ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(loaded.left, true);
+    ASSERT_EQUALS(loaded.right, false);
+    ASSERT_EQUALS(loaded.middle, true);
+    ASSERT_EQUALS(loaded.x, static_cast<int8_t>(-3));
+    ASSERT_EQUALS(loaded.y, static_cast<int8_t>(5));
+    ASSERT_EQUALS(loaded.wheel, static_cast<int16_t>(-2));
+    ASSERT_EQUALS(loaded.pan, 0x123_u16);
+    ASSERT_EQUALS(loaded.counts, {0x0102, 0x0304});
+
+    // bitpacked arrays are packed element by element
+    uint8_t flags[4] = {1, 0, 3, 2};
+    uint8_t packed[1] = {};
+    auto pkt = serdes::packet(packed);
+    pkt.bit_order = serdes::bit_order_e::LSB_FIRST;
+    pkt << serdes::bitpack<uint8_t[4], int>(flags, 2);
+    ASSERT_EQUALS(packed, {0xB1});
+
+    // big endian fields are MSB first, like the Motorola signals of a CAN DBC frame of Intel signals (and a
+    // Motorola signal with its MSB at bit 3 of byte 4 starts at bit offset 8 * 4 + 7 - 3)
+    uint8_t frame[8] = {};
+    auto can_pkt = serdes::packet(frame);
+    can_pkt.bit_order = serdes::bit_order_e::LSB_FIRST;
+    can_pkt << 0xA5_u8 << serdes::big_endian(0x1234_u16) << serdes::bitpack<uint8_t, int>(5, 3);
+    can_pkt.bit_offset = 36u;
+    can_pkt << serdes::big_endian(serdes::bitpack<uint16_t, int>(0xABC, 12)) << serdes::little_endian(0x5678_u16);
+    ASSERT_EQUALS(static_cast<int>(can_pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(can_pkt.bit_offset, 64_zu);
+    ASSERT_EQUALS(static_cast<int>(can_pkt.bit_order), static_cast<int>(serdes::bit_order_e::LSB_FIRST));
+    ASSERT_EQUALS(frame, {0xA5, 0x12, 0x34, 0x05, 0x0A, 0xBC, 0x78, 0x56});
+
+    uint8_t intel = 0, small = 0;
+    uint16_t motorola = 0, wide_motorola = 0, little = 0;
+    auto can_load_pkt = serdes::packet(frame);
+    can_load_pkt.bit_order = serdes::bit_order_e::LSB_FIRST;
+    can_load_pkt >> intel >> serdes::big_endian(motorola) >> serdes::bitpack<uint8_t, int>(small, 3);
+    can_load_pkt.bit_offset = 36u;
+    can_load_pkt >> serdes::big_endian(serdes::bitpack<uint16_t, int>(wide_motorola, 12)) >> serdes::little_endian(little);
+    ASSERT_EQUALS(static_cast<int>(can_load_pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(intel, 0xA5_u8);
+    ASSERT_EQUALS(motorola, 0x1234_u16);
+    ASSERT_EQUALS(small, 0x05_u8);
+    ASSERT_EQUALS(wide_motorola, 0xABC_u16);
+    ASSERT_EQUALS(little, 0x5678_u16);
+}
+
+template <typename B, typename E>
+static void test_delimited_array_matches_elements(const serdes::endian_e endian, const serdes::bit_order_e bit_order)
+{
+    E values[4] = {static_cast<E>(0x1234), static_cast<E>(0xABCD), static_cast<E>(0x5678), 0};
+    const E delimiter = 0;
+    B expected[8];
+    assert_stores_match(
+        expected, B(0),
+        [&](B(&serial_data)[8]) {
+            serdes::packet pkt(serial_data);
+            pkt.endian = endian;
+            pkt.bit_order = bit_order;
+            for (const E value : values)
+                pkt << value;
+            return result_of(pkt);
+        },
+        [&](B(&serial_data)[8]) {
+            serdes::packet pkt(serial_data);
+            pkt.endian = endian;
+            pkt.bit_order = bit_order;
+            pkt << serdes::delimited_array<E>(values, delimiter);
+            return result_of(pkt);
+        });
+
+    E expected_loaded[4] = {}, loaded[4] = {};
+    const packet_result load_result = assert_loads_match(
+        expected_loaded, loaded,
+        [&](E(&elements)[4]) {
+            serdes::packet pkt(expected);
+            pkt.endian = endian;
+            pkt.bit_order = bit_order;
+            for (E &element : elements)
+                pkt >> element;
+            return result_of(pkt);
+        },
+        [&](E(&elements)[4]) {
+            serdes::delimited_array<E> loaded_array(elements, delimiter);
+            serdes::packet pkt(expected);
+            pkt.endian = endian;
+            pkt.bit_order = bit_order;
+            pkt >> loaded_array;
+            return result_of(pkt);
+        });
+    ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(loaded, values);
+}
+
+static void test_ordered_delimited_arrays()
+{
+    // delimited arrays in a buffer of their own width follow the packet's endian and bit order, like any field
+    uint16_t serial_data[4] = {};
+    uint16_t values[3] = {0x1234, 0xABCD, 0};
+    const uint16_t delimiter = 0;
+    auto pkt = serdes::packet(serial_data);
+    pkt.endian = serdes::endian_e::LITTLE;
+    pkt << serdes::delimited_array<uint16_t>(values, delimiter);
+    ASSERT_EQUALS(serial_data, {0x3412, 0xCDAB, 0x0000, 0x0000});
+
+    for (serdes::endian_e endian : {serdes::endian_e::BIG, serdes::endian_e::LITTLE})
+    {
+        for (serdes::bit_order_e bit_order : {serdes::bit_order_e::MSB_FIRST, serdes::bit_order_e::LSB_FIRST})
+        {
+            test_delimited_array_matches_elements<uint8_t, uint8_t>(endian, bit_order);
+            test_delimited_array_matches_elements<uint16_t, uint16_t>(endian, bit_order);
+            test_delimited_array_matches_elements<uint32_t, uint32_t>(endian, bit_order);
+            test_delimited_array_matches_elements<uint8_t, uint16_t>(endian, bit_order);
+        }
+    }
+}
+
+template <typename B>
+static void test_bool_array_matches_bitcpy(const size_t offset)
+{
+    constexpr size_t count = 150;
+    constexpr size_t buffer_size = 32 / sizeof(B);
+    bool flags[count];
+    for (size_t i = 0; i < count; i++)
+        flags[i] = ((i * 0x9E3779B9u) >> 7) & 1u;
+
+    B expected[buffer_size];
+    assert_stores_match(
+        expected, static_cast<B>(0xA5A5A5A5A5A5A5A5_u64),
+        [&](B(&serial_data)[buffer_size]) {
+            for (size_t i = 0; i < count; i++)
+                serdes::bitcpy(serial_data, flags[i], offset + i, 1u);
+            return packet_result{serdes::status_e::NO_ERROR, offset + count};
+        },
+        [&](B(&serial_data)[buffer_size]) { return store_through(serdes::packet(serial_data, buffer_size, offset), flags); });
+
+    // loaded like loading each bool on its own
+    bool expected_loaded[count] = {}, loaded[count] = {};
+    assert_loads_match(
+        expected_loaded, loaded,
+        [&](bool(&elements)[count]) {
+            serdes::packet pkt(expected, buffer_size, offset);
+            for (bool &element : elements)
+                pkt >> element;
+            return result_of(pkt);
+        },
+        [&](bool(&elements)[count]) { return load_through(serdes::packet(expected, buffer_size, offset), elements); });
+    ASSERT_EQUALS(loaded, flags);
+}
+
+static void test_bool_arrays_and_bitsets()
+{
+    // bool arrays are packed a bit per bool, like storing each bool on its own
+    for (size_t offset = 0; offset < 10u; offset++)
+    {
+        test_bool_array_matches_bitcpy<uint8_t>(offset);
+        test_bool_array_matches_bitcpy<uint16_t>(offset);
+        test_bool_array_matches_bitcpy<uint64_t>(offset);
+    }
+
+    std::array<bool, 10> status_bits = {{true, false, true, true, false, false, false, true, true, true}};
+    uint8_t serial_data[2] = {};
+    serdes::packet(serial_data) << status_bits;
+    ASSERT_EQUALS(serial_data, {0xB1, 0xC0});
+    std::array<bool, 10> loaded_bits = {};
+    serdes::packet(serial_data) >> loaded_bits;
+    for (size_t i = 0; i < status_bits.size(); i++)
+        ASSERT_EQUALS(loaded_bits[i], status_bits[i]);
+
+    // bitsets are stored as an unsigned value, most significant bit first
+    const std::bitset<12> small_set(0xABC);
+    uint8_t small_data[3] = {};
+    serdes::packet(small_data) << 0xF_u8 << small_set;
+    ASSERT_EQUALS(small_data, {0x0F, 0xAB, 0xC0});
+    std::bitset<12> loaded_small;
+    uint8_t leading_byte = 0;
+    serdes::packet(small_data) >> leading_byte >> loaded_small;
+    ASSERT_EQUALS(loaded_small.to_ulong(), 0xABCul);
+
+    std::bitset<100> wide_set;
+    for (size_t i = 0; i < wide_set.size(); i++)
+        wide_set[i] = ((i * 0x9E3779B9u) >> 9) & 1u;
+    uint16_t wide_data[7] = {};
+    auto wide_pkt = serdes::packet(wide_data, ~size_t(0), 3u);
+    wide_pkt << wide_set;
+    ASSERT_EQUALS(wide_pkt.bit_offset, 103_zu);
+    for (size_t i = 0; i < wide_set.size(); i++)
+    {
+        bool bit = false;
+        serdes::bitcpy(bit, wide_data, 3u + i, 1u);
+        ASSERT_EQUALS(bit, wide_set.test(wide_set.size() - 1u - i));
+    }
+    std::bitset<100> loaded_wide;
+    serdes::packet(wide_data, ~size_t(0), 3u) >> loaded_wide;
+    for (size_t i = 0; i < wide_set.size(); i++)
+        ASSERT_EQUALS(loaded_wide.test(i), wide_set.test(i));
+
+    // little endian bitsets match little endian integers of the same width
+    uint8_t little_data[2] = {};
+    serdes::packet(little_data) << serdes::little_endian(std::bitset<16>(0x1234));
+    ASSERT_EQUALS(little_data, {0x34, 0x12});
+    std::bitset<16> loaded_little;
+    serdes::packet(little_data) >> serdes::little_endian(loaded_little);
+    ASSERT_EQUALS(loaded_little.to_ulong(), 0x1234ul);
+
+    // bitsets that don't fit aren't stored at all
+    auto full_pkt = serdes::packet(small_data) << std::bitset<25>(0x1FFFFFF);
+    ASSERT_EQUALS(static_cast<int>(full_pkt.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+    ASSERT_EQUALS(small_data, {0x0F, 0xAB, 0xC0});
+}
+
+static void test_cpu_dispatched_kernels()
+{
+    const serdes::isa_e levels[] = {serdes::isa_e::SCALAR, serdes::isa_e::SSE4_2, serdes::isa_e::AVX2};
+    const uint8_t check_string[9] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    uint8_t source[120], expected[120], actual[120];
+    for (size_t i = 0; i < sizeof(source); i++)
+        source[i] = static_cast<uint8_t>(i * 37u + 11u);
+
+    // every level the CPU supports gives the same results
+    for (const serdes::isa_e level : levels)
+    {
+        if (!serdes::cpu_dispatch::force(level))
+        {
+            ASSERT_EQUALS(level != serdes::cpu_dispatch::detected(), true);
+            continue;
+        }
+        ASSERT_EQUALS(static_cast<int>(serdes::cpu_dispatch::active()), static_cast<int>(level));
+
+        for (size_t element_size : {2u, 4u, 8u})
+        {
+            for (size_t count = 0; count * element_size <= sizeof(source); count += 3u)
+            {
+                std::fill(expected, expected + sizeof(expected), 0xA5u);
+                std::fill(actual, actual + sizeof(actual), 0xA5u);
+                for (size_t i = 0; i < count * element_size; i++)
+                    expected[i] = source[(i / element_size) * element_size + element_size - 1u - i % element_size];
+                serdes::cpu_dispatch::byteswap_copy(actual, source, count, element_size);
+                ASSERT_EQUALS(actual, expected);
+            }
+        }
+
+        ASSERT_EQUALS(serdes::cpu_dispatch::crc32c(check_string, sizeof(check_string)), 0xE3069283_u32);
+        ASSERT_EQUALS(serdes::cpu_dispatch::crc32c(&check_string[5], 4, serdes::cpu_dispatch::crc32c(check_string, 5)), 0xE3069283_u32);
+#if !defined(configCPP_SERDES_LIB_EXCLUDE_CPP_CRC) && BITCPY_CONSTEXPR_SUPPORTED
+        ASSERT_EQUALS(serdes::cpu_dispatch::crc32c(source, sizeof(source)), CRC32::C::calc(source, sizeof(source)));
+        auto pkt = serdes::packet(actual) << check_string;
+        ASSERT_EQUALS(pkt.calculate_crc<CRC32::C>(), 0xE3069283_u32);
+#endif
+
+        // bulk byte swapped arrays (which only use the bound kernel with configCPP_SERDES_ENABLE_CPU_DISPATCH)
+        uint32_t words[5] = {0x01020304, 0x05060708, 0x090A0B0C, 0x0D0E0F10, 0x11121314};
+        uint8_t serial_data[20] = {};
+        serdes::packet(serial_data) << words;
+        ASSERT_EQUALS(serial_data, {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x10, 0x11, 0x12, 0x13, 0x14});
+    }
+
+#if !defined(configCPP_SERDES_FIXED_ISA) && !defined(_WIN32)
+    // the environment variable caps the level bound by reset()
+    setenv("CPP_SERDES_ISA", "scalar", 1);
+    serdes::cpu_dispatch::reset();
+    ASSERT_EQUALS(static_cast<int>(serdes::cpu_dispatch::active()), static_cast<int>(serdes::isa_e::SCALAR));
+    unsetenv("CPP_SERDES_ISA");
+#endif
+    serdes::cpu_dispatch::reset();
+    ASSERT_EQUALS(static_cast<int>(serdes::cpu_dispatch::active()), static_cast<int>(serdes::cpu_dispatch::detected()));
+    ASSERT_EQUALS(std::strcmp(serdes::cpu_dispatch::name(serdes::isa_e::SSE4_2), "sse4.2"), 0);
+}
+
+struct static_header
+{
+    uint16_t id;
+    uint8_t flags;
+    int8_t delta;
+    bool urgent;
+    float gain;
+};
+
+using static_header_format = serdes::static_format<
+    serdes::member_field<decltype(&static_header::id), &static_header::id, 12>,
+    serdes::member_field<decltype(&static_header::flags), &static_header::flags, 4>,
+    serdes::member_field<decltype(&static_header::delta), &static_header::delta, 6>,
+    serdes::member_field<decltype(&static_header::urgent), &static_header::urgent>,
+    serdes::member_field<decltype(&static_header::gain), &static_header::gain>>;
+
+static_assert(static_header_format::bits == 55u, "static_format size is known at compile time");
+static_assert(static_header_format::bytes == 7u, "static_format size is known at compile time");
+static_assert(static_header_format::field_count == 5u, "static_format field count is known at compile time");
+static_assert(static_header_format::offset<0>() == 0u && static_header_format::offset<1>() == 12u &&
+                  static_header_format::offset<2>() == 16u && static_header_format::offset<3>() == 22u &&
+                  static_header_format::offset<4>() == 23u,
+              "static_format offsets are known at compile time");
+static_assert(static_header_format::width<0>() == 12u && static_header_format::width<4>() == 32u,
+              "static_format field widths are known at compile time");
+
+// the static_header_format fields, one at a time
+static void add_static_header_fields(serdes::packet &p, static_header &h)
+{
+    p + serdes::bitpack<uint16_t, int>(h.id, 12) + serdes::bitpack<uint8_t, int>(h.flags, 4) + serdes::bitpack<int8_t, int>(h.delta, 6);
+    p + h.urgent + h.gain;
+}
+
+template <typename T_array, size_t N>
+static packet_result store_static_header_reference(const static_header &h, T_array (&serial)[N], size_t bit_offset, serdes::endian_e endian)
+{
+    static_header stored = h;
+    serdes::packet p(serial, N, bit_offset, serdes::mode_e::STORING);
+    p.endian = endian;
+    add_static_header_fields(p, stored);
+    return result_of(p);
+}
+
+template <typename T_array>
+static void test_static_format_matches_packet(size_t bit_offset, serdes::endian_e endian)
+{
+    constexpr size_t buffer_size = 16 / sizeof(T_array);
+    const static_header h = {0xABC, 0x5, -7, true, 1.5f};
+    T_array expected[buffer_size];
+    const packet_result stored = assert_stores_match(
+        expected, static_cast<T_array>(0x5A5A5A5A5A5A5A5Aull),
+        [&](T_array(&serial_data)[buffer_size]) {
+            return store_static_header_reference(h, serial_data, bit_offset, endian);
+        },
+        [&](T_array(&serial_data)[buffer_size]) {
+            serdes::packet pkt(serial_data, ~size_t(0), bit_offset);
+            pkt.endian = endian;
+            pkt << static_header_format::bind(h);
+            return result_of(pkt);
+        });
+    ASSERT_EQUALS(static_cast<int>(stored.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    ASSERT_EQUALS(stored.bit_offset, bit_offset + 55u);
+
+    static_header expected_loaded = {0, 0, 0, false, 0.0f}, loaded = expected_loaded;
+    assert_loads_match(
+        expected_loaded, loaded,
+        [&](static_header &header) {
+            serdes::packet pkt(expected, ~size_t(0), bit_offset, serdes::mode_e::LOADING);
+            pkt.endian = endian;
+            add_static_header_fields(pkt, header);
+            return result_of(pkt);
+        },
+        [&](static_header &header) {
+            serdes::packet pkt(expected, ~size_t(0), bit_offset);
+            pkt.endian = endian;
+            pkt >> static_header_format::bind(header);
+            return result_of(pkt);
+        },
+        add_static_header_fields);
+    ASSERT_EQUALS(loaded.delta, h.delta);
+    ASSERT_EQUALS(loaded.gain, h.gain);
+}
+
+static void test_static_formats()
+{
+    // element aligned starts use the compile time offsets, other starts the run time fallback
+    for (size_t bit_offset : {0u, 3u, 8u, 16u, 32u, 64u, 69u})
+    {
+        test_static_format_matches_packet<uint8_t>(bit_offset, serdes::endian_e::BIG);
+        test_static_format_matches_packet<uint16_t>(bit_offset, serdes::endian_e::BIG);
+        test_static_format_matches_packet<uint32_t>(bit_offset, serdes::endian_e::BIG);
+        test_static_format_matches_packet<uint64_t>(bit_offset, serdes::endian_e::BIG);
+        test_static_format_matches_packet<uint8_t>(bit_offset, serdes::endian_e::LITTLE);
+        test_static_format_matches_packet<uint32_t>(bit_offset, serdes::endian_e::LITTLE);
+    }
+
+    // direct array access, with the bounds checked at compile time
+    {
+        const static_header h = {0xABC, 0x5, -7, true, 1.5f};
+        uint8_t expected[8] = {};
+        store_static_header_reference(h, expected, 3, serdes::endian_e::BIG);
+        uint8_t actual[8] = {};
+        ASSERT_EQUALS(static_header_format::store<3>(h, actual), 55_zu);
+        ASSERT_EQUALS(actual, expected);
+        static_header loaded = {0, 0, 0, false, 0.0f};
+        ASSERT_EQUALS(static_header_format::load<3>(loaded, actual), 55_zu);
+        ASSERT_EQUALS(loaded.id, 0xABC_u16);
+        ASSERT_EQUALS(loaded.delta, static_cast<int8_t>(-7));
+        ASSERT_EQUALS(loaded.gain, 1.5f);
+    }
+
+    // unchecked stores and loads take the size of a binding from its format
+    {
+        const static_header h = {0xABC, 0x5, -7, true, 1.5f};
+        uint8_t expected[8] = {};
+        store_static_header_reference(h, expected, 5, serdes::endian_e::BIG);
+        uint8_t actual[8] = {};
+        const auto stored = serdes::unchecked_store(static_header_format::bind(h), actual, 5u);
+        ASSERT_EQUALS(static_cast<int>(stored.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(stored.bits, 60_zu);
+        ASSERT_EQUALS(actual, expected);
+        static_header loaded = {0, 0, 0, false, 0.0f};
+        const auto load_result = serdes::unchecked_load(static_header_format::bind(loaded), static_cast<const uint8_t(&)[8]>(actual), 5u);
+        ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(loaded.id, 0xABC_u16);
+        ASSERT_EQUALS(loaded.delta, static_cast<int8_t>(-7));
+        ASSERT_EQUALS(loaded.gain, 1.5f);
+        ASSERT_EQUALS(static_cast<int>(serdes::unchecked_store(static_header_format::bind(h), actual, 10u).status),
+                      static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+    }
+
+    // nesting inside a dynamic format
+    struct tagged_header : serdes::packet_base
+    {
+        uint8_t tag = 0;
+        static_header header = {0, 0, 0, false, 0.0f};
+        uint8_t trailer = 0;
+
+        void format(serdes::packet &p) override
+        {
+            p + tag + static_header_format::bind(header) + trailer;
+        }
+    };
+    {
+        tagged_header original;
+        original.tag = 0x42;
+        original.header = {0x123, 0xA, 31, false, -2.25f};
+        original.trailer = 0xEE;
+        uint8_t serial[10] = {};
+        auto store_result = original.store(serial);
+        ASSERT_EQUALS(static_cast<int>(store_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(store_result.bits, 71_zu);
+
+        tagged_header loaded;
+        auto load_result = loaded.load(serial);
+        ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(loaded.tag, 0x42_u8);
+        ASSERT_EQUALS(loaded.header.id, 0x123_u16);
+        ASSERT_EQUALS(loaded.header.flags, 0xA_u8);
+        ASSERT_EQUALS(loaded.header.delta, static_cast<int8_t>(31));
+        ASSERT_EQUALS(loaded.header.urgent, false);
+        ASSERT_EQUALS(loaded.header.gain, -2.25f);
+        ASSERT_EQUALS(loaded.trailer, 0xEE_u8);
+    }
+
+    // the capacity is checked once up front, nothing is written when the format does not fit
+    {
+        const static_header h = {0xABC, 0x5, -7, true, 1.5f};
+        uint8_t serial[7] = {};
+        serdes::packet p(serial, 7, 2);
+        p << static_header_format::bind(h);
+        ASSERT_EQUALS(static_cast<int>(p.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+        ASSERT_EQUALS(p.bit_offset, 2_zu);
+        ASSERT_EQUALS(serial, {0, 0, 0, 0, 0, 0, 0});
+
+        serdes::packet const_load(serial);
+        const_load >> static_header_format::bind(h);
+        ASSERT_EQUALS(static_cast<int>(const_load.status), static_cast<int>(serdes::status_e::NO_LOAD_TO_RVALUE));
+    }
+
+#if defined(__cpp_nontype_template_parameter_auto) && __cpp_nontype_template_parameter_auto >= 201606L
+    using short_header_format = serdes::static_format<serdes::field<&static_header::id, 12>, serdes::field<&static_header::flags, 4>>;
+    static_assert(short_header_format::bits == 16u && short_header_format::offset<1>() == 12u, "C++17 field shorthand");
+    {
+        static_header h = {0xABC, 0xD, 0, false, 0.0f};
+        uint8_t serial[2] = {};
+        short_header_format::store(h, serial);
+        ASSERT_EQUALS(serial, {0xAB, 0xCD});
+    }
+#endif
+}
+
+// full width fields declared back to back, so the host layout is the serial layout (apart from byte order)
+struct wire_sample
+{
+    uint32_t timestamp;
+    int16_t x, y;
+    uint16_t z;
+    uint8_t status;
+    int8_t trim;
+    float temperature;
+    uint64_t counter;
+};
+
+using wire_sample_format = serdes::static_format<
+    serdes::member_field<decltype(&wire_sample::timestamp), &wire_sample::timestamp>,
+    serdes::member_field<decltype(&wire_sample::x), &wire_sample::x>,
+    serdes::member_field<decltype(&wire_sample::y), &wire_sample::y>,
+    serdes::member_field<decltype(&wire_sample::z), &wire_sample::z>,
+    serdes::member_field<decltype(&wire_sample::status), &wire_sample::status>,
+    serdes::member_field<decltype(&wire_sample::trim), &wire_sample::trim>,
+    serdes::member_field<decltype(&wire_sample::temperature), &wire_sample::temperature>,
+    serdes::member_field<decltype(&wire_sample::counter), &wire_sample::counter>>;
+
+// the same members, with the serial order not matching the declaration order
+using reordered_sample_format = serdes::static_format<
+    serdes::member_field<decltype(&wire_sample::x), &wire_sample::x>,
+    serdes::member_field<decltype(&wire_sample::timestamp), &wire_sample::timestamp>>;
+
+// a skipped member, and a padded member
+using sparse_sample_format = serdes::static_format<
+    serdes::member_field<decltype(&wire_sample::timestamp), &wire_sample::timestamp>,
+    serdes::member_field<decltype(&wire_sample::y), &wire_sample::y>>;
+using padded_sample_format = serdes::static_format<
+    serdes::member_field<decltype(&wire_sample::trim), &wire_sample::trim>,
+    serdes::member_field<decltype(&wire_sample::temperature), &wire_sample::temperature>,
+    serdes::member_field<decltype(&wire_sample::timestamp), &wire_sample::timestamp>>;
+
+static_assert(wire_sample_format::byte_copyable && wire_sample_format::bytes == sizeof(wire_sample),
+              "full width fields are byte copyable");
+static_assert(!static_header_format::byte_copyable, "bitpacked fields are not byte copyable");
+
+// every wire_sample member, one at a time
+static void add_wire_sample_fields(serdes::packet &p, wire_sample &sample)
+{
+    p + sample.timestamp + sample.x + sample.y + sample.z + sample.status + sample.trim + sample.temperature + sample.counter;
+}
+
+template <typename T_format, typename T_array>
+static void test_host_layout_matches_packet(const wire_sample &sample, size_t bit_offset)
+{
+    constexpr size_t buffer_size = 48 / sizeof(T_array);
+    T_array expected[buffer_size];
+    // the reference is the format's unrolled field by field copy
+    const packet_result stored = assert_stores_match(
+        expected, static_cast<T_array>(0x5A5A5A5A5A5A5A5Aull),
+        [&](T_array(&serial_data)[buffer_size]) {
+            T_format::layout::store_at(serial_data, sample, bit_offset);
+            return packet_result{serdes::status_e::NO_ERROR, bit_offset + T_format::bits};
+        },
+        [&](T_array(&serial_data)[buffer_size]) { return store_through(serdes::packet(serial_data, ~size_t(0), bit_offset), T_format::bind(sample)); });
+    ASSERT_EQUALS(static_cast<int>(stored.status), static_cast<int>(serdes::status_e::NO_ERROR));
+
+    wire_sample expected_loaded = {0, 0, 0, 0, 0, 0, 0.0f, 0}, loaded = expected_loaded;
+    assert_loads_match(
+        expected_loaded, loaded,
+        [&](wire_sample &loaded_sample) {
+            T_format::layout::load_at(loaded_sample, expected, bit_offset);
+            return packet_result{serdes::status_e::NO_ERROR, bit_offset + T_format::bits};
+        },
+        [&](wire_sample &loaded_sample) { return load_through(serdes::packet(expected, ~size_t(0), bit_offset), T_format::bind(loaded_sample)); },
+        add_wire_sample_fields);
+}
+
+static void test_host_layout_passthrough()
+{
+    const wire_sample sample = {0x01020304u, -2, 0x1234, 0xFEDC, 0xA5, -100, -2.25f, 0x0102030405060708ull};
+    ASSERT_EQUALS(wire_sample_format::matches_host_layout(sample), true);
+    ASSERT_EQUALS(reordered_sample_format::matches_host_layout(sample), false);
+    ASSERT_EQUALS(sparse_sample_format::matches_host_layout(sample), false);
+    ASSERT_EQUALS(padded_sample_format::matches_host_layout(sample), false);
+    ASSERT_EQUALS(static_header_format::matches_host_layout(static_header{0, 0, 0, false, 0.0f}), false);
+
+    // byte aligned starts in byte arrays are a bulk copy, every other case falls back to the field by field code
+    for (size_t bit_offset : {0u, 3u, 8u, 24u, 64u, 69u})
+    {
+        test_host_layout_matches_packet<wire_sample_format, uint8_t>(sample, bit_offset);
+        test_host_layout_matches_packet<wire_sample_format, uint16_t>(sample, bit_offset);
+        test_host_layout_matches_packet<wire_sample_format, uint32_t>(sample, bit_offset);
+        test_host_layout_matches_packet<reordered_sample_format, uint8_t>(sample, bit_offset);
+        test_host_layout_matches_packet<sparse_sample_format, uint8_t>(sample, bit_offset);
+        test_host_layout_matches_packet<padded_sample_format, uint8_t>(sample, bit_offset);
+    }
+
+    // the serial data is big endian, regardless of the host byte order
+    {
+        uint8_t serial_data[32] = {};
+        serdes::packet(serial_data) << wire_sample_format::bind(sample);
+        ASSERT_EQUALS(serial_data, {0x01, 0x02, 0x03, 0x04, 0xFF, 0xFE, 0x12, 0x34, 0xFE, 0xDC, 0xA5, 0x9C,
+                                    0xC0, 0x10, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x00});
+    }
+}
+
+struct mixed_inner : serdes::packet_base
+{
+    int16_t offset = -300;
+    bool enabled = true;
+
+    void format(serdes::packet &p) override
+    {
+        p + serdes::bitpack<int16_t, int>(offset, 12);
+        p + enabled;
+    }
+};
+
+struct mixed_message : serdes::packet_base
+{
+    uint8_t id = 0x42;
+    uint16_t words[3] = {0x1234, 0xABCD, 0x0F0F};
+    mixed_inner inner{};
+    float gain = 2.5f;
+    uint32_t little = 0x11223344;
+    uint16_t packed[2] = {0x0ABC, 0x0DEF};
+    uint8_t flags = 0x5;
+
+    void format(serdes::packet &p) override
+    {
+        p + id + serdes::pad<int>(3) + words + inner;
+        p.align(8);
+        p + gain + serdes::little_endian(little) + serdes::bitpack<uint16_t[2], int>(packed, 12);
+        p + serdes::bitpack<uint8_t, int>(flags, 4);
+    }
+};
+
+struct variable_count_message : serdes::packet_base
+{
+    uint8_t size = 2;
+    uint8_t values[4] = {1, 2, 3, 4};
+
+    void format(serdes::packet &p) override
+    {
+        p + size + serdes::array<uint8_t, uint8_t>(values, size);
+    }
+};
+
+static mixed_message modified_mixed_message()
+{
+    mixed_message message;
+    message.id = 0xA5;
+    message.words[1] = 0x5555;
+    message.inner.offset = 1000;
+    message.inner.enabled = false;
+    message.gain = -0.75f;
+    message.little = 0xCAFEF00D;
+    message.packed[0] = 0x0123;
+    message.flags = 0xE;
+    return message;
+}
+
+static_assert(serdes::static_packet<uint16_t, 4>::capacity_bits == 64u, "static_packet capacity is known at compile time");
+static_assert(serdes::detail::static_serialized_bits<uint16_t[3]>::value == 48u, "fixed arrays have a compile time size");
+static_assert(serdes::detail::static_serialized_bits<serdes::static_format_binding<static_header_format, static_header>>::value == 55u,
+              "static_format bindings have a compile time size");
+static_assert(serdes::detail::static_serialized_bits<typed_sensor_frame>::value == 0u, "format methods are only sized at runtime");
+
+static void test_static_packets()
+{
+    typed_sensor_frame obj;
+    obj.valid = true;
+    obj.timestamp = 0x7654321;
+    obj.readings[1].channel = 6;
+    obj.readings[1].value = -4000;
+    obj.scale = 0.5;
+    obj.tail = 0x1F2E3D4C5B6A798_u64;
+
+    // same serial data as a packet, over c style arrays and std::arrays
+    for (size_t offset : {0u, 7u})
+    {
+        uint8_t expected[32] = {}, actual[32] = {};
+        serdes::packet pkt(expected, 32, offset);
+        pkt << obj;
+        serdes::static_packet<uint8_t, 32> static_pkt(actual, offset);
+        static_pkt << obj;
+        ASSERT_EQUALS(static_cast<int>(static_pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(static_pkt.bit_offset, pkt.bit_offset);
+        ASSERT_EQUALS(actual, expected);
+
+        std::array<uint8_t, 32> std_array{};
+        std::copy(actual, actual + 32, std_array.begin());
+        typed_sensor_frame loaded;
+        serdes::static_packet<uint8_t, 32> load_pkt(static_cast<const std::array<uint8_t, 32> &>(std_array), offset);
+        load_pkt >> loaded;
+        ASSERT_EQUALS(static_cast<int>(load_pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(loaded.readings[1].value, static_cast<int16_t>(-4000));
+        ASSERT_EQUALS(loaded.readings[1].formatted_by_typed_packet, true);
+        ASSERT_EQUALS(loaded.tail, obj.tail);
+    }
+
+    // static formats, and existing "format(serdes::packet&)" methods
+    {
+        static_header header{0xABC, 0x5, -9, true, 1.5f};
+        uint8_t expected[static_header_format::bytes] = {};
+        store_static_header_reference(header, expected, 0u, serdes::endian_e::BIG);
+        uint8_t actual[static_header_format::bytes] = {};
+        serdes::static_packet<uint8_t, static_header_format::bytes> static_pkt(actual);
+        static_pkt << static_header_format::bind(header);
+        ASSERT_EQUALS(static_pkt.bit_offset, static_header_format::bits);
+        ASSERT_EQUALS(actual, expected);
+
+        mixed_message message;
+        uint16_t packet_data[12] = {}, static_data[12] = {};
+        serdes::packet(packet_data) << message;
+        serdes::static_packet<uint16_t, 12>(static_data) << message;
+        ASSERT_EQUALS(static_data, packet_data);
+    }
+
+    // runtime overflows are still reported
+    {
+        uint16_t too_small[1] = {};
+        serdes::static_packet<uint16_t, 1> small_pkt(too_small);
+        small_pkt << 0xAB_u8 << 0xCDEF_u16;
+        ASSERT_EQUALS(static_cast<int>(small_pkt.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+        ASSERT_EQUALS(small_pkt.bit_offset, 8_zu);
+        ASSERT_EQUALS(too_small, {0xAB00});
+    }
+}
+
+struct sized_message : serdes::packet_base
+{
+    uint8_t count = 3;
+    uint16_t samples[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+    char name[16] = "sensor";
+    std::bitset<20> flags{0xABCDE};
+    std::array<uint8_t, 3> extra{{9, 8, 7}};
+    mixed_inner inner{};
+    uint32_t crc = 0;
+    bool valid = true;
+
+    void format(serdes::packet &p) override
+    {
+        p + count + serdes::array<uint16_t, uint8_t>(samples, count);
+        p + serdes::delimited_array<char>(name, '\0') + flags + extra + inner;
+        p.align(8);
+        p.add(valid, [this]() { return valid; });
+#if !defined(configCPP_SERDES_LIB_EXCLUDE_CPP_CRC) && BITCPY_CONSTEXPR_SUPPORTED
+        p.calculate_crc<CRC32::C>(&crc);
+#endif
+        p + crc;
+    }
+};
+
+static void test_serialized_bits()
+{
+    // the sizing walk matches what a store produces, for variable and fixed parts alike
+    {
+        sized_message message;
+        uint8_t serial_data[64] = {};
+        for (uint8_t count : {0u, 3u, 8u})
+        {
+            message.count = count;
+            const auto stored = message.store(serial_data);
+            const auto sized = message.serialized_bits();
+            ASSERT_EQUALS(static_cast<int>(sized.status), static_cast<int>(serdes::status_e::NO_ERROR));
+            ASSERT_EQUALS(sized.bits, stored.bits);
+        }
+        ASSERT_EQUALS(message.serialized_bits().bits, 8u + 8u * 16u + 56u + 20u + 24u + 13u + 7u + 1u + 32u);
+
+        // the object isn't modified, the crc field is only written by a real store
+        message.crc = 0u;
+        message.serialized_bits();
+        ASSERT_EQUALS(message.crc, 0u);
+
+        // aligns depend on the starting offset
+        const auto stored = message.store(serial_data, sizeof(serial_data), 3u);
+        ASSERT_EQUALS(message.serialized_bits(3u).bits, stored.bits - 3u);
+    }
+
+    // errors are reported with the bits a store would have reached
+    {
+        sized_message message;
+        uint8_t serial_data[64] = {};
+        message.count = 9;
+        const auto over_max = message.store(serial_data);
+        const auto over_max_sized = message.serialized_bits();
+        ASSERT_EQUALS(static_cast<int>(over_max_sized.status), static_cast<int>(serdes::status_e::ARRAY_SIZE_OVER_MAX));
+        ASSERT_EQUALS(over_max_sized.bits, over_max.bits);
+
+        message.count = 3;
+        message.valid = false;
+        ASSERT_EQUALS(static_cast<int>(message.serialized_bits().status), static_cast<int>(serdes::status_e::INVALID_FIELD));
+
+        message.valid = true;
+        std::fill(message.name, message.name + sizeof(message.name), 'x');
+        const auto no_delimiter = message.serialized_bits();
+        ASSERT_EQUALS(static_cast<int>(no_delimiter.status), static_cast<int>(serdes::status_e::DELIMITER_NOT_FOUND));
+        ASSERT_EQUALS(no_delimiter.bits, 8u + 3u * 16u + 16u * 8u);
+    }
+
+    // any storable value can be measured, and fixed layouts answer without walking the format
+    {
+        uint16_t words[3] = {};
+        ASSERT_EQUALS(serdes::serialized_bits(words).bits, 48_zu);
+        ASSERT_EQUALS(serdes::serialized_bits(serdes::bitpack<uint16_t[3], int>(words, 5)).bits, 15_zu);
+
+        static_header header;
+        ASSERT_EQUALS(serdes::serialized_bits(static_header_format::bind(header)).bits, static_header_format::bits);
+    }
+
+    // a fixed size format is measured once per type, later objects (and calls) get the cached size
+    {
+        mixed_inner inner;
+        const auto first = serdes::fixed_serialized_bits(inner);
+        ASSERT_EQUALS(static_cast<int>(first.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(first.bits, 13_zu);
+        inner.offset = 100;
+        ASSERT_EQUALS(serdes::fixed_serialized_bits(inner).bits, 13_zu);
+        ASSERT_EQUALS(serdes::fixed_serialized_bits(mixed_inner{}).bits, 13_zu);
+    }
+
+    // a sizing_packet can be passed to any format, pads and aligns only move its bit offset
+    {
+        sized_message message;
+        serdes::sizing_packet pkt(5u);
+        pkt.pad(100000u);
+        message.format(pkt);
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(pkt.bit_offset, 5u + 100000u + message.serialized_bits(5u).bits);
+        size_t iterated_bytes = 0;
+        for (auto &segment : pkt.previous_bytes())
+            iterated_bytes += segment.num_bytes;
+        ASSERT_EQUALS(iterated_bytes, 0_zu);
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+    }
+}
+
+enum class group_flags : uint8_t
+{
+    NONE = 0x00,
+    URGENT = 0x81,
+};
+
+// the same header, formatted either as grouped fields, or one field at a time
+struct grouped_header : serdes::packet_base
+{
+    bool grouped = true;
+    size_t leading_bits = 0;
+    serdes::bit_order_e bit_order = serdes::bit_order_e::MSB_FIRST;
+    uint8_t id = 0xA5;
+    group_flags flags = group_flags::URGENT;
+    uint16_t seq = 0x1234;
+    uint16_t len = 0xBEEF;
+    bool ack = true;
+    int8_t delta = -2;
+
+    void format(serdes::packet &p) override
+    {
+        p.bit_order = bit_order;
+        p + serdes::pad<size_t>(leading_bits);
+        if (grouped)
+            p + serdes::group(id, flags, seq, len, ack, delta);
+        else
+            p + id + flags + seq + len + ack + delta;
+    }
+};
+
+static void test_field_groups()
+{
+    // fused groups produce the same serial data and loaded values as the equivalent field chain
+    for (size_t leading_bits : {0u, 3u, 8u, 13u})
+    {
+        for (serdes::bit_order_e bit_order : {serdes::bit_order_e::MSB_FIRST, serdes::bit_order_e::LSB_FIRST})
+        {
+            grouped_header grouped, chained;
+            grouped.leading_bits = chained.leading_bits = leading_bits;
+            grouped.bit_order = chained.bit_order = bit_order;
+            chained.grouped = false;
+            uint8_t grouped_data[12] = {}, chained_data[12] = {};
+            uint16_t grouped_words[6] = {}, chained_words[6] = {};
+            const auto grouped_result = grouped.store(grouped_data);
+            const auto chained_result = chained.store(chained_data);
+            ASSERT_EQUALS(static_cast<int>(grouped_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+            ASSERT_EQUALS(grouped_result.bits, leading_bits + 57u);
+            ASSERT_EQUALS(grouped_result.bits, chained_result.bits);
+            ASSERT_EQUALS(grouped_data, chained_data);
+            grouped.store(grouped_words);
+            chained.store(chained_words);
+            ASSERT_EQUALS(grouped_words, chained_words);
+            ASSERT_EQUALS(grouped.serialized_bits().bits, grouped_result.bits);
+
+            grouped_header loaded;
+            loaded.leading_bits = leading_bits;
+            loaded.bit_order = bit_order;
+            loaded.id = 0;
+            loaded.flags = group_flags::NONE;
+            loaded.seq = loaded.len = 0;
+            loaded.ack = false;
+            loaded.delta = 0;
+            const auto load_result = loaded.load(chained_data);
+            ASSERT_EQUALS(static_cast<int>(load_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+            ASSERT_EQUALS(load_result.bits, grouped_result.bits);
+            ASSERT_EQUALS(loaded.id, 0xA5_u8);
+            ASSERT_EQUALS(static_cast<int>(loaded.flags), static_cast<int>(group_flags::URGENT));
+            ASSERT_EQUALS(loaded.seq, 0x1234_u16);
+            ASSERT_EQUALS(loaded.len, 0xBEEF_u16);
+            ASSERT_EQUALS(loaded.ack, true);
+            ASSERT_EQUALS(loaded.delta, static_cast<int8_t>(-2));
+        }
+    }
+    {
+        uint8_t serial_data[8] = {};
+        ASSERT_EQUALS((serdes::packet(serial_data) << serdes::group(0xAB_u8, 0xCDEF_u16)).bit_offset, 24_zu);
+        ASSERT_EQUALS(serial_data, {0xAB, 0xCD, 0xEF, 0x00});
+    }
+
+    // a group that doesn't fit writes exactly what the field chain would, and fails with the same status
+    {
+        grouped_header grouped, chained;
+        chained.grouped = false;
+        uint8_t grouped_data[6] = {}, chained_data[6] = {};
+        const auto grouped_result = grouped.store(grouped_data);
+        const auto chained_result = chained.store(chained_data);
+        ASSERT_EQUALS(static_cast<int>(grouped_result.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+        ASSERT_EQUALS(static_cast<int>(grouped_result.status), static_cast<int>(chained_result.status));
+        ASSERT_EQUALS(grouped_result.bits, chained_result.bits);
+        ASSERT_EQUALS(grouped_data, chained_data);
+    }
+
+    // groups with other field types, byte orders, or rvalues to load into, are copied one field at a time
+    {
+        uint16_t x = 0x0102;
+        float f = 1.5f;
+        uint32_t wide = 0x0A0B0C0D;
+        uint8_t grouped_data[12] = {}, chained_data[12] = {};
+        serdes::packet(grouped_data) << serdes::group(x, f, serdes::bitpack<uint32_t, int>(wide, 20)) << serdes::little_endian(serdes::group(x, wide));
+        serdes::packet(chained_data) << x << f << serdes::bitpack<uint32_t, int>(wide, 20) << serdes::little_endian(x) << serdes::little_endian(wide);
+        ASSERT_EQUALS(grouped_data, chained_data);
+
+        uint16_t loaded = 0;
+        const auto rvalue_load = (serdes::packet(grouped_data) >> serdes::group(loaded, 0x12_u8));
+        ASSERT_EQUALS(static_cast<int>(rvalue_load.status), static_cast<int>(serdes::status_e::NO_LOAD_TO_RVALUE));
+        ASSERT_EQUALS(loaded, 0x0102_u16);
+    }
+}
+
+// a dense header with unaligned fields, pads, aligns, arrays, and nested formats
+struct dense_header : serdes::packet_base
+{
+    uint8_t version = 0x5;
+    bool flag = true;
+    uint16_t length = 0xABC;
+    int8_t delta = -3;
+    group_flags flags = group_flags::URGENT;
+    uint32_t sequence = 0x5A5A5A5;
+    uint64_t timestamp = 0x0123456789ABCDEFull;
+    int16_t samples[3] = {-500, 0x1FF, -1};
+    uint8_t trailer = 0xC3;
+    wire_sample sample = {0x01020304u, -2, 0x1234, 0xFEDC, 0xA5, -100, -2.25f, 0x0102030405060708ull};
+    bool last = true;
+
+    void format(serdes::packet &p) override
+    {
+        p + serdes::bitpack<uint8_t, int>(version, 3) + flag + serdes::bitpack<uint16_t, int>(length, 12);
+        p + serdes::bitpack<int8_t, int>(delta, 5) + serdes::pad<int>(3) + flags + serdes::bitpack<uint32_t, int>(sequence, 27);
+        p + timestamp + serdes::bitpack<int16_t[3], int>(samples, 10) + serdes::bitpack<bool, int>(last, 3);
+        p.align(8);
+        p + trailer + serdes::pad<int>(1) + wire_sample_format::bind(sample) + serdes::bitpack<uint8_t, int>(trailer, 7);
+    }
+};
+
+struct incremental_message : serdes::packet_base
+{
+    uint8_t id = 0;
+    variable_count_message sized{};
+    uint16_t samples[6] = {};
+    mixed_inner inner[2] = {};
+    uint8_t checksum = 0;
+
+    void format(serdes::packet &p) override
+    {
+        p + id + sized + serdes::bitpack<uint16_t[6], int>(samples, 12) + inner[0] + inner[1];
+
+        // (a temporary array is loaded again by every pass)
+        uint8_t reserved[2] = {};
+        p + reserved;
+        p + checksum;
+    }
+};
+
+// feeds the serial data to an incremental loader in chunks, and returns the final status
+static serdes::status_e load_in_chunks(incremental_message &message, const uint8_t *serial_data, size_t size, size_t chunk_size)
+{
+    uint8_t staging[64];
+    serdes::incremental_loader<incremental_message> loader(message, staging);
+    for (size_t received = 0; received < size && loader.status() == serdes::status_e::NEED_MORE_DATA; received += chunk_size)
+        loader.feed(&serial_data[received], received + chunk_size <= size ? chunk_size : size - received);
+    return loader.status();
+}
+
+static void test_incremental_loads()
+{
+    incremental_message sent;
+    sent.id = 0x42;
+    sent.sized.size = 3;
+    for (size_t i = 0; i < 6; ++i)
+        sent.samples[i] = static_cast<uint16_t>(0x123 * (i + 1));
+    sent.inner[0].offset = -5;
+    sent.inner[1].enabled = false;
+    sent.checksum = 0xC5;
+    uint8_t serial_data[32] = {};
+    const auto stored = sent.store(serial_data);
+    const size_t message_bytes = (stored.bits + 7u) / 8u;
+    ASSERT_EQUALS(message_bytes, 21_zu);
+
+    // any chunking loads exactly what a single load of the whole message loads
+    incremental_message expected;
+    expected.load(serial_data);
+    uint8_t expected_data[32] = {};
+    expected.store(expected_data);
+    for (size_t chunk_size : {1u, 2u, 3u, 5u, 8u, 20u, 21u, 32u})
+    {
+        incremental_message loaded;
+        ASSERT_EQUALS(static_cast<int>(load_in_chunks(loaded, serial_data, message_bytes, chunk_size)), static_cast<int>(serdes::status_e::NO_ERROR));
+        uint8_t loaded_data[32] = {};
+        loaded.store(loaded_data);
+        ASSERT_EQUALS(loaded_data, expected_data);
+        ASSERT_EQUALS(loaded.sized.size, 3_u8);
+        ASSERT_EQUALS(loaded.samples[5], 0x6D2_u16);
+        ASSERT_EQUALS(loaded.checksum, 0xC5_u8);
+    }
+
+    // more data is needed until the last byte arrives, then the loaded size excludes anything received after it
+    {
+        incremental_message loaded;
+        uint8_t staging[64];
+        serdes::incremental_loader<incremental_message> loader(loaded, staging);
+        ASSERT_EQUALS(static_cast<int>(loader.feed(serial_data, 20u)), static_cast<int>(serdes::status_e::NEED_MORE_DATA));
+        ASSERT_EQUALS(loader.consumed_bytes(), 0_zu);
+        ASSERT_EQUALS(loaded.samples[5], 0x6D2_u16);
+
+        // (fields and arrays that an earlier pass loaded aren't loaded again)
+        loaded.id = 0xEE;
+        loaded.samples[0] = 0xFFF;
+        ASSERT_EQUALS(static_cast<int>(loader.feed(&serial_data[20], 4u)), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(loader.consumed_bytes(), 21_zu);
+        ASSERT_EQUALS(loader.received_bytes(), 24_zu);
+        ASSERT_EQUALS(loader.result().bits, stored.bits);
+        ASSERT_EQUALS(loaded.id, 0xEE_u8);
+        ASSERT_EQUALS(loaded.samples[0], 0xFFF_u16);
+
+        // (feeding more data after the object is loaded changes nothing)
+        ASSERT_EQUALS(static_cast<int>(loader.feed(serial_data, 4u)), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(loader.received_bytes(), 24_zu);
+    }
+
+    // bytes can be received directly into the staging buffer
+    {
+        incremental_message loaded;
+        uint8_t staging[64];
+        serdes::incremental_loader<incremental_message> loader(loaded, staging);
+        for (size_t i = 0; i < message_bytes; ++i)
+        {
+            ASSERT_EQUALS(static_cast<int>(loader.status()), static_cast<int>(serdes::status_e::NEED_MORE_DATA));
+            *loader.free_space() = serial_data[i];
+            loader.commit(1u);
+        }
+        ASSERT_EQUALS(static_cast<int>(loader.status()), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(loaded.inner[0].offset, int16_t(-5));
+        ASSERT_EQUALS(loaded.inner[1].enabled, false);
+    }
+
+    // a message that doesn't fit in the staging buffer fails once the staging buffer is full
+    {
+        incremental_message loaded;
+        uint8_t staging[16];
+        serdes::incremental_loader<incremental_message> loader(loaded, staging);
+        ASSERT_EQUALS(static_cast<int>(loader.feed(serial_data, 10u)), static_cast<int>(serdes::status_e::NEED_MORE_DATA));
+        ASSERT_EQUALS(static_cast<int>(loader.feed(&serial_data[10], 10u)), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+        ASSERT_EQUALS(loader.received_bytes(), 16_zu);
+    }
+
+    // and other errors are reported once the data they apply to is received
+    {
+        uint8_t invalid_data[8] = {0x01, 0x09};
+        incremental_message loaded;
+        uint8_t staging[64];
+        serdes::incremental_loader<incremental_message> loader(loaded, staging);
+        ASSERT_EQUALS(static_cast<int>(loader.feed(invalid_data, 1u)), static_cast<int>(serdes::status_e::NEED_MORE_DATA));
+        ASSERT_EQUALS(static_cast<int>(loader.feed(&invalid_data[1], 1u)), static_cast<int>(serdes::status_e::NEED_MORE_DATA));
+        ASSERT_EQUALS(static_cast<int>(loader.feed(&invalid_data[2], 6u)), static_cast<int>(serdes::status_e::ARRAY_SIZE_OVER_MAX));
+    }
+}
+
+// splits 64 bytes of serial data into segments that end at the given cuts, with gaps between them
+struct split_serial_data
+{
+    uint8_t memory[128];
+    serdes::buffer_segment segments[8];
+    size_t count = 0u;
+
+    split_serial_data(std::initializer_list<size_t> cuts, uint8_t background) : memory{}, segments{}
+    {
+        std::fill(memory, memory + sizeof(memory), background);
+        size_t start = 0u;
+        for (size_t cut : cuts)
+        {
+            segments[count] = {&memory[start + 8u * count], cut - start};
+            start = cut;
+            ++count;
+        }
+        segments[count] = {&memory[start + 8u * count], 64u - start};
+        ++count;
+    }
+
+    // gathers the segments into one buffer
+    void gather(uint8_t (&serial_data)[64]) const
+    {
+        size_t gathered = 0u;
+        for (size_t i = 0; i < count; ++i)
+        {
+            std::memcpy(&serial_data[gathered], segments[i].data, segments[i].size);
+            gathered += segments[i].size;
+        }
+    }
+
+    // the gap byte after a segment (before the next one)
+    uint8_t gap_byte(size_t segment, size_t gap) const
+    {
+        return static_cast<const uint8_t *>(segments[segment].data)[segments[segment].size + gap];
+    }
+};
+
+// stores and loads an object through segmented serial data, and compares it to a single buffer
+template <typename T_object>
+static void test_segmented_packet_matches(T_object object, std::initializer_list<size_t> cuts, size_t bit_offset, serdes::bit_order_e bit_order)
+{
+    uint8_t expected[64];
+    split_serial_data split(cuts, 0x96);
+    assert_stores_match(
+        expected, uint8_t(0x96),
+        [&](uint8_t(&serial_data)[64]) {
+            serdes::packet pkt(serial_data, ~size_t(0), bit_offset, serdes::mode_e::STORING);
+            pkt.bit_order = bit_order;
+            pkt << object;
+            return result_of(pkt);
+        },
+        [&](uint8_t(&serial_data)[64]) {
+            serdes::segmented_packet pkt(split.segments, split.count, bit_offset, serdes::mode_e::STORING);
+            pkt.bit_order = bit_order;
+            pkt << object;
+            split.gather(serial_data);
+            return result_of(pkt);
+        });
+    // nothing is written past the end of a segment
+    for (size_t i = 0; i + 1u < split.count; ++i)
+        for (size_t gap = 0; gap < 8u; ++gap)
+            ASSERT_EQUALS(split.gap_byte(i, gap), uint8_t(0x96));
+
+    T_object expected_loaded, loaded;
+    assert_loads_match(
+        expected_loaded, loaded,
+        [&](T_object &loaded_object) {
+            serdes::packet pkt(expected, ~size_t(0), bit_offset, serdes::mode_e::LOADING);
+            pkt.bit_order = bit_order;
+            pkt >> loaded_object;
+            return result_of(pkt);
+        },
+        [&](T_object &loaded_object) {
+            serdes::segmented_packet pkt(split.segments, split.count, bit_offset, serdes::mode_e::LOADING);
+            pkt.bit_order = bit_order;
+            pkt >> loaded_object;
+            return result_of(pkt);
+        });
+}
+
+static void test_segmented_packets()
+{
+    // any split of the serial data stores and loads exactly like a single buffer (the header's bulk arrays and
+    // static format aren't used on segments, but give the same result)
+    dense_header header;
+    for (size_t bit_offset : {0u, 5u})
+    {
+        test_segmented_packet_matches(header, {}, bit_offset, serdes::bit_order_e::MSB_FIRST);
+        test_segmented_packet_matches(header, {1u, 2u, 3u, 5u, 8u, 13u, 21u}, bit_offset, serdes::bit_order_e::MSB_FIRST);
+        test_segmented_packet_matches(header, {7u, 7u, 15u, 30u}, bit_offset, serdes::bit_order_e::MSB_FIRST);
+        test_segmented_packet_matches(header, {4u, 9u, 17u, 26u, 34u}, bit_offset, serdes::bit_order_e::LSB_FIRST);
+        test_segmented_packet_matches(incremental_message{}, {3u, 6u, 10u, 11u, 20u}, bit_offset, serdes::bit_order_e::MSB_FIRST);
+        test_segmented_packet_matches(modified_mixed_message(), {2u, 9u, 12u, 18u}, bit_offset, serdes::bit_order_e::MSB_FIRST);
+    }
+
+    // the segments hold as much as their total size
+    {
+        uint8_t first[3] = {}, second[2] = {};
+        const serdes::buffer_segment segments[] = {{first, 3u}, {nullptr, 0u}, {second, 2u}};
+        serdes::segmented_packet pkt(segments);
+        ASSERT_EQUALS(pkt.serial_bit_capacity(), 40_zu);
+        pkt << 0x1234_u16 << serdes::bitpack<uint32_t, int>(0x56789Au, 24) << 0xBC_u8;
+        ASSERT_EQUALS(first, {0x12, 0x34, 0x56});
+        ASSERT_EQUALS(second, {0x78, 0x9A});
+        ASSERT_EQUALS(pkt.bit_offset, 40_zu);
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+    }
+
+    // moving the bit offset back (to back-patch a field, or to load what was stored) leaves the segment of the
+    // last access, and the fields after it are found again
+    {
+        uint8_t first[3] = {}, second[5] = {};
+        const serdes::buffer_segment segments[] = {{first, 3u}, {second, 5u}};
+        serdes::segmented_packet pkt(segments);
+        pkt << 0x1122_u16 << 0x33445566_u32 << 0x77_u8;
+        pkt.bit_offset = 0u;
+        pkt << 0xABCD_u16;
+        ASSERT_EQUALS(first, {0xAB, 0xCD, 0x33});
+        ASSERT_EQUALS(second, {0x44, 0x55, 0x66, 0x77, 0x00});
+        uint16_t patched = 0u;
+        uint32_t straddling = 0u;
+        uint8_t last = 0u;
+        pkt >> patched >> straddling >> last;
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(patched, 0xABCD_u16);
+        ASSERT_EQUALS(straddling, 0x33445566_u32);
+        ASSERT_EQUALS(last, 0x77_u8);
+    }
+
+    // checksums iterate the segments, and the filled segments can be written out with writev
+    {
+        uint8_t first[3] = {}, second[4] = {}, third[8] = {};
+        const serdes::buffer_segment segments[] = {{first, 3u}, {second, 4u}, {third, 8u}};
+        serdes::segmented_packet pkt(segments);
+        pkt << 0x01020304_u32 << serdes::bitpack<uint32_t, int>(0x050607u, 20);
+        ASSERT_EQUALS(pkt.bit_offset, 52_zu);
+        size_t checksum = 0u, segment_count = 0u;
+        for (auto &segment : pkt.previous_bytes())
+        {
+            ++segment_count;
+            for (size_t i = 0; i < segment.num_bytes; ++i)
+                checksum += segment.bytes[i];
+        }
+        ASSERT_EQUALS(segment_count, 2_zu);
+        ASSERT_EQUALS(checksum, 0xBA_zu);
+
+        serdes::buffer_segment filled[3];
+        ASSERT_EQUALS(pkt.filled_segments(filled), 2_zu);
+        ASSERT_EQUALS(reinterpret_cast<uintptr_t>(filled[0].data), reinterpret_cast<uintptr_t>(first));
+        ASSERT_EQUALS(filled[0].size, 3_zu);
+        ASSERT_EQUALS(reinterpret_cast<uintptr_t>(filled[1].data), reinterpret_cast<uintptr_t>(second));
+        ASSERT_EQUALS(filled[1].size, 4_zu);
+        pkt << 0xFF_u8;
+        ASSERT_EQUALS(pkt.filled_segments(filled), 3_zu);
+        ASSERT_EQUALS(reinterpret_cast<uintptr_t>(filled[2].data), reinterpret_cast<uintptr_t>(third));
+        ASSERT_EQUALS(filled[2].size, 1_zu);
+        serdes::buffer_segment too_few[2];
+        ASSERT_EQUALS(pkt.filled_segments(too_few), 0_zu);
+    }
+
+    // empty segments are skipped by the fields, and left out of the filled segments
+    {
+        uint8_t first[2] = {}, second[3] = {};
+        const serdes::buffer_segment segments[] = {{nullptr, 0u}, {first, 2u}, {nullptr, 0u}, {nullptr, 0u}, {second, 3u}, {nullptr, 0u}};
+        serdes::segmented_packet pkt(segments);
+        pkt << 0x010203_u32;
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(first[1], 0x01_u8);
+        ASSERT_EQUALS(second[0], 0x02_u8);
+        serdes::buffer_segment filled[2];
+        ASSERT_EQUALS(pkt.filled_segments(filled), 2_zu);
+        ASSERT_EQUALS(reinterpret_cast<uintptr_t>(filled[0].data), reinterpret_cast<uintptr_t>(first));
+        ASSERT_EQUALS(filled[0].size, 2_zu);
+        ASSERT_EQUALS(reinterpret_cast<uintptr_t>(filled[1].data), reinterpret_cast<uintptr_t>(second));
+        ASSERT_EQUALS(filled[1].size, 2_zu);
+        pkt << 0x04_u8 << 0x05_u8;
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+        ASSERT_EQUALS(second[2], 0x04_u8);
+    }
+}
+
+// collects the words handed over by a word_sink_packet
+template <typename T_word>
+struct collected_words
+{
+    T_word words[256 / sizeof(T_word)] = {};
+    size_t count = 0u;
+    size_t batches = 0u;
+
+    void operator()(const T_word *emitted, size_t emitted_count)
+    {
+        for (size_t i = 0; i < emitted_count && count < 256u / sizeof(T_word); ++i)
+            words[count++] = emitted[i];
+        ++batches;
+    }
+};
+
+// a message larger than the window of the word sinks below
+struct streamed_message : serdes::packet_base
+{
+    uint8_t id = 0x5A;
+    uint16_t samples[40] = {};
+    uint32_t totals[24] = {};
+    uint8_t trailer = 0xC3;
+    streamed_message()
+    {
+        for (size_t i = 0; i < 40; ++i)
+            samples[i] = static_cast<uint16_t>(0x9E3u * (i + 1u));
+        for (size_t i = 0; i < 24; ++i)
+            totals[i] = 0x01234567u * static_cast<uint32_t>(i + 1u);
+    }
+    void format(serdes::packet &p) override
+    {
+        p + id + serdes::bitpack<uint16_t[40], int>(samples, 12) + serdes::pad<int>(3) + totals + trailer;
+    }
+};
+
+// streams an object through a word sink, and compares the words to a packet over an array of them
+template <typename T_word, typename T_object>
+static void test_word_sink_matches(T_object object, size_t bit_offset)
+{
+    constexpr size_t word_count = 256 / sizeof(T_word);
+    T_word expected[word_count];
+    collected_words<T_word> sink;
+    size_t finished_bit_offset = 0u, emitted_words = 0u;
+    const packet_result stored = assert_stores_match(
+        expected, T_word(0),
+        [&](T_word(&serial_data)[word_count]) { return store_through(serdes::packet(serial_data, ~size_t(0), bit_offset), object); },
+        [&](T_word(&serial_data)[word_count]) {
+            serdes::word_sink_packet<T_word, 32u / sizeof(T_word), 1u> pkt(sink, bit_offset);
+            pkt << object;
+            const packet_result result = result_of(pkt);
+            pkt.finish();
+            finished_bit_offset = pkt.bit_offset;
+            emitted_words = pkt.emitted_words();
+            std::copy(sink.words, sink.words + word_count, serial_data);
+            return result;
+        });
+    // finishing emits the last partial word
+    const size_t expected_words = (stored.bit_offset + sizeof(T_word) * 8u - 1u) / (sizeof(T_word) * 8u);
+    ASSERT_EQUALS(finished_bit_offset, expected_words * sizeof(T_word) * 8u);
+    ASSERT_EQUALS(emitted_words, expected_words);
+    ASSERT_EQUALS(sink.count, expected_words);
+}
+
+template <typename T_word>
+static void test_word_sink(size_t bit_offset)
+{
+    dense_header header;
+    test_word_sink_matches<T_word>(header, bit_offset);
+    test_word_sink_matches<T_word>(incremental_message{}, bit_offset);
+    test_word_sink_matches<T_word>(modified_mixed_message(), bit_offset);
+    test_word_sink_matches<T_word>(streamed_message{}, bit_offset);
+}
+
+static void test_word_sink_packets()
+{
+    // the words handed to a sink are the words a packet over an array of them holds
+    for (size_t bit_offset : {0u, 5u, 70u})
+    {
+        test_word_sink<uint8_t>(bit_offset);
+        test_word_sink<uint16_t>(bit_offset);
+        test_word_sink<uint32_t>(bit_offset);
+        test_word_sink<uint64_t>(bit_offset);
+    }
+
+    // words are handed over while storing, so messages larger than the window only need the window
+    {
+        collected_words<uint32_t> sink;
+        serdes::word_sink_packet<uint32_t, 8> pkt(sink);
+        pkt << streamed_message{};
+        ASSERT_EQUALS(pkt.emitted_words(), 35_zu);
+        ASSERT_EQUALS(sink.batches, 5_zu);
+        ASSERT_EQUALS(sink.count, pkt.emitted_words());
+        pkt.finish();
+        ASSERT_EQUALS(sink.count, 40_zu);
+    }
+
+    // pads past the window are handed over as zero words, and finish() zero pads the last word
+    {
+        collected_words<uint16_t> sink;
+        serdes::word_sink_packet<uint16_t, 12> pkt(sink);
+        pkt << 0xABCD_u16 << serdes::pad<int>(16 * 40) << serdes::bitpack<uint8_t, int>(0x5, 3);
+        pkt.finish();
+        ASSERT_EQUALS(pkt.bit_offset, 16_zu * 42u);
+        ASSERT_EQUALS(sink.count, 42_zu);
+        ASSERT_EQUALS(sink.words[0], 0xABCD_u16);
+        ASSERT_EQUALS(static_cast<size_t>(std::count(&sink.words[1], &sink.words[41], 0u)), 40_zu);
+        ASSERT_EQUALS(sink.words[41], 0xA000_u16);
+        pkt << 0x1234_u16;
+        pkt.finish();
+        ASSERT_EQUALS(sink.count, 43_zu);
+        ASSERT_EQUALS(sink.words[42], 0x1234_u16);
+    }
+
+    // fields in the look-back window can be back-patched and checksummed, earlier ones were already handed over
+    {
+        collected_words<uint8_t> sink;
+        serdes::word_sink_packet<uint8_t, 25, 8> pkt(sink);
+        for (uint8_t i = 0; i < 40; ++i)
+            pkt << i;
+        const size_t record_start = pkt.bit_offset;
+        pkt << 0x7E_u8 << 0x00_u8 << 0x0102_u16 << 0x03040506_u32;
+        const size_t record_end = pkt.bit_offset;
+        pkt.bit_offset = record_start + 8u;
+        pkt << uint8_t((record_end - record_start) / 8u);
+        pkt.bit_offset = record_end;
+        uint8_t checksum = 0u;
+        for (auto &segment : pkt.previous_bytes(serdes::starting_byte_index{record_start / 8u}))
+            for (size_t i = 0; i < segment.num_bytes; ++i)
+                checksum = static_cast<uint8_t>(checksum + segment.bytes[i]);
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        pkt << checksum;
+        pkt.finish();
+        ASSERT_EQUALS(sink.count, 49_zu);
+        ASSERT_EQUALS(sink.words[39], 39_u8);
+        uint8_t record[9];
+        std::copy(&sink.words[40], &sink.words[49], record);
+        ASSERT_EQUALS(record, {0x7E, 0x08, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x9B});
+
+        pkt.bit_offset = 0u;
+        pkt << 0xFF_u8;
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+        pkt.reset();
+        pkt.bit_offset = record_end + 8u;
+        pkt.previous_bytes();
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::OUTSIDE_LOOK_BACK_WINDOW));
+    }
+}
+
+// a destination of a write_once_packet, that counts the writes to each of its words into volatile counters
+template <typename T_word>
+struct counted_words
+{
+    // a word of the destination, which can only be written to
+    struct word_reference
+    {
+        counted_words *destination;
+        size_t index;
+        word_reference &operator=(const T_word word)
+        {
+            destination->words[index] = word;
+            destination->writes[index] = destination->writes[index] + 1u;
+            destination->order_kept = destination->order_kept && index >= destination->last_index;
+            destination->last_index = index;
+            return *this;
+        }
+    };
+
+    T_word words[256 / sizeof(T_word)] = {};
+    volatile size_t writes[256 / sizeof(T_word)] = {};
+    bool order_kept = true;
+    size_t last_index = 0u;
+
+    word_reference operator[](size_t index)
+    {
+        return {this, index};
+    }
+
+    size_t total_writes() const
+    {
+        size_t total = 0u;
+        for (size_t i = 0; i < 256u / sizeof(T_word); ++i)
+            total += writes[i];
+        return total;
+    }
+};
+
+// stores an object into a write_once_packet, and compares the words to a packet over an array of them
+template <typename T_word, typename T_object>
+static void test_write_once_matches(T_object object, size_t bit_offset)
+{
+    constexpr size_t word_count = 256 / sizeof(T_word);
+    for (const bool pre_zeroed : {false, true})
+    {
+        T_word expected[word_count];
+        counted_words<T_word> destination;
+        const packet_result stored = assert_stores_match(
+            expected, T_word(0),
+            [&](T_word(&serial_data)[word_count]) { return store_through(serdes::packet(serial_data, ~size_t(0), bit_offset), object); },
+            [&](T_word(&serial_data)[word_count]) {
+                serdes::write_once_packet<T_word, 32u / sizeof(T_word), 1u, counted_words<T_word> &> pkt(destination, word_count, pre_zeroed, bit_offset);
+                pkt << object;
+                const packet_result result = result_of(pkt);
+                pkt.finish();
+                std::copy(destination.words, destination.words + word_count, serial_data);
+                return result;
+            });
+        ASSERT_EQUALS(destination.order_kept, true);
+        // every word is written once (or only the ones with set bits, into a pre-zeroed destination)
+        const size_t expected_words = (stored.bit_offset + sizeof(T_word) * 8u - 1u) / (sizeof(T_word) * 8u);
+        size_t written_words = 0u;
+        for (size_t i = 0; i < word_count; ++i)
+        {
+            const size_t should_write = i < expected_words && (!pre_zeroed || expected[i] != 0u) ? 1u : 0u;
+            ASSERT_EQUALS(destination.writes[i], should_write);
+            written_words += should_write;
+        }
+        ASSERT_EQUALS(destination.total_writes(), written_words);
+    }
+}
+
+static void test_write_once_packets()
+{
+    for (size_t bit_offset : {0u, 5u, 70u})
+    {
+        test_write_once_matches<uint8_t>(dense_header{}, bit_offset);
+        test_write_once_matches<uint16_t>(streamed_message{}, bit_offset);
+        test_write_once_matches<uint32_t>(modified_mixed_message(), bit_offset);
+        test_write_once_matches<uint64_t>(incremental_message{}, bit_offset);
+    }
+
+    // the default destination is volatile words, and fields past its end fail (the words before them are written)
+    {
+        volatile uint16_t registers[4] = {0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF};
+        serdes::write_once_packet<uint16_t> pkt(registers);
+        pkt << 0xABCD_u16 << serdes::bitpack<uint8_t, int>(0x5, 3) << serdes::pad<int>(13) << 0x1234_u16 << 0x12345_u32;
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+        ASSERT_EQUALS(pkt.bit_offset, 48_zu);
+        pkt.finish();
+        ASSERT_EQUALS(registers[0], 0xABCD_u16);
+        ASSERT_EQUALS(registers[1], 0xA000_u16);
+        ASSERT_EQUALS(registers[2], 0x1234_u16);
+        ASSERT_EQUALS(registers[3], 0xFFFF_u16);
+    }
+
+    // a pre-zeroed destination skips the words of pads, and of anything else that's all zeros
+    {
+        counted_words<uint32_t> destination;
+        serdes::write_once_packet<uint32_t, 8, 0, counted_words<uint32_t> &> pkt(destination, 64u, true);
+        pkt << 0x01020304_u32 << serdes::pad<int>(32 * 20) << 0_u32 << 0xA0B0C0D0_u32;
+        pkt.finish();
+        ASSERT_EQUALS(destination.total_writes(), 2_zu);
+        ASSERT_EQUALS(destination.writes[0], 1_zu);
+        ASSERT_EQUALS(destination.writes[22], 1_zu);
+        ASSERT_EQUALS(destination.words[22], 0xA0B0C0D0_u32);
+    }
+}
+
+// a variable length record, with a 12 bit checksum (so records end mid-byte)
+struct capture_record : serdes::packet_base
+{
+    uint8_t type = 0;
+    uint8_t length = 0;
+    uint16_t payload[20] = {};
+    uint16_t checksum = 0;
+    void format(serdes::packet &p) override
+    {
+        p + type + length + serdes::array<uint16_t, uint8_t>(payload, length, 20u) + serdes::bitpack<uint16_t, int>(checksum, 12);
+    }
+};
+
+static capture_record numbered_capture_record(size_t number)
+{
+    capture_record record;
+    record.type = static_cast<uint8_t>(number);
+    record.length = static_cast<uint8_t>((number * 7u) % 21u);
+    for (size_t i = 0; i < record.length; ++i)
+        record.payload[i] = static_cast<uint16_t>(number * 0x101u + i);
+    record.checksum = static_cast<uint16_t>((number * 0x3A7u) & 0xFFFu);
+    return record;
+}
+
+// stores numbered records back-to-back (each starting on a byte boundary), and returns the number of bytes
+static size_t store_capture(uint8_t (&capture)[1024], size_t records)
+{
+    size_t size = 0u;
+    for (size_t number = 0; number < records; ++number)
+    {
+        const auto stored = numbered_capture_record(number).store(&capture[size], sizeof(capture) - size);
+        size += (stored.bits + 7u) / 8u;
+    }
+    return size;
+}
+
+// reads the first records, and returns how many of them are the numbered records
+static size_t read_numbered_records(serdes::record_reader &reader, size_t records)
+{
+    size_t matching = 0u;
+    for (size_t number = 0; number < records; ++number)
+    {
+        capture_record record;
+        const capture_record expected = numbered_capture_record(number);
+        if (reader.next(record).status == serdes::status_e::NO_ERROR && record.type == expected.type && record.length == expected.length &&
+            std::equal(expected.payload, expected.payload + expected.length, record.payload) && record.checksum == expected.checksum)
+            ++matching;
+    }
+    return matching;
+}
+
+// reads every record, and checks they're the numbered records (followed by the end of the records)
+static size_t read_capture(serdes::record_reader &reader, size_t records)
+{
+    const size_t matching = read_numbered_records(reader, records);
+    capture_record past_end;
+    if (reader.next(past_end).status != serdes::status_e::END_OF_RECORDS)
+        return 0u;
+    return matching;
+}
+
+// a record whose format has no fields
+struct empty_record : serdes::packet_base
+{
+    void format(serdes::packet &) override {}
+};
+
+// a std::istream over an array
+struct array_streambuf : std::streambuf
+{
+    array_streambuf(uint8_t *data, size_t size)
+    {
+        char *const begin = reinterpret_cast<char *>(data);
+        setg(begin, begin, begin + size);
+    }
+};
+
+static void test_record_readers()
+{
+    uint8_t capture[1024] = {};
+    const size_t capture_size = store_capture(capture, 40);
+    uint8_t window[64];
+
+    // a file is read through a window that holds a few records at a time
+    {
+        std::FILE *file = std::tmpfile();
+        ASSERT_EQUALS(std::fwrite(capture, 1u, capture_size, file), capture_size);
+        std::rewind(file);
+        serdes::record_reader reader(serdes::file_source(file), window);
+        ASSERT_EQUALS(read_capture(reader, 40), 40_zu);
+        ASSERT_EQUALS(reader.position(), capture_size);
+        std::fclose(file);
+    }
+
+    // and so is a C++ stream
+    {
+        array_streambuf buffer(capture, capture_size);
+        std::istream stream(&buffer);
+        serdes::record_reader reader(serdes::stream_source(stream), window);
+        ASSERT_EQUALS(read_capture(reader, 40), 40_zu);
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    // and a file descriptor (a pipe, which has its serial data in pieces)
+    {
+        int descriptors[2];
+        ASSERT_EQUALS(pipe(descriptors), 0);
+        ASSERT_EQUALS(write(descriptors[1], capture, 100u), 100);
+        ASSERT_EQUALS(write(descriptors[1], &capture[100], capture_size - 100u), static_cast<ssize_t>(capture_size - 100u));
+        close(descriptors[1]);
+        serdes::record_reader reader(serdes::descriptor_source(descriptors[0]), window);
+        ASSERT_EQUALS(read_capture(reader, 40), 40_zu);
+        close(descriptors[0]);
+    }
+#endif
+
+    // a record cut short by the end of the source, or larger than the window, ran past the serial data
+    {
+        array_streambuf buffer(capture, capture_size - 1u);
+        std::istream stream(&buffer);
+        serdes::record_reader reader(serdes::stream_source(stream), window);
+        ASSERT_EQUALS(read_numbered_records(reader, 39), 39_zu);
+        capture_record record;
+        ASSERT_EQUALS(static_cast<int>(reader.next(record).status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+    }
+    {
+        array_streambuf buffer(capture, capture_size);
+        std::istream stream(&buffer);
+        uint8_t small_window[24];
+        serdes::record_reader reader(serdes::stream_source(stream), small_window);
+        capture_record record;
+        ASSERT_EQUALS(static_cast<int>(reader.next(record).status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(static_cast<int>(reader.next(record).status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(static_cast<int>(reader.next(record).status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+        ASSERT_EQUALS(reader.position(), 22_zu);
+    }
+
+    // any other failed record is left unread
+    {
+        uint8_t invalid[128] = {0x01, 0x30};
+        array_streambuf buffer(invalid, sizeof(invalid));
+        std::istream stream(&buffer);
+        serdes::record_reader reader(serdes::stream_source(stream), window);
+        capture_record record;
+        ASSERT_EQUALS(static_cast<int>(reader.next(record).status), static_cast<int>(serdes::status_e::ARRAY_SIZE_OVER_MAX));
+        ASSERT_EQUALS(reader.position(), 0_zu);
+    }
+
+    // and so is a record that used no serial data (instead of loading it from the same bytes forever)
+    {
+        array_streambuf buffer(capture, capture_size);
+        std::istream stream(&buffer);
+        serdes::record_reader reader(serdes::stream_source(stream), window);
+        empty_record record;
+        ASSERT_EQUALS(static_cast<int>(reader.next(record).status), static_cast<int>(serdes::status_e::EMPTY_RECORD));
+        ASSERT_EQUALS(static_cast<int>(reader.next(record).status), static_cast<int>(serdes::status_e::EMPTY_RECORD));
+        ASSERT_EQUALS(reader.position(), 0_zu);
+    }
+}
+
+// fields of every width from 1 to 64 bits (signed and unsigned), so every field straddles the accumulator's refills
+// somewhere, at any starting bit offset
+struct bit_stream_fields
+{
+    uint64_t wide[64] = {};
+    int32_t narrow[32] = {};
+    bool flag = false;
+
+    template <typename T_packet>
+    void format(T_packet &p)
+    {
+        for (size_t i = 0; i < 64u; i++)
+        {
+            p.add(wide[i], i + 1u);
+            if (i < 32u)
+                p.add(narrow[i], i + 1u);
+        }
+        p + flag;
+    }
+};
+
+template <typename T_array>
+static void test_bit_stream_matches_packet()
+{
+    constexpr size_t buffer_size = 512 / sizeof(T_array);
+    bit_stream_fields fields;
+    for (size_t i = 0; i < 64u; i++)
+    {
+        fields.wide[i] = (0x9E3779B97F4A7C15_u64 * (i + 1u)) >> (63u - i);
+        if (i < 32u)
+            fields.narrow[i] = static_cast<int32_t>(0x2545F491u * (i + 7u)) >> (31u - i);
+    }
+    fields.flag = true;
+    // the same frame as a typed_packet, with a nested templated format, a double, and a bool
+    typed_sensor_frame obj;
+    obj.valid = true;
+    obj.timestamp = 0x5ABCDEF;
+    obj.readings[0].channel = 5;
+    obj.readings[0].value = -1234;
+    obj.readings[1].channel = 2;
+    obj.readings[1].value = 4095;
+    obj.scale = -0.125;
+    obj.tail = 0x1234567890ABCDE_u64;
+
+    for (size_t offset : {0u, 1u, 7u, 13u, 60u})
+    {
+        T_array serial_data[buffer_size] = {};
+        serdes::packet(serial_data, buffer_size, offset) << fields;
+        const serdes::sized_pointer<const T_array> stream(serial_data, buffer_size);
+        bit_stream_fields expected_loaded, loaded;
+        const packet_result result = assert_loads_match(
+            expected_loaded, loaded,
+            [&](bit_stream_fields &loaded_fields) { return load_through(serdes::packet(stream, offset), loaded_fields); },
+            [&](bit_stream_fields &loaded_fields) { return load_through(serdes::bit_stream_packet<T_array>(stream, offset), loaded_fields); });
+        ASSERT_EQUALS(static_cast<int>(result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(loaded.wide, fields.wide);
+
+        serdes::packet(serial_data, buffer_size, offset) << obj;
+        typed_sensor_frame expected_frame, frame;
+        bool formatted_by_typed_packet = false;
+        const packet_result frame_result = assert_loads_match(
+            expected_frame, frame,
+            [&](typed_sensor_frame &loaded_frame) { return load_through(serdes::packet(stream, offset), loaded_frame); },
+            [&](typed_sensor_frame &loaded_frame) {
+                serdes::bit_stream_packet<T_array> pkt(serial_data, buffer_size, offset);
+                pkt >> loaded_frame;
+                formatted_by_typed_packet = loaded_frame.readings[1].formatted_by_typed_packet;
+                return result_of(pkt);
+            });
+        ASSERT_EQUALS(static_cast<int>(frame_result.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(frame_result.bit_offset, offset + 1u + 27u + 2u * 16u + 64u + 61u);
+        ASSERT_EQUALS(formatted_by_typed_packet, true);
+    }
+
+    // a buffer cut anywhere fails at the same field as a packet, with the same bit offset and the fields before
+    // it loaded (the field that didn't fit, and the ones after it, are left alone)
+    T_array serial_data[buffer_size] = {};
+    serdes::packet(serial_data, buffer_size, 5u) << fields;
+    for (size_t elements = 0; elements <= buffer_size; elements++)
+    {
+        const serdes::sized_pointer<const T_array> cut(serial_data, elements);
+        bit_stream_fields expected, actual;
+        std::fill(expected.wide, expected.wide + 64, 0xA5A5A5A5A5A5A5A5_u64);
+        std::fill(actual.wide, actual.wide + 64, 0xA5A5A5A5A5A5A5A5_u64);
+        assert_loads_match(
+            expected, actual,
+            [&](bit_stream_fields &loaded_fields) { return load_through(serdes::packet(cut, 5u), loaded_fields); },
+            [&](bit_stream_fields &loaded_fields) { return load_through(serdes::bit_stream_packet<T_array>(cut, 5u), loaded_fields); });
+        ASSERT_EQUALS(actual.wide, expected.wide);
+    }
+}
+
+static void test_bit_stream_packets()
+{
+    test_bit_stream_matches_packet<uint8_t>();
+    test_bit_stream_matches_packet<uint16_t>();
+    test_bit_stream_matches_packet<uint32_t>();
+    test_bit_stream_matches_packet<uint64_t>();
+
+    // the accumulator follows the bit offset through the packet paths (arrays, validators, alignment, other byte
+    // orders, and "void format(serdes::packet&)" methods) and direct changes to it
+    struct legacy_format : serdes::packet_base
+    {
+        uint8_t id = 0x7E;
+        uint16_t counts[2] = {0x0102, 0x0304};
+        uint8_t version = 2;
+
+        void format(serdes::packet &p) override
+        {
+            p + id + counts;
+            p.add(version, [this]() { return version == 2; });
+        }
+    };
+    const uint8_t serial_data[] = {0x7E, 0x01, 0x02, 0x03, 0x04, 0x02, 0xAB, 0xCD, 0x34, 0x12, 0xF0};
+    {
+        legacy_format loaded;
+        loaded.id = 0;
+        loaded.counts[0] = loaded.counts[1] = 0;
+        uint8_t nibble = 0, skipped = 0, last = 0;
+        uint16_t little = 0;
+        serdes::bit_stream_packet<uint8_t> pkt(serial_data);
+        pkt >> serdes::bitpack<uint8_t, int>(nibble, 4);
+        pkt.bit_offset = 0;
+        pkt >> loaded >> serdes::bitpack<uint8_t, int>(nibble, 4);
+        pkt.bit_offset += 4;
+        pkt >> skipped;
+        pkt.endian = serdes::endian_e::LITTLE;
+        pkt >> little;
+        pkt.endian = serdes::endian_e::BIG;
+        pkt >> serdes::bitpack<uint8_t, int>(last, 4);
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::NO_ERROR));
+        ASSERT_EQUALS(pkt.bit_offset, 84_zu);
+        ASSERT_EQUALS(loaded.id, 0x7E_u8);
+        ASSERT_EQUALS(loaded.counts, {0x0102, 0x0304});
+        ASSERT_EQUALS(nibble, 0xA_u8);
+        ASSERT_EQUALS(skipped, 0xCD_u8);
+        ASSERT_EQUALS(little, 0x1234_u16);
+        ASSERT_EQUALS(last, 0xF_u8);
+    }
+
+    // errors are reported the same way as with packet, and nothing is loaded after one
+    {
+        legacy_format invalid;
+        const uint8_t invalid_data[] = {0x7E, 0x01, 0x02, 0x03, 0x04, 0x03, 0xAB};
+        uint8_t after = 0;
+        serdes::bit_stream_packet<uint8_t> pkt(invalid_data);
+        pkt >> invalid >> after;
+        ASSERT_EQUALS(static_cast<int>(pkt.status), static_cast<int>(serdes::status_e::INVALID_FIELD));
+        ASSERT_EQUALS(after, 0_u8);
+
+        uint16_t value = 0x5555;
+        serdes::bit_stream_packet<uint8_t> small_pkt(serial_data, 2u, 4u);
+        small_pkt >> value;
+        ASSERT_EQUALS(static_cast<int>(small_pkt.status), static_cast<int>(serdes::status_e::EXCEEDED_SERIAL_SIZE));
+        ASSERT_EQUALS(small_pkt.bit_offset, 4_zu);
+        ASSERT_EQUALS(value, 0x5555_u16);
+    }
+}
+
 static void testset_serdes()
 {
     test_variable_arrays();
     test_variable_packet_base_arrays();
+    test_static_packet_base();
     test_fixed_sized_arrays();
     test_bitpacked_arrays();
     test_dynamic_bitlength_captures();
@@ -800,11 +3212,33 @@ static void testset_serdes()
     test_alignment_and_padding();
     test_error_catching();
     test_formatter_lambdas();
+    test_inline_formatter_storage();
     test_delimited_arrays();
     test_nested_delimited_arrays();
     test_bitpacked_delimited_arrays();
     test_virtual_formatters();
     test_object_oriented_virtual_formatters();
+    test_bulk_array_kernels();
+    test_byte_swapped_bulk_arrays();
+    test_atomics_in_byte_packets();
+    test_typed_packets();
+    test_unchecked_packets();
+    test_little_endian_fields();
+    test_lsb_first_packets();
+    test_ordered_delimited_arrays();
+    test_bool_arrays_and_bitsets();
+    test_cpu_dispatched_kernels();
+    test_static_formats();
+    test_host_layout_passthrough();
+    test_static_packets();
+    test_serialized_bits();
+    test_field_groups();
+    test_incremental_loads();
+    test_segmented_packets();
+    test_word_sink_packets();
+    test_write_once_packets();
+    test_record_readers();
+    test_bit_stream_packets();
 }
 
 #ifndef DISBALE_TESTS_MAIN
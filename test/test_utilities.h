@@ -160,6 +160,77 @@ void test_bitcpy_insert(int line_num, T inserted_value, size_t bits, size_t bit_
     passes += passed;
 }
 
+// the status and bit offset a store or load ended with, for the differential tests below
+struct packet_result
+{
+    serdes::status_e status;
+    size_t bit_offset;
+};
+
+template <typename T_packet>
+inline packet_result result_of(const T_packet &p)
+{
+    return {p.status, p.bit_offset};
+}
+
+// stores or loads an object through a packet (or a packet backend), for the differential tests' reference and candidate
+template <typename T_packet, typename T_object>
+inline packet_result store_through(T_packet &&p, T_object &&object)
+{
+    p << object;
+    return result_of(p);
+}
+
+template <typename T_packet, typename T_object>
+inline packet_result load_through(T_packet &&p, T_object &&object)
+{
+    p >> object;
+    return result_of(p);
+}
+
+// differential store test: the reference and the candidate each store into their own copy of serial data filled with
+// "fill", and have to end with the same status, bit offset, and serial data (the reference's data is left in expected)
+template <typename T_array, size_t N, typename T_reference, typename T_candidate>
+packet_result assert_stores_match(T_array (&expected)[N], T_array fill, T_reference &&reference, T_candidate &&candidate)
+{
+    T_array actual[N];
+    std::fill(expected, expected + N, fill);
+    std::fill(actual, actual + N, fill);
+    const packet_result expected_result = reference(expected);
+    const packet_result result = candidate(actual);
+    ASSERT_EQUALS(static_cast<int>(result.status), static_cast<int>(expected_result.status));
+    ASSERT_EQUALS(result.bit_offset, expected_result.bit_offset);
+    ASSERT_EQUALS(actual, expected);
+    return result;
+}
+
+template <typename T_object>
+struct packet_store
+{
+    void operator()(serdes::packet &p, T_object &object) const
+    {
+        p << object;
+    }
+};
+
+// differential load test: the reference loads into expected and the candidate into actual, and they have to end with
+// the same status and bit offset, and objects that store the same serial data (through "store")
+template <typename T_object, typename T_reference, typename T_candidate, typename T_store = packet_store<T_object>>
+packet_result assert_loads_match(T_object &expected, T_object &actual, T_reference &&reference, T_candidate &&candidate, T_store store = T_store{})
+{
+    const packet_result expected_result = reference(expected);
+    const packet_result result = candidate(actual);
+    ASSERT_EQUALS(static_cast<int>(result.status), static_cast<int>(expected_result.status));
+    ASSERT_EQUALS(result.bit_offset, expected_result.bit_offset);
+    uint8_t expected_data[512] = {}, actual_data[512] = {};
+    serdes::packet expected_pkt(expected_data, ~size_t(0), 0u, serdes::mode_e::STORING);
+    serdes::packet pkt(actual_data, ~size_t(0), 0u, serdes::mode_e::STORING);
+    store(expected_pkt, expected);
+    store(pkt, actual);
+    ASSERT_EQUALS(actual_data, expected_data);
+    return result;
+}
+
 BITCPY_INT128_CONDITIONAL_DEFINE_C(
     inline __uint128_t form_uint128_t(uint64_t x, uint64_t y) {
         return (static_cast<__uint128_t>(x) << 64) | static_cast<__uint128_t>(y);